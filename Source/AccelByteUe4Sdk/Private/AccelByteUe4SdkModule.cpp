@@ -9,10 +9,14 @@
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteServerSettings.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteMetricsRegistry.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteConnectionWarmup.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteSignalHandler.h"
 #include "Core/AccelByteDataStorageBinaryFile.h"
+#include "Core/AccelByteDataStorageAsyncBinaryFile.h"
+#include "Core/AccelByteServiceCompatibilityChecker.h"
 #include "Core/Platform/AccelBytePlatformHandler.h"
 #include "Api/AccelByteGameTelemetryApi.h"
 #include "Api/AccelByteHeartBeatApi.h"
@@ -20,6 +24,7 @@
 #include "Api/AccelByteGameStandardEventApi.h"
 #include "Core/ServerTime/AccelByteTimeManager.h"
 #include "GameServerApi/AccelByteServerAMSApi.h"
+#include "GameServerApi/AccelByteServerStatisticApi.h"
 #include "Engine/GameInstance.h"
 
 #if WITH_EDITOR
@@ -65,9 +70,14 @@ private:
 	bool LoadServerSettingsFromConfigUObject();
 	bool NullCheckConfig(FString const& Value, FString const& ConfigField);
 	static FVersion GetPluginVersion();
-	void GetVersionInfo(FString const& Url, TFunction<void(FVersionInfo)> Callback) const;
-	void CheckServicesCompatibility() const;
+	void CheckServicesCompatibility();
+	AccelByte::FAccelByteServiceCompatibilityCheckerPtr CompatibilityChecker;
+
+	/** Time spent in each startup phase, logged once the first frame is done. */
+	TArray<FString> StartupTimeline;
+	void RecordStartupPhase(FString const& Phase, double& PhaseStartTime);
 	void SetDefaultHttpCustomHeader(FString const& Namespace);
+	void WarmupConnections();
 
 	void OnGameInstanceCreated(UGameInstance* GameInstance);
 };
@@ -83,20 +93,39 @@ void FAccelByteUe4SdkModule::StartupModule()
 	FModuleManager::Get().LoadModuleChecked("JsonUtilities");
 	FModuleManager::Get().LoadModuleChecked("Projects");
 
+	double const StartupTime = FPlatformTime::Seconds();
+	double PhaseStartTime = StartupTime;
+
 	SettingsEnvironment = ESettingsEnvironment::Default;
 
 	RegisterSettings();
 	LoadSettingsFromConfigUObject();
 	LoadServerSettingsFromConfigUObject();
+	RecordStartupPhase(TEXT("Settings"), PhaseStartTime);
 
-	LocalDataStorage = MakeShared<AccelByte::DataStorageBinaryFile>();
+	bool bEnableAsyncDataStorage = false;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.DataStorage"), TEXT("bEnableAsyncIO"), bEnableAsyncDataStorage);
+	if (bEnableAsyncDataStorage)
+	{
+		TSharedRef<AccelByte::DataStorageAsyncBinaryFile> AsyncDataStorage = MakeShared<AccelByte::DataStorageAsyncBinaryFile>();
+		AsyncDataStorage->Preload(FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+		AsyncDataStorage->Preload(FAccelByteUtilities::GetCacheFilenameTelemetry());
+		LocalDataStorage = AsyncDataStorage;
+	}
+	else
+	{
+		LocalDataStorage = MakeShared<AccelByte::DataStorageBinaryFile>();
+	}
+	RecordStartupPhase(TEXT("LocalDataStorage"), PhaseStartTime);
 
 #ifdef TEMPORARY_ENABLE_COMPAT_CHECK
 #if UE_BUILD_DEVELOPMENT && TEMPORARY_ENABLE_COMPAT_CHECK
 	CheckServicesCompatibility();
 #endif // UE_BUILD_DEVELOPMENT && TEMPORARY_ENABLE_COMPAT_CHECK
 #endif // defined(TEMPORARY_ENABLE_COMPAT_CHECK)
+	RecordStartupPhase(TEXT("CompatibilityCheck"), PhaseStartTime);
 
+	AccelByte::FRegistry::MetricsRegistry.InitializeFromConfig();
 	AccelByte::FRegistry::HttpRetryScheduler.Startup();
 	AccelByte::FRegistry::CredentialsRef->Startup();
 	AccelByte::FRegistry::GameTelemetry.Startup();
@@ -110,6 +139,9 @@ void FAccelByteUe4SdkModule::StartupModule()
 #if UE_SERVER
 	FAccelByteSignalHandler::Initialize();
 #endif
+	RecordStartupPhase(TEXT("CoreServices"), PhaseStartTime);
+	PhaseStartTime = StartupTime;
+	RecordStartupPhase(TEXT("StartupModule"), PhaseStartTime);
 
 	GameInstanceStartHandle = FWorldDelegates::OnStartGameInstance.AddRaw(this, &FAccelByteUe4SdkModule::OnGameInstanceCreated);
 
@@ -118,6 +150,8 @@ void FAccelByteUe4SdkModule::StartupModule()
 
 void FAccelByteUe4SdkModule::PostStartup()
 {
+	double PhaseStartTime = FPlatformTime::Seconds();
+
 	auto StoragePtr = GetLocalDataStorage();
 	if (StoragePtr != nullptr)
 	{
@@ -131,12 +165,40 @@ void FAccelByteUe4SdkModule::PostStartup()
 	{
 		UE_LOG(LogAccelByte, Warning, TEXT("LocalDataStorageUtility can't be obtained, skipping the cache migration."));
 	}
+	RecordStartupPhase(TEXT("CacheMigration"), PhaseStartTime);
+
+	// The local data storage is ready, compute the identifiers before the first login needs them
+	AccelByte::FRegistry::DeviceIdentity.Prefetch();
+	AccelByte::FRegistry::OfflineWriteQueue.Startup();
+	if (IsRunningDedicatedServer())
+	{
+		AccelByte::FRegistry::ServerStatistic.StartupQueuedStatItemIncrements();
+	}
+
+	AccelByte::FRegistry::ConnectionWarmup.LoadConfig();
+	WarmupConnections();
+
+	if (CompatibilityChecker.IsValid())
+	{
+		int32 RevalidateDelaySeconds = 10;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Compatibility"), TEXT("RevalidateDelaySeconds"), RevalidateDelaySeconds);
+		CompatibilityChecker->RevalidateInBackground(static_cast<float>(FMath::Max(0, RevalidateDelaySeconds)));
+	}
+
+	UE_LOG(LogAccelByte, Log, TEXT("Startup timeline: %s"), *FString::Join(StartupTimeline, TEXT(", ")));
+	StartupTimeline.Empty();
 
 	FCoreDelegates::OnBeginFrame.Remove(this->PostStartupDelegateHandle);
 }
 
 void FAccelByteUe4SdkModule::ShutdownModule()
 {
+	if (CompatibilityChecker.IsValid())
+	{
+		CompatibilityChecker->Shutdown();
+		CompatibilityChecker.Reset();
+	}
+
 	AccelByte::FRegistry::ServerCredentialsRef->Shutdown();
 #if !UE_SERVER
 	AccelByte::FRegistry::HeartBeat.Shutdown();
@@ -144,10 +206,17 @@ void FAccelByteUe4SdkModule::ShutdownModule()
 	AccelByte::FRegistry::GameTelemetry.Shutdown();
 	AccelByte::FRegistry::PredefinedEvent.Shutdown();
 	AccelByte::FRegistry::GameStandardEvent.Shutdown();
+	AccelByte::FRegistry::OfflineWriteQueue.Shutdown();
 	AccelByte::FRegistry::CredentialsRef->Shutdown();
+	AccelByte::FRegistry::ConnectionWarmup.Shutdown();
 	AccelByte::FRegistry::HttpRetryScheduler.GetHttpCache().ClearCache();
 	AccelByte::FRegistry::HttpRetryScheduler.Shutdown();
 
+	if (LocalDataStorage.IsValid())
+	{
+		LocalDataStorage->Flush();
+	}
+
 	UnregisterSettings();
 
 	FWorldDelegates::OnStartGameInstance.Remove(GameInstanceStartHandle);
@@ -158,6 +227,7 @@ void FAccelByteUe4SdkModule::SetEnvironment(ESettingsEnvironment const Environme
 	LoadClientSettings(Environment);
 	LoadServerSettings(Environment);
 	SettingsEnvironment = Environment;
+	WarmupConnections();
 	if (EnvironmentChangedDelegate.IsBound())
 	{
 		EnvironmentChangedDelegate.Broadcast(Environment);
@@ -311,73 +381,31 @@ FVersion FAccelByteUe4SdkModule::GetPluginVersion()
 	return Descriptor.VersionName;
 }
 
-void FAccelByteUe4SdkModule::GetVersionInfo(FString const& Url, TFunction<void(FVersionInfo)> Callback) const
-{
-	FHttpRequestPtr const Request = FHttpModule::Get().CreateRequest();
-	Request->SetVerb("GET");
-	Request->SetURL(FString::Printf(TEXT("%s/version"), *Url));
-	Request->OnProcessRequestComplete().BindLambda(
-		[Callback](FHttpRequestPtr const RequestPtr, FHttpResponsePtr const ResponsePtr, bool const bFinished)
-		{
-			if (!bFinished || !ResponsePtr.IsValid())
-			{
-				UE_LOG(LogAccelByte, Warning, TEXT("Getting version info failed:%s"), *RequestPtr->GetURL());
-				return;
-			}
-
-			FString const Content = ResponsePtr->GetContentAsString();
-
-			if (Content.IsEmpty())
-			{
-				UE_LOG(LogAccelByte, Warning, TEXT("Version info empty:%s"), *RequestPtr->GetURL());
-				return;
-			}
-
-			FVersionInfo VersionInfo;
-			FJsonObjectConverter::JsonObjectStringToUStruct(Content, &VersionInfo, 0, 0);
-
-			if (Callback)
-			{
-				Callback(VersionInfo);
-			}
-		});
-
-	Request->ProcessRequest();
-
-}
-
-void FAccelByteUe4SdkModule::CheckServicesCompatibility() const
+void FAccelByteUe4SdkModule::CheckServicesCompatibility()
 {
 	if (GetPluginVersion().Compare(FVersion{TEXT("4.0.0")}) <= 0)
 	{
 		return;
 	}
 
+	// Only the cached results are checked here, the requests are sent in the background after startup
 	FString const Path = FPaths::ProjectPluginsDir() / "AccelByteUe4Sdk/Content/CompatibilityMap.json";
-	FString String;
-	FFileHelper::LoadFileToString(String, *Path);
-	auto CompatibilityMapPtr = MakeShared<FServiceCompatibilityMap>(FServiceCompatibilityMap::FromJson(String));
-
-	for (auto const& ServiceName : CompatibilityMapPtr->GetServices())
+	CompatibilityChecker = MakeShared<AccelByte::FAccelByteServiceCompatibilityChecker, ESPMode::ThreadSafe>(AccelByte::FRegistry::Settings.BaseUrl, GetLocalDataStorage());
+	if (!CompatibilityChecker->Initialize(Path))
 	{
-		if (ServiceName.IsEmpty())
-		{
-			return;
-		}
-
-		GetVersionInfo(
-			AccelByte::FRegistry::Settings.BaseUrl / ServiceName,
-			[CompatibilityMapPtr, ServiceName](FVersionInfo const VersionInfo)
-			{
-				FResult const Result = CompatibilityMapPtr->Check(ServiceName, VersionInfo.Version, true);
-				if (Result.bIsError)
-				{
-					UE_LOG(LogAccelByte, Warning, TEXT("[Compatibility] %s"), *Result.Message);
-				}
-			});
+		CompatibilityChecker.Reset();
 	}
 }
 
+void FAccelByteUe4SdkModule::RecordStartupPhase(FString const& Phase, double& PhaseStartTime)
+{
+	double const Now = FPlatformTime::Seconds();
+	double const DurationMs = (Now - PhaseStartTime) * 1000.0;
+	StartupTimeline.Add(FString::Printf(TEXT("%s %.2fms"), *Phase, DurationMs));
+	AccelByte::FRegistry::MetricsRegistry.RecordLatency(TEXT("Startup.") + Phase, DurationMs);
+	PhaseStartTime = Now;
+}
+
 FEnvironmentChangedDelegate& FAccelByteUe4SdkModule::OnEnvironmentChanged()
 {
 	return EnvironmentChangedDelegate;
@@ -409,6 +437,21 @@ void FAccelByteUe4SdkModule::SetDefaultHttpCustomHeader(FString const& Namespace
 	AccelByte::FHttpRetryScheduler::SetHeaderGameClientVersion(ProjectVersion);
 }
 
+void FAccelByteUe4SdkModule::WarmupConnections()
+{
+	if (!AccelByte::FRegistry::ConnectionWarmup.IsEnabled())
+	{
+		return;
+	}
+
+	// Pay the DNS lookups and the TLS handshakes before the first login needs them
+#if UE_SERVER
+	AccelByte::FRegistry::ConnectionWarmup.Warmup(AccelByte::FAccelByteConnectionWarmup::GetServiceUrls(AccelByte::FRegistry::ServerSettings));
+#else
+	AccelByte::FRegistry::ConnectionWarmup.Warmup(AccelByte::FAccelByteConnectionWarmup::GetServiceUrls(AccelByte::FRegistry::Settings));
+#endif
+}
+
 void FAccelByteUe4SdkModule::OnGameInstanceCreated(UGameInstance* GameInstance)
 {
 	if (!GameInstance->IsValidLowLevel())
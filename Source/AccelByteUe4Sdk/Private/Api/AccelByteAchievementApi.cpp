@@ -264,6 +264,24 @@ FAccelByteTaskWPtr Achievement::UnlockAchievement(const FString& AchievementCode
 	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, FString(), OnSuccess, OnError);
 }
 
+FAccelByteOfflineOperation Achievement::MakeUnlockAchievementOperation(FString const& AchievementCode) const
+{
+	if (AchievementCode.IsEmpty())
+	{
+		return FAccelByteOfflineOperation();
+	}
+
+	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/achievements/%s/unlock")
+		, *SettingsRef.AchievementServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *CredentialsRef->GetUserId()
+		, *AchievementCode);
+
+	FAccelByteOfflineOperation Operation = FAccelByteOfflineOperation::Make(TEXT("PUT"), Url, FString(), CredentialsRef->GetUserId(), EAccelByteOfflineReplaySafety::Idempotent);
+	Operation.CoalesceKey = Operation.Verb + TEXT(" ") + Url;
+	return Operation;
+}
+
 FAccelByteTaskWPtr Achievement::QueryGlobalAchievements(FString const& AchievementCode
 	, EAccelByteGlobalAchievementStatus const& AchievementStatus
 	, EAccelByteGlobalAchievementListSortBy const& SortBy
@@ -513,6 +513,15 @@ namespace IncomingMessage
 		return WebSocket.IsValid() && WebSocket->IsConnected();
 	}
 
+	FAccelByteWebSocketOutboundStats Chat::GetOutboundStats() const
+	{
+		if (!WebSocket.IsValid())
+		{
+			return FAccelByteWebSocketOutboundStats{};
+		}
+		return WebSocket->GetOutboundStats();
+	}
+
 	void Chat::SendPing()
 	{
 		FReport::Log(FString(__FUNCTION__));
@@ -1309,7 +1318,8 @@ namespace IncomingMessage
 	FString Chat::SendWebSocketContent(FString const& Method
 		, TSharedRef<FJsonObject> const& Params)
 	{
-		if (WebSocket.IsValid() && WebSocket->IsConnected())
+		// Requests made while reconnecting are kept in the outbound queue and sent once the connection is back
+		if (WebSocket.IsValid() && WebSocket->IsConnectedOrReconnecting())
 		{
 			FReport::Log(FString(__FUNCTION__));
 			TSharedRef<FJsonObject> JsonObj = MakeShared<FJsonObject>();
@@ -1328,7 +1338,10 @@ namespace IncomingMessage
 			}
 
 			const FString Content = OutJsonString;
-			WebSocket->Send(Content);
+			if (!WebSocket->Send(Content, EWebSocketMessagePriority::Critical))
+			{
+				return TEXT("");
+			}
 			UE_LOG(LogAccelByteChat, Log, TEXT("Sending request:\n %s"), *Content);
 
 			return MessageId;
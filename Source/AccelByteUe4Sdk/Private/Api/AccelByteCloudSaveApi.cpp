@@ -63,6 +63,66 @@ FAccelByteTaskWPtr CloudSave::SaveUserRecord(FString const& Key
 	return HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, OnSuccess, OnError);
 }
 
+FAccelByteTaskWPtr CloudSave::SaveUserRecord(FString const& Key
+	, FJsonObject RecordRequest
+	, bool IsPublic
+	, THandler<FAccelByteModelsUserRecord> const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	if (Key.IsEmpty())
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("Key cannot be empty!"));
+		return nullptr;
+	}
+
+	const FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s%s")
+		, *SettingsRef.CloudSaveServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *CredentialsRef->GetUserId()
+		, *Key
+		, (IsPublic ? TEXT("/public") : TEXT("")));
+
+	FString Content = TEXT("");
+	const TSharedPtr<FJsonObject> JSONObject = MakeShared<FJsonObject>(RecordRequest);
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	FJsonSerializer::Serialize(JSONObject.ToSharedRef(), Writer);
+
+	const TDelegate<void(const FJsonObject&)> OnSuccessHttpClient = THandler<FJsonObject>::CreateLambda(
+		[OnSuccess](FJsonObject const& ResponseObject)
+		{
+			const FAccelByteModelsUserRecord UserRecord = ConvertJsonToUserRecord(ResponseObject);
+			OnSuccess.ExecuteIfBound(UserRecord);
+		});
+
+	return HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, OnSuccessHttpClient, OnError);
+}
+
+FAccelByteOfflineOperation CloudSave::MakeSaveUserRecordOperation(FString const& Key
+	, FJsonObject RecordRequest
+	, bool IsPublic) const
+{
+	if (Key.IsEmpty())
+	{
+		return FAccelByteOfflineOperation();
+	}
+
+	const FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/users/%s/records/%s%s")
+		, *SettingsRef.CloudSaveServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *CredentialsRef->GetUserId()
+		, *Key
+		, (IsPublic ? TEXT("/public") : TEXT("")));
+
+	FString Content = TEXT("");
+	const TSharedPtr<FJsonObject> JSONObject = MakeShared<FJsonObject>(RecordRequest);
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
+	FJsonSerializer::Serialize(JSONObject.ToSharedRef(), Writer);
+
+	return FAccelByteOfflineOperation::Make(TEXT("POST"), Url, Content, CredentialsRef->GetUserId(), EAccelByteOfflineReplaySafety::Idempotent);
+}
+
 FAccelByteTaskWPtr CloudSave::GetUserRecord(FString const& Key
 	, THandler<FAccelByteModelsUserRecord> const& OnSuccess
 	, FErrorHandler const& OnError)
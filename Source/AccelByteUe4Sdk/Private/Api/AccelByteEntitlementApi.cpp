@@ -22,11 +22,26 @@ Entitlement::Entitlement(Credentials const& InCredentialsRef
 	, Settings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
+	, EntitlementsChanged{MakeShared<FOnEntitlementsChanged, ESPMode::ThreadSafe>()}
 {
 }
 
 Entitlement::~Entitlement(){}
 
+FVoidHandler Entitlement::NotifyEntitlementsChanged(FVoidHandler const& OnSuccess) const
+{
+	TWeakPtr<FOnEntitlementsChanged, ESPMode::ThreadSafe> EntitlementsChangedWPtr = EntitlementsChanged;
+	return FVoidHandler::CreateLambda([EntitlementsChangedWPtr, OnSuccess]()
+		{
+			auto EntitlementsChangedPtr = EntitlementsChangedWPtr.Pin();
+			if (EntitlementsChangedPtr.IsValid())
+			{
+				EntitlementsChangedPtr->Broadcast();
+			}
+			OnSuccess.ExecuteIfBound();
+		});
+}
+
 FAccelByteTaskWPtr Entitlement::GetCurrentUserEntitlementHistory(THandler<FAccelByteModelsUserEntitlementHistoryPagingResult> const& OnSuccess
 	, FErrorHandler const& OnError
 	, EAccelByteEntitlementClass const& EntitlementClass
@@ -151,6 +166,57 @@ FAccelByteTaskWPtr Entitlement::QueryUserEntitlements(FString const& Entitlement
 	return HttpClient.ApiRequest("GET", Url, QueryParams, FString(), OnSuccess, OnError);
 }
 
+TSharedRef<TAccelBytePageIterator<FAccelByteModelsEntitlementPagingSlicedResult>, ESPMode::ThreadSafe> Entitlement::IterateUserEntitlements(FString const& EntitlementName
+	, TArray<FString> const& ItemIds
+	, int32 PageSize
+	, FAccelBytePageIteratorOptions const& Options
+	, EAccelByteEntitlementClass EntitlementClass
+	, EAccelByteAppType AppType
+	, TArray<FString> const& Features)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	const FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/entitlements")
+		, *SettingsRef.PlatformServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *CredentialsRef->GetUserId());
+
+	TMultiMap<FString, FString> QueryParams{};
+
+	if (!EntitlementName.IsEmpty())
+	{
+		QueryParams.Add(TEXT("entitlementName"), FGenericPlatformHttp::UrlEncode(EntitlementName));
+	}
+
+	for (const auto& ItemId : ItemIds)
+	{
+		if (!ItemId.IsEmpty())
+		{
+			QueryParams.AddUnique(TEXT("itemId"), ItemId);
+		}
+	}
+
+	for (const auto& Feature : Features)
+	{
+		if (!Feature.IsEmpty())
+		{
+			QueryParams.AddUnique(TEXT("features"), Feature);
+		}
+	}
+
+	if (EntitlementClass != EAccelByteEntitlementClass::NONE)
+	{
+		QueryParams.Add(TEXT("entitlementClazz"), FAccelByteUtilities::GetUEnumValueAsString(EntitlementClass));
+	}
+
+	if (AppType != EAccelByteAppType::NONE)
+	{
+		QueryParams.Add(TEXT("appType"), FAccelByteUtilities::GetUEnumValueAsString(AppType));
+	}
+
+	return HttpClient.CreatePageIterator<FAccelByteModelsEntitlementPagingSlicedResult>(Url, QueryParams, PageSize, 0, Options);
+}
+
 FAccelByteTaskWPtr Entitlement::GetUserEntitlementById(FString const& Entitlementid
 	, THandler<FAccelByteModelsEntitlementInfo> const& OnSuccess
 	, FErrorHandler const& OnError)
@@ -413,7 +479,7 @@ FAccelByteTaskWPtr Entitlement::ConsumeUserEntitlement(FString const& Entitlemen
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::CreateDistributionReceiver(FString const& ExtUserId
@@ -596,7 +662,7 @@ FAccelByteTaskWPtr Entitlement::SyncPlatformPurchase(FAccelByteModelsEntitlement
 		return nullptr;
 	}
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, ContentString, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, ContentString, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncMobilePlatformPurchaseGoogle(FAccelByteModelsPlatformSyncMobileGoogle const& SyncRequest
@@ -620,7 +686,7 @@ FAccelByteTaskWPtr Entitlement::SyncMobilePlatformPurchaseGoogle(FAccelByteModel
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncMobilePlatformPurchaseGooglePlay(FAccelByteModelsPlatformSyncMobileGoogle const& SyncRequest
@@ -643,7 +709,7 @@ FAccelByteTaskWPtr Entitlement::SyncMobilePlatformPurchaseGooglePlay(FAccelByteM
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncMobilePlatformPurchaseApple(FAccelByteModelsPlatformSyncMobileApple const& SyncRequest
@@ -665,7 +731,7 @@ FAccelByteTaskWPtr Entitlement::SyncMobilePlatformPurchaseApple(FAccelByteModels
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncXBoxDLC(FAccelByteModelsXBoxDLCSync const& XboxDLCSync
@@ -684,7 +750,7 @@ FAccelByteTaskWPtr Entitlement::SyncXBoxDLC(FAccelByteModelsXBoxDLCSync const& X
 		, *CredentialsRef->GetNamespace()
 		, *CredentialsRef->GetUserId());
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncSteamDLC(FVoidHandler const& OnSuccess
@@ -719,7 +785,7 @@ FAccelByteTaskWPtr Entitlement::SyncSteamDLC(FVoidHandler const& OnSuccess
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncPSNDLC(FAccelByteModelsPlayStationDLCSync const& PSSyncModel
@@ -736,7 +802,7 @@ FAccelByteTaskWPtr Entitlement::SyncPSNDLC(FAccelByteModelsPlayStationDLCSync co
 		, *CredentialsRef->GetNamespace()
 		, *CredentialsRef->GetUserId());
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncTwitchDropEntitlement(FAccelByteModelsTwitchDropEntitlement const& TwitchDropModel
@@ -762,7 +828,7 @@ FAccelByteTaskWPtr Entitlement::SyncTwitchDropEntitlement(FAccelByteModelsTwitch
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
  
 	// Api Request 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncEpicGameDurableItems(FString const& EpicGamesJwtToken
@@ -785,7 +851,7 @@ FAccelByteTaskWPtr Entitlement::SyncEpicGameDurableItems(FString const& EpicGame
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
  
 	// Api Request 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::ValidateUserItemPurchaseCondition(TArray<FString> const& Items
@@ -864,7 +930,7 @@ FAccelByteTaskWPtr Entitlement::SyncWithDLCEntitlementInPSNStore(FAccelByteModel
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncWithEntitlementInPSNStore(const FAccelByteModelsPlayStationIAPSync& PlaystationModel
@@ -888,7 +954,7 @@ FAccelByteTaskWPtr Entitlement::SyncWithEntitlementInPSNStore(const FAccelByteMo
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SellUserEntitlement(FString const& EntitlementId
@@ -921,7 +987,7 @@ FAccelByteTaskWPtr Entitlement::SellUserEntitlement(FString const& EntitlementId
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 	
 FAccelByteTaskWPtr Entitlement::SyncOculusConsumableEntitlements(THandler<TArray<FAccelByteModelsSyncOculusConsumableEntitlementInfo>> const& OnSuccess
@@ -932,7 +998,7 @@ FAccelByteTaskWPtr Entitlement::SyncOculusConsumableEntitlements(THandler<TArray
 		, *SettingsRef.PlatformServerUrl
 		, *CredentialsRef->GetNamespace()
 		, *CredentialsRef->GetUserId());
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {},  OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {},  NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 	
 FAccelByteTaskWPtr Entitlement::SyncOculusDLC(FVoidHandler const& OnSuccess
@@ -943,7 +1009,7 @@ FAccelByteTaskWPtr Entitlement::SyncOculusDLC(FVoidHandler const& OnSuccess
 		, *SettingsRef.PlatformServerUrl
 		, *CredentialsRef->GetNamespace()
 		, *CredentialsRef->GetUserId());
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {},  OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {},  NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncDLCPSNMultipleService(FAccelByteModelsMultipleServicePSNDLCSync const& PlaystationModel
@@ -963,7 +1029,7 @@ FAccelByteTaskWPtr Entitlement::SyncDLCPSNMultipleService(FAccelByteModelsMultip
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 
 FAccelByteTaskWPtr Entitlement::SyncEntitlementPSNMultipleService(FAccelByteModelsMultipleServicePSNIAPSync const& PlaystationModel
@@ -983,7 +1049,7 @@ FAccelByteTaskWPtr Entitlement::SyncEntitlementPSNMultipleService(FAccelByteMode
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 	
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Content, NotifyEntitlementsChanged(OnSuccess), OnError);
 }
 	
 } // Namespace Api
@@ -17,6 +17,7 @@ Fulfillment::Fulfillment(Credentials const& InCredentialsRef
 	, Settings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
+	, EntitlementsChanged{MakeShared<FOnEntitlementsChanged, ESPMode::ThreadSafe>()}
 {}
 
 Fulfillment::~Fulfillment()
@@ -46,7 +47,19 @@ FAccelByteTaskWPtr Fulfillment::RedeemCode(FString const& Code
 	TSharedRef<TJsonWriter<>> const Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(Json.ToSharedRef(), Writer);
 
-	return HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, OnSuccess, OnError);
+	TWeakPtr<FOnEntitlementsChanged, ESPMode::ThreadSafe> EntitlementsChangedWPtr = EntitlementsChanged;
+	return HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content
+		, THandler<FAccelByteModelsFulfillmentResult>::CreateLambda(
+			[EntitlementsChangedWPtr, OnSuccess](FAccelByteModelsFulfillmentResult const& Result)
+			{
+				auto EntitlementsChangedPtr = EntitlementsChangedWPtr.Pin();
+				if (EntitlementsChangedPtr.IsValid())
+				{
+					EntitlementsChangedPtr->Broadcast();
+				}
+				OnSuccess.ExecuteIfBound(Result);
+			})
+		, OnError);
 }
 
 } // Namespace Api
@@ -7,6 +7,7 @@
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteUtilities.h"
 #include "Core/AccelByteError.h"
+#include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "JsonUtilities.h"
@@ -67,9 +68,8 @@ void GameTelemetry::SetBatchFrequency(FTimespan Interval)
 	}
 	if (bTelemetryJobStarted)
 	{
-		FTickerAlias::GetCoreTicker().RemoveTicker(GameTelemetryTickDelegateHandle);
-		GameTelemetryTickDelegateHandle.Reset();
-		GameTelemetryTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetTotalSeconds()));
+		FRegistry::PeriodicTaskScheduler.RemoveTask(GameTelemetryTickDelegateHandle);
+		GameTelemetryTickDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("GameTelemetry.PeriodicTelemetry"), GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetTotalSeconds()));
 	}
 }
 
@@ -123,7 +123,7 @@ void GameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody
 		{
 			bTelemetryJobStarted = true;
 			GameTelemetryTickDelegate = FTickerDelegate::CreateRaw(this, &GameTelemetry::PeriodicTelemetry);
-			GameTelemetryTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetTotalSeconds()));
+			GameTelemetryTickDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("GameTelemetry.PeriodicTelemetry"), GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetTotalSeconds()));
 		}
 	}
 }
@@ -148,8 +148,7 @@ void GameTelemetry::Shutdown()
 	{
 		if (GameTelemetryTickDelegateHandle.IsValid())
 		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(GameTelemetryTickDelegateHandle);
-			GameTelemetryTickDelegateHandle.Reset();
+			FRegistry::PeriodicTaskScheduler.RemoveTask(GameTelemetryTickDelegateHandle);
 		}
 		
 		if (GameTelemetryLoginSuccess.IsValid())
@@ -228,16 +227,27 @@ bool GameTelemetry::PeriodicTelemetry(float DeltaTime)
 	return true;
 }
 
-void GameTelemetry::SendProtectedEvents(TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> const& Events
-	, FVoidHandler const& OnSuccess
-	, FErrorHandler const& OnError)
+FAccelByteOfflineOperation GameTelemetry::MakeSendEventsOperation(TArray<FAccelByteModelsTelemetryBody> const& TelemetryBodies) const
 {
-
-	FReport::Log(FString(__FUNCTION__));
+	if (TelemetryBodies.Num() == 0)
+	{
+		return FAccelByteOfflineOperation();
+	}
 
 	const FString Url = FString::Printf(TEXT("%s/v1/protected/events")
 		, *SettingsRef.GameTelemetryServerUrl);
 
+	TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> Events;
+	for (FAccelByteModelsTelemetryBody const& TelemetryBody : TelemetryBodies)
+	{
+		Events.Add(MakeShared<FAccelByteModelsTelemetryBody>(TelemetryBody));
+	}
+
+	return FAccelByteOfflineOperation::Make(TEXT("POST"), Url, SerializeEvents(Events), CredentialsRef->GetUserId(), EAccelByteOfflineReplaySafety::AtLeastOnce);
+}
+
+FString GameTelemetry::SerializeEvents(TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> const& Events)
+{
 	FString Content = TEXT("");
 	TArray<TSharedPtr<FJsonValue>> JsonArray;
 	for (auto const& Event : Events)
@@ -254,6 +264,20 @@ void GameTelemetry::SendProtectedEvents(TArray<TSharedPtr<FAccelByteModelsTeleme
 	}
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonArray, Writer);
+	return Content;
+}
+
+void GameTelemetry::SendProtectedEvents(TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> const& Events
+	, FVoidHandler const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+
+	FReport::Log(FString(__FUNCTION__));
+
+	const FString Url = FString::Printf(TEXT("%s/v1/protected/events")
+		, *SettingsRef.GameTelemetryServerUrl);
+
+	const FString Content = SerializeEvents(Events);
 
 	TMap<FString, FString> Headers;
 	Headers.Add(GHeaderABLogSquelch, TEXT("true"));
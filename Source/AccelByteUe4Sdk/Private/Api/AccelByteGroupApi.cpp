@@ -86,6 +86,23 @@ FAccelByteTaskWPtr Group::GetGroupList(FAccelByteModelsGetGroupListRequest const
 	return HttpClient.ApiRequest(TEXT("GET"), Url, QueryParams, FString(), OnSuccess, OnError);
 }
 
+TSharedRef<TAccelBytePageIterator<FAccelByteModelsGetGroupListResponse>, ESPMode::ThreadSafe> Group::IterateGroupList(FAccelByteModelsGetGroupListRequest const& RequestContent
+	, FAccelBytePageIteratorOptions const& Options)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/{namespace}/groups")
+		, *SettingsRef.GroupServerUrl);
+
+	const TMultiMap<FString, FString> QueryParams
+	{
+		{ "groupName", RequestContent.GroupName },
+		{ "groupRegion", RequestContent.GroupRegion }
+	};
+
+	return HttpClient.CreatePageIterator<FAccelByteModelsGetGroupListResponse>(Url, QueryParams, RequestContent.Limit, RequestContent.Offset, Options);
+}
+
 FAccelByteTaskWPtr Group::GetGroup(FString const& GroupId
 	, THandler<FAccelByteModelsGroupInformation> const& OnSuccess
 	, FErrorHandler const& OnError)
@@ -83,7 +83,7 @@ namespace Api
 			return;
 		}
 		HeartBeatTickDelegate = FTickerDelegate::CreateRaw(this, &HeartBeat::SendHeartBeatEvent);
-		HeartBeatTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(HeartBeatTickDelegate, static_cast<float>(HeartBeatInterval.GetTotalSeconds()));
+		HeartBeatTickDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("HeartBeat.SendHeartBeatEvent"), HeartBeatTickDelegate, static_cast<float>(HeartBeatInterval.GetTotalSeconds()));
 		bHeartBeatJobStarted = true;
 	}
 
@@ -91,8 +91,7 @@ namespace Api
 	{
 		if (HeartBeatTickDelegateHandle.IsValid())
 		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(HeartBeatTickDelegateHandle);
-			HeartBeatTickDelegateHandle.Reset();
+			FRegistry::PeriodicTaskScheduler.RemoveTask(HeartBeatTickDelegateHandle);
 		}
 	}
 
@@ -213,6 +213,29 @@ FAccelByteTaskWPtr Inventory::GetUserInventoryAllItems(FString const& InventoryI
 	return HttpClient.ApiRequest(TEXT("GET"), Url, QueryParams, OnSuccess, OnError);
 }
 
+TSharedRef<TAccelBytePageIterator<FAccelByteModelsUserItemsPagingResponse>, ESPMode::ThreadSafe> Inventory::IterateUserInventoryAllItems(FString const& InventoryId
+	, EAccelByteUserItemsSortBy SortBy
+	, int32 PageSize
+	, FAccelBytePageIteratorOptions const& Options
+	, FString const& SourceItemId
+	, FString const& Tags)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/me/inventories/%s/items")
+		, *SettingsRef.InventoryServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *InventoryId);
+
+	const TMultiMap<FString, FString> QueryParams{
+		{ TEXT("sortBy"), FAccelByteInventoryUtilities::ConvertUserItemsSortByToString(SortBy) },
+		{ TEXT("sourceItemId"), SourceItemId.IsEmpty() ? TEXT("") : SourceItemId },
+		{ TEXT("tags"), Tags.IsEmpty() ? TEXT("") : Tags }
+	};
+
+	return HttpClient.CreatePageIterator<FAccelByteModelsUserItemsPagingResponse>(Url, QueryParams, PageSize, 0, Options);
+}
+
 FAccelByteTaskWPtr Inventory::GetUserInventoryItem(FString const& InventoryId
 	, FString const& SlotId
 	, FString const& SourceItemId
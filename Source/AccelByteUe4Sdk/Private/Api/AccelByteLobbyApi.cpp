@@ -521,6 +521,15 @@ bool Lobby::IsConnected() const
 	return WebSocket.IsValid() && WebSocket->IsConnected();
 }
 
+FAccelByteWebSocketOutboundStats Lobby::GetOutboundStats() const
+{
+	if (!WebSocket.IsValid())
+	{
+		return FAccelByteWebSocketOutboundStats{};
+	}
+	return WebSocket->GetOutboundStats();
+}
+
 void Lobby::SendPing()
 {
 	FReport::Log(FString(__FUNCTION__));
@@ -775,9 +784,25 @@ FString Lobby::SendSetPresenceStatus(EAvailability Availability
 		return "";
 	}
 	FString CopyActivity = MessageParser::EscapeString(Activity);
-	SEND_RAW_REQUEST_CACHED_RESPONSE_RETURNED(SetUserPresence
-		, Presence
-		, FString::Printf(TEXT("availability: %s\nactivity: %s\n"), *FAccelByteUtilities::GetUEnumValueAsString(Availability).ToLower(), *CopyActivity))
+
+	// Only the latest presence matters, a pending update is replaced instead of sending every intermediate status
+	FString SupersededMessageId;
+	const FString MessageId = SendRawRequest(LobbyRequest::SetUserPresence
+		, Prefix::Presence
+		, FString::Printf(TEXT("availability: %s\nactivity: %s\n"), *FAccelByteUtilities::GetUEnumValueAsString(Availability).ToLower(), *CopyActivity)
+		, EWebSocketMessagePriority::Background
+		, LobbyRequest::SetUserPresence
+		, &SupersededMessageId);
+	if (!MessageId.IsEmpty())
+	{
+		// The replaced update is never sent, the response of the update that replaced it answers the same delegate
+		if (!SupersededMessageId.IsEmpty())
+		{
+			ID_RESPONSE_MAP(SetUserPresence).Remove(SupersededMessageId);
+		}
+		ID_RESPONSE_MAP(SetUserPresence).Emplace(MessageId, MESSAGE_SUCCESS_HANDLER(SetUserPresence));
+	}
+	return MessageId;
 }
 
 FString Lobby::SendGetOnlineUsersRequest()
@@ -1564,37 +1589,47 @@ FAccelByteTaskWPtr Lobby::BulkGetUserPresence(TArray<FString> const& UserIds
 		return nullptr;
 	}
 
-	TArray<FString> ProcessedUserIds{};
-	TArray<FString> NotProcessedUserIds{};
-
-	if (UserIds.Num() > UserIdsURLLimit)
-	{
-		ProcessedUserIds.Append(UserIds.GetData(), UserIdsURLLimit);
-		NotProcessedUserIds.Append(UserIds.GetData() + UserIdsURLLimit, UserIds.Num() - UserIdsURLLimit);
-	}
-	else
-	{
-		ProcessedUserIds = UserIds;
-	}
-
-	TMultiMap<FString, FString> QueryParams = {
-		{TEXT("countOnly"), CountOnly ? TEXT("true") : TEXT("false")},
-		{ TEXT("userIds"), FString::Join(ProcessedUserIds, TEXT(",")) }
-	};
-
 	const FString Url = FString::Printf(TEXT("%s/lobby/v1/public/presence/namespaces/%s/users/presence")
 		, *SettingsRef.BaseUrl
 		, *CredentialsRef->GetNamespace());
 
-	return HttpClient.ApiRequest(TEXT("GET"), Url, QueryParams
-		, THandler<FAccelByteModelsBulkUserStatusNotif>::CreateLambda(
-			[OnSuccess, NotProcessedUserIds](FAccelByteModelsBulkUserStatusNotif const& Result)
+	TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+	return TAccelByteBulkFanOut<FAccelByteModelsBulkUserStatusNotif>::Run(UserIds
+		, UserIdsURLLimit
+		, [HttpClientWPtr, Url, CountOnly](TArray<FString> const& ChunkUserIds
+			, THandler<FAccelByteModelsBulkUserStatusNotif> const& OnChunkSuccess
+			, FErrorHandler const& OnChunkError)
 			{
-				FAccelByteModelsBulkUserStatusNotif FinalResult = Result;
-				FinalResult.NotProcessed = NotProcessedUserIds;
-				OnSuccess.ExecuteIfBound(FinalResult);
-			})
-		, OnError);
+				const auto HttpClientPtr = HttpClientWPtr.Pin();
+				if (!HttpClientPtr.IsValid())
+				{
+					OnChunkError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+					return FAccelByteTaskPtr();
+				}
+
+				TMultiMap<FString, FString> QueryParams = {
+					{TEXT("countOnly"), CountOnly ? TEXT("true") : TEXT("false")},
+					{ TEXT("userIds"), FString::Join(ChunkUserIds, TEXT(",")) }
+				};
+				return HttpClientPtr->ApiRequest(TEXT("GET"), Url, QueryParams, OnChunkSuccess, OnChunkError);
+			}
+		, [](FAccelByteModelsBulkUserStatusNotif& Merged, FAccelByteModelsBulkUserStatusNotif const& Chunk)
+			{
+				Merged.Data.Append(Chunk.Data);
+				Merged.Online += Chunk.Online;
+				Merged.Busy += Chunk.Busy;
+				Merged.Invisible += Chunk.Invisible;
+				Merged.Offline += Chunk.Offline;
+				Merged.Away += Chunk.Away;
+			}
+		, [OnSuccess, OnError](FAccelByteModelsBulkUserStatusNotif& Merged, TArray<FAccelByteBulkFailure> const& Failures, bool bAnySucceeded)
+			{
+				for (FAccelByteBulkFailure const& Failure : Failures)
+				{
+					Merged.NotProcessed.Append(Failure.Ids);
+				}
+				ReportBulkResult(Merged, Failures, bAnySucceeded, OnSuccess, OnError, FAccelByteBulkFailuresHandler());
+			});
 }
 
 FAccelByteTaskWPtr Lobby::BulkGetUserPresenceV2(TArray<FString> const& UserIds,
@@ -2221,9 +2256,13 @@ void Lobby::OnClosed(int32 StatusCode
 	
 FString Lobby::SendRawRequest(FString const& MessageType
 	, FString const& MessageIDPrefix
-	, FString const& CustomPayload)
+	, FString const& CustomPayload
+	, EWebSocketMessagePriority Priority
+	, FString const& CoalesceKey
+	, FString* OutSupersededMessageId)
 {
-	if (WebSocket.IsValid() && WebSocket->IsConnected())
+	// Requests made while reconnecting are kept in the outbound queue and sent once the connection is back
+	if (WebSocket.IsValid() && WebSocket->IsConnectedOrReconnecting())
 	{
 		const FString MessageID = GenerateMessageID(MessageIDPrefix);
 		FString Content = FString::Printf(TEXT("type: %s\nid: %s"), *MessageType, *MessageID);
@@ -2231,7 +2270,17 @@ FString Lobby::SendRawRequest(FString const& MessageType
 		{
 			Content.Append(FString::Printf(TEXT("\n%s"), *CustomPayload));
 		}
-		WebSocket->Send(Content);
+		FString SupersededMessage;
+		if (!WebSocket->Send(Content, Priority, CoalesceKey, &SupersededMessage))
+		{
+			return TEXT("");
+		}
+		if (OutSupersededMessageId != nullptr && !SupersededMessage.IsEmpty())
+		{
+			TSharedRef<FLobbyMessageMetaData> SupersededMeta = MakeShared<FLobbyMessageMetaData>();
+			ExtractLobbyMessageMetaData(SupersededMessage, SupersededMeta);
+			*OutSupersededMessageId = SupersededMeta->Id;
+		}
 		UE_LOG(LogAccelByteLobby, Verbose, TEXT("Sending request: %s"), *Content);
 		return MessageID;
 	}
@@ -2954,7 +3003,21 @@ void Lobby::HandleMessageNotif(FString const& ReceivedMessageType
 		CASE_NOTIF(PartyChatNotif, FAccelByteModelsPartyMessageNotice);
 		CASE_NOTIF(ChannelChatNotif, FAccelByteModelsChannelMessageNotice);
 		// Presence
-		CASE_NOTIF(FriendStatusNotif, FAccelByteModelsUsersPresenceNotice);
+		case (Notif::FriendStatusNotif):
+		{
+			FAccelByteModelsUsersPresenceNotice PresenceNotice;
+			if (FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &PresenceNotice))
+			{
+				FriendStatusNotif.ExecuteIfBound(PresenceNotice);
+
+				auto MessagingSystemPtr = MessagingSystemWPtr.Pin();
+				if (MessagingSystemPtr.IsValid())
+				{
+					MessagingSystemPtr->SendMessage(EAccelByteMessagingTopic::UserPresenceUpdated, PresenceNotice);
+				}
+			}
+			break;
+		}
 		// Notification
 		case(Notif::MessageNotif):
 		{
@@ -3018,7 +3081,21 @@ void Lobby::HandleMessageNotif(FString const& ReceivedMessageType
 		// Friends + Notification
 		CASE_NOTIF(AcceptFriendsNotif	, FAccelByteModelsAcceptFriendsNotif);
 		CASE_NOTIF(RequestFriendsNotif	, FAccelByteModelsRequestFriendsNotif);
-		CASE_NOTIF(UnfriendNotif		, FAccelByteModelsUnfriendNotif);
+		case (Notif::UnfriendNotif):
+		{
+			FAccelByteModelsUnfriendNotif UnfriendNotice;
+			if (FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &UnfriendNotice))
+			{
+				UnfriendNotif.ExecuteIfBound(UnfriendNotice);
+
+				auto MessagingSystemPtr = MessagingSystemWPtr.Pin();
+				if (MessagingSystemPtr.IsValid())
+				{
+					MessagingSystemPtr->SendMessage(EAccelByteMessagingTopic::FriendRemoved, UnfriendNotice);
+				}
+			}
+			break;
+		}
 		CASE_NOTIF(CancelFriendsNotif	, FAccelByteModelsCancelFriendsNotif);
 		CASE_NOTIF(RejectFriendsNotif	, FAccelByteModelsRejectFriendsNotif);
 		// Block + Notification
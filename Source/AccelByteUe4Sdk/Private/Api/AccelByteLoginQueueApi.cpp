@@ -12,6 +12,8 @@
 #include "Core/AccelByteEnvironment.h"
 #include "Core/AccelByteOauth2Api.h"
 #include "Core/AccelByteUtilities.h"
+#include "HttpModule.h"
+#include "JsonObjectConverter.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteLoginQueue, Log, All);
 DEFINE_LOG_CATEGORY(LogAccelByteLoginQueue);
@@ -77,6 +79,80 @@ FAccelByteTaskWPtr LoginQueue::CancelTicket(FString const& Ticket
 
 	return HttpClient.Request(TEXT("DELETE"), Url, {}, FString(), Headers, OnSuccess, OnError);
 }
+
+FAccelByteLoginQueuePollerPtr LoginQueue::PollTicket(FAccelByteModelsLoginQueueTicketInfo const& TicketInfo
+	, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnTicketUpdated
+	, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnReady
+	, FErrorHandler const& OnError
+	, FString const& Namespace)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	FAccelByteLoginQueuePollerPtr Poller = MakeShared<FAccelByteLoginQueuePoller, ESPMode::ThreadSafe>(
+		[this, Namespace](FString const& Ticket, THandler<FAccelByteLoginQueueRefreshResult> const& OnDone)
+		{
+			return RefreshTicketWithHints(Ticket, Namespace, OnDone);
+		}
+		, FAccelByteLoginQueuePollPolicy::LoadFromConfig());
+	Poller->Start(TicketInfo, OnTicketUpdated, OnReady, OnError);
+
+	return Poller;
+}
+
+FAccelByteTaskWPtr LoginQueue::RefreshTicketWithHints(FString const& Ticket
+	, FString const& Namespace
+	, THandler<FAccelByteLoginQueueRefreshResult> const& OnDone)
+{
+	const FString Url = FString::Printf(TEXT("%s/v1/namespaces/%s/ticket")
+		, *SettingsRef.LoginQueueServerUrl
+		, Namespace.IsEmpty() ? *SettingsRef.Namespace : *Namespace);
+
+	// Sent without FHttpClient, which doesn't give the response headers to its handlers
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Url);
+	Request->SetVerb(TEXT("GET"));
+	Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *Ticket));
+	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+
+	return HttpRef.ProcessRequest(Request
+		, FHttpRequestCompleteDelegate::CreateLambda(
+			[Ticket, OnDone](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bFinished)
+			{
+				FAccelByteLoginQueueRefreshResult Result;
+				if (ResponsePtr.IsValid())
+				{
+					Result.RetryAfterSeconds = FAccelByteLoginQueuePoller::ParseRetryAfter(ResponsePtr->GetHeader(TEXT("Retry-After")));
+				}
+
+				if (ResponsePtr.IsValid() && EHttpResponseCodes::IsOk(ResponsePtr->GetResponseCode()))
+				{
+					Result.bSucceeded = FJsonObjectConverter::JsonObjectStringToUStruct(ResponsePtr->GetContentAsString(), &Result.TicketInfo, 0, 0);
+					Result.TicketInfo.Ticket = Ticket;
+					if (!Result.bSucceeded)
+					{
+						Result.ErrorCode = static_cast<int32>(ErrorCodes::InvalidResponse);
+						Result.ErrorMessage = TEXT("Invalid JSON response");
+					}
+				}
+				else if (FAccelByteHttpCircuitBreaker::IsRejected(RequestPtr))
+				{
+					Result.ErrorCode = static_cast<int32>(ErrorCodes::ServiceCircuitOpen);
+					Result.ErrorMessage = TEXT("Request not sent, circuit open.");
+				}
+				else if (!bFinished)
+				{
+					Result.ErrorCode = static_cast<int32>(ErrorCodes::NetworkError);
+					Result.ErrorMessage = TEXT("Request not sent.");
+				}
+				else
+				{
+					HandleHttpError(RequestPtr, ResponsePtr, Result.ErrorCode, Result.ErrorMessage);
+				}
+
+				OnDone.ExecuteIfBound(Result);
+			})
+		, FPlatformTime::Seconds());
+}
 	
 } // Namespace Api
 } // Namespace AccelByte
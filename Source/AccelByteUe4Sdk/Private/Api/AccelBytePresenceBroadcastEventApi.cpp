@@ -3,6 +3,7 @@
 // and restrictions contact your company contract manager.
 
 #include "Api/AccelBytePresenceBroadcastEventApi.h"
+#include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteReport.h"
 
 namespace AccelByte
@@ -112,7 +113,7 @@ void PresenceBroadcastEvent::StartHeartbeat()
 		return;
 	}
 	PresenceBroadcastEventHeartbeatTickDelegate = FTickerDelegate::CreateRaw(this, &PresenceBroadcastEvent::PeriodicHeartbeat);
-	PresenceBroadcastEventHeartbeatTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(PresenceBroadcastEventHeartbeatTickDelegate, static_cast<float>(BroadcastInterval.GetTotalSeconds()));
+	PresenceBroadcastEventHeartbeatTickDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("PresenceBroadcastEvent.PeriodicHeartbeat"), PresenceBroadcastEventHeartbeatTickDelegate, static_cast<float>(BroadcastInterval.GetTotalSeconds()));
 }
 
 void PresenceBroadcastEvent::StopHeartbeat()
@@ -121,8 +122,7 @@ void PresenceBroadcastEvent::StopHeartbeat()
 		TEXT("This funtion is DEPRECATED, will be removed soon"));
 	if (PresenceBroadcastEventHeartbeatTickDelegateHandle.IsValid())
 	{
-		FTickerAlias::GetCoreTicker().RemoveTicker(PresenceBroadcastEventHeartbeatTickDelegateHandle);
-		PresenceBroadcastEventHeartbeatTickDelegateHandle.Reset();
+		FRegistry::PeriodicTaskScheduler.RemoveTask(PresenceBroadcastEventHeartbeatTickDelegateHandle);
 	}
 }
 
@@ -133,8 +133,7 @@ void PresenceBroadcastEvent::Shutdown()
 	{
 		if (PresenceBroadcastEventHeartbeatTickDelegateHandle.IsValid())
 		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(PresenceBroadcastEventHeartbeatTickDelegateHandle);
-			PresenceBroadcastEventHeartbeatTickDelegateHandle.Reset();
+			FRegistry::PeriodicTaskScheduler.RemoveTask(PresenceBroadcastEventHeartbeatTickDelegateHandle);
 		}
 		if (PresenceBroadcastLoginSuccess.IsValid())
 		{
@@ -129,6 +129,58 @@ FAccelByteTaskWPtr Session::QueryGameSessions(FAccelByteModelsV2GameSessionQuery
 	return HttpClient.ApiRequest(TEXT("POST"), Url, {}, RequestString, OnSuccess, OnError);
 }
 
+TSharedRef<TAccelBytePageIterator<FAccelByteModelsV2PaginatedGameSessionQueryResult>, ESPMode::ThreadSafe> Session::IterateGameSessions(FAccelByteModelsV2GameSessionQuery const& QueryObject
+	, int32 PageSize
+	, FAccelBytePageIteratorOptions const& Options)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/gamesessions")
+		, *SettingsRef.SessionServerUrl
+		, *CredentialsRef->GetNamespace());
+
+	// The query is a POST body, each page serializes its own copy with the page offset and limit
+	const TSharedRef<FJsonObject> QueryJson = MakeShared<FJsonObject>();
+	if (QueryObject.JsonWrapper.JsonObject.IsValid())
+	{
+		QueryJson->Values = QueryObject.JsonWrapper.JsonObject->Values;
+	}
+
+	TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+	return TAccelBytePageIterator<FAccelByteModelsV2PaginatedGameSessionQueryResult>::CreateFromOffsets(
+		[HttpClientWPtr, Url, QueryJson](int32 Offset
+			, int32 Limit
+			, THandler<FAccelByteModelsV2PaginatedGameSessionQueryResult> const& OnPage
+			, FErrorHandler const& OnPageError) -> FAccelByteTaskWPtr
+		{
+			const auto HttpClientPtr = HttpClientWPtr.Pin();
+			if (!HttpClientPtr.IsValid())
+			{
+				OnPageError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+				return nullptr;
+			}
+
+			const TSharedRef<FJsonObject> PageJson = MakeShared<FJsonObject>();
+			PageJson->Values = QueryJson->Values;
+			PageJson->SetNumberField(TEXT("offset"), Offset);
+			PageJson->SetNumberField(TEXT("limit"), Limit);
+
+			FString RequestString;
+			const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&RequestString);
+			if (!FJsonSerializer::Serialize(PageJson, JsonWriter))
+			{
+				OnPageError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest)
+					, TEXT("Failed to send query game session request as our query JSON object failed to serialize to string!"));
+				return nullptr;
+			}
+
+			return HttpClientPtr->ApiRequest(TEXT("POST"), Url, {}, RequestString, OnPage, OnPageError);
+		}
+		, PageSize
+		, 0
+		, Options);
+}
+
 FAccelByteTaskWPtr Session::UpdateGameSession(FString const& GameSessionID
 	, FAccelByteModelsV2GameSessionUpdateRequest const& UpdateRequest
 	, THandler<FAccelByteModelsV2GameSession> const& OnSuccess
@@ -14,14 +14,47 @@ namespace AccelByte
 namespace Api
 {
 
-Statistic::Statistic(Credentials const& InCredentialsRef
+namespace
+{
+	FString SerializeStatItemIncrements(TArray<FAccelByteModelsBulkStatItemInc> const& Data)
+	{
+		FString Contents = "[";
+		FString Content;
+		for (int i = 0; i < Data.Num(); i++)
+		{
+			FJsonObjectConverter::UStructToJsonObjectString(Data[i], Content);
+			Contents += Content;
+			if (i < Data.Num() - 1)
+			{
+				Contents += ",";
+			}
+		}
+		Contents += "]";
+		return Contents;
+	}
+}
+
+Statistic::Statistic(Credentials& InCredentialsRef
 	, Settings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
-{}
+	, CredentialsRef{ InCredentialsRef.AsShared() }
+{
+	IncrementLoginSuccess = CredentialsRef->OnLoginSuccess().AddRaw(this, &Statistic::OnLoginSuccess);
+}
 
 Statistic::~Statistic()
-{}
+{
+	if (UObjectInitialized() && IncrementLoginSuccess.IsValid())
+	{
+		CredentialsRef->OnLoginSuccess().Remove(IncrementLoginSuccess);
+	}
+
+	if (IncrementAccumulator.IsValid())
+	{
+		IncrementAccumulator->Shutdown();
+	}
+}
 
 FString Statistic::ConvertUserStatisticSortByToString(EAccelByteStatisticSortBy SortBy)
 {
@@ -153,6 +186,54 @@ FAccelByteTaskWPtr Statistic::GetUserStatItems(FString const& UserId
 	return HttpClient.ApiRequest("GET", Url, QueryParams, FString(), Headers, OnSuccess, OnError);
 }
 
+TSharedRef<TAccelBytePageIterator<FAccelByteModelsUserStatItemPagingSlicedResult>, ESPMode::ThreadSafe> Statistic::IterateUserStatItems(TArray<FString> const& StatCodes
+	, TArray<FString> const& Tags
+	, int32 PageSize
+	, FAccelBytePageIteratorOptions const& Options
+	, EAccelByteStatisticSortBy SortBy)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/statitems")
+		, *SettingsRef.StatisticServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *CredentialsRef->GetUserId());
+
+	const TMultiMap<FString, FString> QueryParams {
+		{ TEXT("statCodes"), FString::Join(StatCodes, TEXT(",")) },
+		{ TEXT("tags"), FString::Join(Tags, TEXT(",")) },
+		{ TEXT("sortBy"), SortBy == EAccelByteStatisticSortBy::NONE ? TEXT("") : ConvertUserStatisticSortByToString(SortBy) },
+	};
+
+	// Same squelched log header as GetUserStatItems, which CreatePageIterator can't set
+	TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+	return TAccelBytePageIterator<FAccelByteModelsUserStatItemPagingSlicedResult>::CreateFromOffsets(
+		[HttpClientWPtr, Url, QueryParams](int32 Offset
+			, int32 Limit
+			, THandler<FAccelByteModelsUserStatItemPagingSlicedResult> const& OnPage
+			, FErrorHandler const& OnPageError) -> FAccelByteTaskWPtr
+		{
+			const auto HttpClientPtr = HttpClientWPtr.Pin();
+			if (!HttpClientPtr.IsValid())
+			{
+				OnPageError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+				return nullptr;
+			}
+
+			TMultiMap<FString, FString> PageQueryParams = QueryParams;
+			PageQueryParams.Add(TEXT("offset"), FString::FromInt(Offset));
+			PageQueryParams.Add(TEXT("limit"), FString::FromInt(Limit));
+
+			TMap<FString, FString> Headers;
+			Headers.Add(GHeaderABLogSquelch, TEXT("true"));
+
+			return HttpClientPtr->ApiRequest("GET", Url, PageQueryParams, FString(), Headers, OnPage, OnPageError);
+		}
+		, PageSize
+		, 0
+		, Options);
+}
+
 FAccelByteTaskWPtr Statistic::IncrementUserStatItems(TArray<FAccelByteModelsBulkStatItemInc> const& Data
 	, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> const& OnSuccess
 	, FErrorHandler const& OnError)
@@ -164,24 +245,108 @@ FAccelByteTaskWPtr Statistic::IncrementUserStatItems(TArray<FAccelByteModelsBulk
 		, *CredentialsRef->GetNamespace()
 		, *CredentialsRef->GetUserId());
 
-	FString Contents = "[";
-	FString Content;
-	for (int i = 0; i < Data.Num(); i++)
+	TMap<FString, FString> Headers;
+	Headers.Add(GHeaderABLogSquelch, TEXT("true"));
+
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, SerializeStatItemIncrements(Data), Headers, OnSuccess, OnError);
+} 
+
+void Statistic::QueueIncrementUserStatItems(TArray<FAccelByteModelsBulkStatItemInc> const& Data)
+{
+	FAccelByteStatIncrementAccumulatorPtr Accumulator = GetIncrementAccumulator(CredentialsRef->GetUserId());
+	if (!Accumulator.IsValid())
 	{
-		FJsonObjectConverter::UStructToJsonObjectString(Data[i], Content);
-		Contents += Content;
-		if (i < Data.Num() - 1)
+		UE_LOG(LogAccelByte, Warning, TEXT("Stat item increments can't be queued without a logged in user"));
+		return;
+	}
+
+	for (FAccelByteModelsBulkStatItemInc const& Item : Data)
+	{
+		Accumulator->Add(IncrementAccumulatorUserId, Item.statCode, Item.inc);
+	}
+}
+
+void Statistic::FlushQueuedStatItemIncrements(THandler<bool> const& OnDone)
+{
+	if (!IncrementAccumulator.IsValid())
+	{
+		OnDone.ExecuteIfBound(true);
+		return;
+	}
+	IncrementAccumulator->Flush(OnDone);
+}
+
+void Statistic::OnLoginSuccess(FOauth2Token const& Response)
+{
+	// Started eagerly so the increments a previous run couldn't send are reloaded and sent without waiting for a new one
+	GetIncrementAccumulator(Response.User_id);
+}
+
+FAccelByteStatIncrementAccumulatorPtr Statistic::GetIncrementAccumulator(FString const& UserId)
+{
+	if (UserId.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Queued increments belong to the user who made them, they are kept under that user until they can be sent
+	if (!IncrementAccumulator.IsValid() || IncrementAccumulatorUserId != UserId)
+	{
+		if (IncrementAccumulator.IsValid())
 		{
-			Contents += ",";
+			IncrementAccumulator->Shutdown();
 		}
-	}
-	Contents += "]";
 
-	TMap<FString, FString> Headers;
-	Headers.Add(GHeaderABLogSquelch, TEXT("true"));
+		IncrementAccumulatorUserId = UserId;
+
+		// The accumulator can outlive this object, its flush request only holds weak references
+		TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+		TWeakPtr<Credentials, ESPMode::ThreadSafe> CredentialsWPtr = CredentialsRef;
+		const FString StatisticServerUrl = SettingsRef.StatisticServerUrl;
+		IncrementAccumulator = MakeShared<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe>(
+			FString::Printf(TEXT("StatIncrements/%s"), *UserId)
+			, [HttpClientWPtr, CredentialsWPtr, StatisticServerUrl, UserId](TArray<FAccelByteModelsBulkUserStatItemInc> const& Increments
+				, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> const& OnSuccess
+				, FErrorHandler const& OnError) -> FAccelByteTaskWPtr
+			{
+				const auto HttpClientPtr = HttpClientWPtr.Pin();
+				const auto CredentialsPtr = CredentialsWPtr.Pin();
+				if (!HttpClientPtr.IsValid() || !CredentialsPtr.IsValid())
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+					return nullptr;
+				}
+				if (CredentialsPtr->GetUserId() != UserId)
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::StatusUnauthorized), TEXT("The increments belong to another user"));
+					return nullptr;
+				}
+
+				TArray<FAccelByteModelsBulkStatItemInc> Data;
+				Data.Reserve(Increments.Num());
+				for (FAccelByteModelsBulkUserStatItemInc const& Increment : Increments)
+				{
+					FAccelByteModelsBulkStatItemInc Item;
+					Item.statCode = Increment.statCode;
+					Item.inc = Increment.inc;
+					Data.Add(Item);
+				}
+
+				const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/statitems/value/bulk")
+					, *StatisticServerUrl
+					, *CredentialsPtr->GetNamespace()
+					, *UserId);
+
+				TMap<FString, FString> Headers;
+				Headers.Add(GHeaderABLogSquelch, TEXT("true"));
+
+				return HttpClientPtr->ApiRequest(TEXT("PUT"), Url, {}, SerializeStatItemIncrements(Data), Headers, OnSuccess, OnError);
+			});
+		IncrementAccumulator->Startup();
+	}
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Contents, Headers, OnSuccess, OnError);
-} 
+	return IncrementAccumulator;
+}
 
 FAccelByteTaskWPtr Statistic::ListUserStatItems(TArray<FString> const& StatCodes
 	, TArray<FString> const& Tags
@@ -259,6 +424,42 @@ FAccelByteTaskWPtr Statistic::UpdateUserStatItemsValue(FString const& StatCode
 	return HttpClient.ApiRequest(TEXT("PUT"), Url, QueryParams, Content, OnSuccess, OnError);
 }
 
+FAccelByteOfflineOperation Statistic::MakeUpdateUserStatItemsValueOperation(FString const& StatCode
+	, FString const& AdditionalKey
+	, FAccelByteModelsPublicUpdateUserStatItem const& UpdateUserStatItem) const
+{
+	if (StatCode.IsEmpty())
+	{
+		return FAccelByteOfflineOperation();
+	}
+
+	FString Url = FString::Printf(TEXT("%s/v2/public/namespaces/%s/users/%s/stats/%s/statitems/value")
+		, *SettingsRef.StatisticServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *CredentialsRef->GetUserId()
+		, *StatCode);
+	if (!AdditionalKey.IsEmpty())
+	{
+		Url += FString::Printf(TEXT("?additionalKey=%s"), *FGenericPlatformHttp::UrlEncode(AdditionalKey));
+	}
+
+	FString Content = TEXT("");
+	FJsonObjectConverter::UStructToJsonObjectString(UpdateUserStatItem, Content);
+
+	EAccelByteOfflineReplaySafety ReplaySafety = EAccelByteOfflineReplaySafety::Idempotent;
+	if (UpdateUserStatItem.UpdateStrategy == EAccelByteStatisticUpdateStrategy::INCREMENT)
+	{
+		ReplaySafety = EAccelByteOfflineReplaySafety::Unsafe;
+	}
+
+	FAccelByteOfflineOperation Operation = FAccelByteOfflineOperation::Make(TEXT("PUT"), Url, Content, CredentialsRef->GetUserId(), ReplaySafety);
+	if (UpdateUserStatItem.UpdateStrategy == EAccelByteStatisticUpdateStrategy::OVERRIDE)
+	{
+		Operation.CoalesceKey = Operation.Verb + TEXT(" ") + Url;
+	}
+	return Operation;
+}
+
 FAccelByteTaskWPtr Statistic::BulkFetchStatItemsValue(FString const& StatCode
 	, TArray<FString> const& UserIds
 	, THandler<TArray<FAccelByteModelsStatItemValueResponse>> const& OnSuccess
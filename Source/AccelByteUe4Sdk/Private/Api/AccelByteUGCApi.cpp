@@ -763,6 +763,21 @@ FAccelByteTaskWPtr UGC::GetUserContent(FString const& UserId
 	return HttpClient.ApiRequest(TEXT("GET"), Url, QueryParams, OnSuccess, OnError);
 }
 
+TSharedRef<TAccelBytePageIterator<FAccelByteModelsUGCContentPageResponse>, ESPMode::ThreadSafe> UGC::IterateUserContent(FString const& UserId
+	, int32 PageSize
+	, FAccelBytePageIteratorOptions const& Options)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	// An invalid UserId is reported by the first page request
+	const FString Url = FString::Printf(TEXT("%s/v1/public/namespaces/%s/users/%s/contents")
+		, *SettingsRef.UGCServerUrl
+		, *CredentialsRef->GetNamespace()
+		, *FGenericPlatformHttp::UrlEncode(UserId));
+
+	return HttpClient.CreatePageIterator<FAccelByteModelsUGCContentPageResponse>(Url, {}, PageSize, 0, Options);
+}
+
 FAccelByteTaskWPtr UGC::PublicGetUserContent(FString const& UserId
 	, THandler<FAccelByteModelsUGCContentPageResponse> const& OnSuccess
 	, FErrorHandler const& OnError
@@ -2349,7 +2349,8 @@ FAccelByteTaskWPtr User::GetUserEligibleToPlay(THandler<bool> const& OnSuccess
 
 FAccelByteTaskWPtr User::BulkGetUserInfo(TArray<FString> const& UserIds
 	, THandler<FListBulkUserInfo> const& OnSuccess
-	, FErrorHandler const& OnError) 
+	, FErrorHandler const& OnError
+	, FAccelByteBulkFailuresHandler const& OnPartialFailure)
 {
 	FReport::Log(FString(__FUNCTION__));
 
@@ -2359,21 +2360,44 @@ FAccelByteTaskWPtr User::BulkGetUserInfo(TArray<FString> const& UserIds
 		return nullptr;
 	}
 
-	const FListBulkUserInfoRequest UserList{ UserIds };
-
 	const FString Url = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/bulk/basic")
 		, *SettingsRef.IamServerUrl
 		, *SettingsRef.Namespace);
 
-	FString Content;
-	FJsonObjectConverter::UStructToJsonObjectString(UserList, Content);
+	TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+	return TAccelByteBulkFanOut<FListBulkUserInfo>::Run(UserIds
+		, MaximumQueryLimit
+		, [HttpClientWPtr, Url](TArray<FString> const& ChunkUserIds
+			, THandler<FListBulkUserInfo> const& OnChunkSuccess
+			, FErrorHandler const& OnChunkError)
+			{
+				const auto HttpClientPtr = HttpClientWPtr.Pin();
+				if (!HttpClientPtr.IsValid())
+				{
+					OnChunkError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+					return FAccelByteTaskPtr();
+				}
 
-	TMap<FString, FString> Headers = {
-		{TEXT("Content-Type"), TEXT("application/json")},
-		{TEXT("Accept"), TEXT("application/json")}
-	};
+				const FListBulkUserInfoRequest UserList{ ChunkUserIds };
 
-	return HttpClient.Request(TEXT("POST"), Url, Content, Headers, OnSuccess, OnError);
+				FString Content;
+				FJsonObjectConverter::UStructToJsonObjectString(UserList, Content);
+
+				TMap<FString, FString> Headers = {
+					{TEXT("Content-Type"), TEXT("application/json")},
+					{TEXT("Accept"), TEXT("application/json")}
+				};
+
+				return HttpClientPtr->Request(TEXT("POST"), Url, Content, Headers, OnChunkSuccess, OnChunkError);
+			}
+		, [](FListBulkUserInfo& Merged, FListBulkUserInfo const& Chunk)
+			{
+				Merged.Data.Append(Chunk.Data);
+			}
+		, [OnSuccess, OnError, OnPartialFailure](FListBulkUserInfo& Merged, TArray<FAccelByteBulkFailure> const& Failures, bool bAnySucceeded)
+			{
+				ReportBulkResult(Merged, Failures, bAnySucceeded, OnSuccess, OnError, OnPartialFailure);
+			});
 }
 
 FAccelByteTaskWPtr User::GetInputValidations(FString const& LanguageCode
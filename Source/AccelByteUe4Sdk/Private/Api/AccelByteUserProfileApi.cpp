@@ -86,7 +86,8 @@ FAccelByteTaskWPtr UserProfile::BatchGetPublicUserProfileInfos(FString const& Us
 
 FAccelByteTaskWPtr UserProfile::BulkGetPublicUserProfileInfos(TArray<FString> const& UserIds
 	, THandler<TArray<FAccelByteModelsPublicUserProfileInfo>> const& OnSuccess
-	, FErrorHandler const& OnError)
+	, FErrorHandler const& OnError
+	, FAccelByteBulkFailuresHandler const& OnPartialFailure)
 {
 	FReport::Log(FString(__FUNCTION__));
 
@@ -94,15 +95,39 @@ FAccelByteTaskWPtr UserProfile::BulkGetPublicUserProfileInfos(TArray<FString> co
 		, *SettingsRef.BasicServerUrl
 		, *CredentialsRef->GetNamespace());
 
-	const TMultiMap<FString, FString> QueryParams = {
-		{TEXT("userIds"), FString::Join(UserIds, TEXT(","))}
-	};
-
-	const TMap<FString, FString> Headers = {
-		{TEXT("Accept"), TEXT("application/json")}
-	};
-
-	return HttpClient.Request(TEXT("GET"), Url, QueryParams, Headers, OnSuccess, OnError);
+	using FPublicUserProfileInfos = TArray<FAccelByteModelsPublicUserProfileInfo>;
+	TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+	return TAccelByteBulkFanOut<FPublicUserProfileInfos>::Run(UserIds
+		, UserIdsURLLimit
+		, [HttpClientWPtr, Url](TArray<FString> const& ChunkUserIds
+			, THandler<FPublicUserProfileInfos> const& OnChunkSuccess
+			, FErrorHandler const& OnChunkError)
+			{
+				const auto HttpClientPtr = HttpClientWPtr.Pin();
+				if (!HttpClientPtr.IsValid())
+				{
+					OnChunkError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+					return FAccelByteTaskPtr();
+				}
+
+				const TMultiMap<FString, FString> QueryParams = {
+					{TEXT("userIds"), FString::Join(ChunkUserIds, TEXT(","))}
+				};
+
+				const TMap<FString, FString> Headers = {
+					{TEXT("Accept"), TEXT("application/json")}
+				};
+
+				return HttpClientPtr->Request(TEXT("GET"), Url, QueryParams, Headers, OnChunkSuccess, OnChunkError);
+			}
+		, [](FPublicUserProfileInfos& Merged, FPublicUserProfileInfos const& Chunk)
+			{
+				Merged.Append(Chunk);
+			}
+		, [OnSuccess, OnError, OnPartialFailure](FPublicUserProfileInfos& Merged, TArray<FAccelByteBulkFailure> const& Failures, bool bAnySucceeded)
+			{
+				ReportBulkResult(Merged, Failures, bAnySucceeded, OnSuccess, OnError, OnPartialFailure);
+			});
 }
 
 FAccelByteTaskWPtr UserProfile::BulkGetPublicUserProfileInfosV2(TArray<FString> const& UserIds,
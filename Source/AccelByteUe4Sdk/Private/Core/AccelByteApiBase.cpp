@@ -15,6 +15,7 @@ FApiBase::FApiBase(
 	, SettingsRef{InSettingsRef}
 	, HttpRef{InHttpRef}
 	, HttpClient(InCredentialsRef, InSettingsRef, InHttpRef)
+	, HttpClientHandle(MakeShareable(&HttpClient, [](FHttpClient*) {}))
 {
 }
 
@@ -0,0 +1,742 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteCloudSaveRecordManager.h"
+#include "JsonObjectWrapper.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Api/AccelByteCloudSaveApi.h"
+#include "GameServerApi/AccelByteServerCloudSaveApi.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FAccelByteCloudSaveRecordManagerPtr FAccelByteCloudSaveRecordManager::CreateForUserRecords(Api::CloudSave& CloudSave)
+{
+	FBackend Backend;
+	Backend.GetRecord = [&CloudSave](FString const& Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return CloudSave.GetUserRecord(Key
+			, THandler<FAccelByteModelsUserRecord>::CreateLambda(
+				[OnSuccess](FAccelByteModelsUserRecord const& Record)
+				{
+					OnSuccess.ExecuteIfBound(FAccelByteCloudSaveRecordSnapshot{Record.Value.JsonObject, Record.UpdatedAt});
+				})
+			, OnError);
+	};
+	Backend.AppendRecord = [&CloudSave](FString const& Key
+		, FJsonObject const& Fields
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return CloudSave.SaveUserRecord(Key
+			, Fields
+			, false
+			, THandler<FAccelByteModelsUserRecord>::CreateLambda(
+				[OnSuccess](FAccelByteModelsUserRecord const& Record)
+				{
+					OnSuccess.ExecuteIfBound(FAccelByteCloudSaveRecordSnapshot{Record.Value.JsonObject, Record.UpdatedAt});
+				})
+			, OnError);
+	};
+	Backend.ReplaceRecord = [&CloudSave](FString const& Key
+		, FDateTime const& UpdatedAt
+		, FJsonObject const& Value
+		, THandler<FDateTime> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		FJsonObjectWrapper RecordRequest;
+		RecordRequest.JsonObject = MakeShared<FJsonObject>(Value);
+		return CloudSave.ReplaceUserRecordCheckLatest(Key
+			, UpdatedAt
+			, RecordRequest
+			, THandler<FAccelByteModelsReplaceUserRecordResponse>::CreateLambda(
+				[OnSuccess](FAccelByteModelsReplaceUserRecordResponse const& Response)
+				{
+					OnSuccess.ExecuteIfBound(Response.Updated_At);
+				})
+			, OnError);
+	};
+	Backend.bReplaceChecksUpdatedAt = true;
+	Backend.NotFoundErrorCode = static_cast<int32>(ErrorCodes::PlayerRecordNotFoundException);
+	Backend.ConflictErrorCode = static_cast<int32>(ErrorCodes::PlayerRecordPreconditionFailedException);
+
+	FAccelByteCloudSaveRecordManagerPtr Manager = MakeShared<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe>(MoveTemp(Backend));
+	Manager->Startup();
+	return Manager;
+}
+
+FAccelByteCloudSaveRecordManagerPtr FAccelByteCloudSaveRecordManager::CreateForGameRecords(GameServerApi::ServerCloudSave& ServerCloudSave)
+{
+	FBackend Backend;
+	Backend.GetRecord = [&ServerCloudSave](FString const& Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return ServerCloudSave.GetGameRecord(Key
+			, THandler<FAccelByteModelsGameRecord>::CreateLambda(
+				[OnSuccess](FAccelByteModelsGameRecord const& Record)
+				{
+					OnSuccess.ExecuteIfBound(FAccelByteCloudSaveRecordSnapshot{Record.Value.JsonObject, Record.UpdatedAt});
+				})
+			, OnError);
+	};
+	Backend.AppendRecord = [&ServerCloudSave](FString const& Key
+		, FJsonObject const& Fields
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return ServerCloudSave.SaveGameRecord(Key
+			, Fields
+			, FVoidHandler::CreateLambda(
+				[OnSuccess]()
+				{
+					OnSuccess.ExecuteIfBound(FAccelByteCloudSaveRecordSnapshot{});
+				})
+			, OnError);
+	};
+	Backend.ReplaceRecord = [&ServerCloudSave](FString const& Key
+		, FDateTime const& UpdatedAt
+		, FJsonObject const& Value
+		, THandler<FDateTime> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return ServerCloudSave.ReplaceGameRecord(Key
+			, Value
+			, FVoidHandler::CreateLambda(
+				[OnSuccess]()
+				{
+					OnSuccess.ExecuteIfBound(FDateTime{0});
+				})
+			, OnError);
+	};
+	Backend.NotFoundErrorCode = static_cast<int32>(ErrorCodes::GameRecordNotFoundException);
+
+	FAccelByteCloudSaveRecordManagerPtr Manager = MakeShared<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe>(MoveTemp(Backend));
+	Manager->Startup();
+	return Manager;
+}
+
+FAccelByteCloudSaveRecordManagerPtr FAccelByteCloudSaveRecordManager::CreateForUserRecords(GameServerApi::ServerCloudSave& ServerCloudSave
+	, FString const& UserId)
+{
+	FBackend Backend;
+	Backend.GetRecord = [&ServerCloudSave, UserId](FString const& Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return ServerCloudSave.GetUserRecord(Key
+			, UserId
+			, THandler<FAccelByteModelsUserRecord>::CreateLambda(
+				[OnSuccess](FAccelByteModelsUserRecord const& Record)
+				{
+					OnSuccess.ExecuteIfBound(FAccelByteCloudSaveRecordSnapshot{Record.Value.JsonObject, Record.UpdatedAt});
+				})
+			, OnError);
+	};
+	Backend.AppendRecord = [&ServerCloudSave, UserId](FString const& Key
+		, FJsonObject const& Fields
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return ServerCloudSave.SaveUserRecord(Key
+			, UserId
+			, Fields
+			, FVoidHandler::CreateLambda(
+				[OnSuccess]()
+				{
+					OnSuccess.ExecuteIfBound(FAccelByteCloudSaveRecordSnapshot{});
+				})
+			, OnError);
+	};
+	Backend.ReplaceRecord = [&ServerCloudSave, UserId](FString const& Key
+		, FDateTime const& UpdatedAt
+		, FJsonObject const& Value
+		, THandler<FDateTime> const& OnSuccess
+		, FErrorHandler const& OnError)
+	{
+		return ServerCloudSave.ReplaceUserRecord(Key
+			, UserId
+			, Value
+			, FVoidHandler::CreateLambda(
+				[OnSuccess]()
+				{
+					OnSuccess.ExecuteIfBound(FDateTime{0});
+				})
+			, OnError);
+	};
+	Backend.NotFoundErrorCode = static_cast<int32>(ErrorCodes::PlayerRecordNotFoundException);
+
+	FAccelByteCloudSaveRecordManagerPtr Manager = MakeShared<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe>(MoveTemp(Backend));
+	Manager->Startup();
+	return Manager;
+}
+
+FAccelByteCloudSaveRecordManager::FAccelByteCloudSaveRecordManager(FBackend InBackend)
+	: Backend(MoveTemp(InBackend))
+{
+	int32 CoalesceMilliseconds = 500;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.CloudSave"), TEXT("RecordSaveCoalesceMilliseconds"), CoalesceMilliseconds);
+	CoalesceSeconds = FMath::Max(0, CoalesceMilliseconds) / 1000.0;
+}
+
+FAccelByteCloudSaveRecordManager::~FAccelByteCloudSaveRecordManager()
+{
+	Shutdown();
+}
+
+void FAccelByteCloudSaveRecordManager::Startup()
+{
+	if (TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	TWeakPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> ManagerWPtr = AsShared();
+	TickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[ManagerWPtr](float DeltaTime)
+		{
+			const auto ManagerPtr = ManagerWPtr.Pin();
+			return ManagerPtr.IsValid() && ManagerPtr->Tick(DeltaTime);
+		}), 0.1f);
+}
+
+void FAccelByteCloudSaveRecordManager::Shutdown()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+void FAccelByteCloudSaveRecordManager::LoadRecord(FString const& Key
+	, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+	TWeakPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> ManagerWPtr = AsShared();
+	Backend.GetRecord(Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot>::CreateLambda(
+			[ManagerWPtr, Key, OnSuccess](FAccelByteCloudSaveRecordSnapshot const& Snapshot)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (ManagerPtr.IsValid())
+				{
+					ManagerPtr->SetShadow(Key, Snapshot.Value, Snapshot.UpdatedAt);
+				}
+				OnSuccess.ExecuteIfBound(Snapshot);
+			})
+		, OnError);
+}
+
+void FAccelByteCloudSaveRecordManager::SaveRecord(FString const& Key
+	, FJsonObject const& Value
+	, FVoidHandler const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+	if (Key.IsEmpty())
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("Key cannot be empty!"));
+		return;
+	}
+
+	// Game code keeps mutating its save document, the pending value must not share it
+	TSharedPtr<FJsonObject> Pending = CloneJsonObject(Value);
+	const int32 FullSize = GetSerializedSize(Pending);
+
+	FScopeLock ScopeLock(&Lock);
+	FRecordState& State = Records.FindOrAdd(Key);
+	if (!State.Pending.IsValid())
+	{
+		State.PendingDueTime = FPlatformTime::Seconds() + CoalesceSeconds;
+	}
+	State.Pending = Pending;
+	State.PendingOnSuccess.Add(OnSuccess);
+	State.PendingOnError.Add(OnError);
+
+	UploadStats.SaveCount++;
+	UploadStats.FullRecordBytes += FullSize;
+}
+
+void FAccelByteCloudSaveRecordManager::Flush()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (auto& Record : Records)
+		{
+			Record.Value.PendingDueTime = 0.0;
+		}
+	}
+	Tick(0.0f);
+}
+
+void FAccelByteCloudSaveRecordManager::ForgetRecord(FString const& Key)
+{
+	FScopeLock ScopeLock(&Lock);
+	FRecordState* State = Records.Find(Key);
+	if (State != nullptr)
+	{
+		State->Shadow.Reset();
+		State->ShadowUpdatedAt = FDateTime{0};
+	}
+}
+
+FAccelByteCloudSaveUploadStats FAccelByteCloudSaveRecordManager::GetUploadStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return UploadStats;
+}
+
+TSharedRef<FJsonObject> FAccelByteCloudSaveRecordManager::CreateMergePatch(FJsonObject const& Source, FJsonObject const& Target)
+{
+	TSharedRef<FJsonObject> Patch = MakeShared<FJsonObject>();
+	for (auto const& Field : Target.Values)
+	{
+		TSharedPtr<FJsonValue> const* SourceValue = Source.Values.Find(Field.Key);
+		if (SourceValue == nullptr)
+		{
+			Patch->SetField(Field.Key, Field.Value);
+		}
+		else if ((*SourceValue)->Type == EJson::Object && Field.Value->Type == EJson::Object)
+		{
+			TSharedRef<FJsonObject> ObjectPatch = CreateMergePatch(*(*SourceValue)->AsObject(), *Field.Value->AsObject());
+			if (ObjectPatch->Values.Num() > 0)
+			{
+				Patch->SetObjectField(Field.Key, ObjectPatch);
+			}
+		}
+		else if (!JsonValuesEqual(*SourceValue, Field.Value))
+		{
+			Patch->SetField(Field.Key, Field.Value);
+		}
+	}
+
+	for (auto const& Field : Source.Values)
+	{
+		if (!Target.Values.Contains(Field.Key))
+		{
+			Patch->SetField(Field.Key, MakeShared<FJsonValueNull>());
+		}
+	}
+	return Patch;
+}
+
+bool FAccelByteCloudSaveRecordManager::Tick(float DeltaTime)
+{
+	TArray<FString> DueKeys;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const double Now = FPlatformTime::Seconds();
+		for (auto const& Record : Records)
+		{
+			// One write per key at a time, saves made meanwhile are written once it's done
+			if (Record.Value.Pending.IsValid() && !Record.Value.Writing.IsValid() && Record.Value.PendingDueTime <= Now)
+			{
+				DueKeys.Add(Record.Key);
+			}
+		}
+	}
+
+	for (FString const& Key : DueKeys)
+	{
+		StartWrite(Key);
+	}
+	return true;
+}
+
+void FAccelByteCloudSaveRecordManager::StartWrite(FString const& Key)
+{
+	bool bHasShadow = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FRecordState& State = Records.FindOrAdd(Key);
+		State.Writing = MoveTemp(State.Pending);
+		State.Pending.Reset();
+		State.WritingOnSuccess = MoveTemp(State.PendingOnSuccess);
+		State.PendingOnSuccess.Reset();
+		State.WritingOnError = MoveTemp(State.PendingOnError);
+		State.PendingOnError.Reset();
+		bHasShadow = State.Shadow.IsValid();
+	}
+
+	if (bHasShadow)
+	{
+		WriteDelta(Key);
+		return;
+	}
+
+	// Nothing to diff against yet, fetch what the backend has first
+	TWeakPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> ManagerWPtr = AsShared();
+	Backend.GetRecord(Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot>::CreateLambda(
+			[ManagerWPtr, Key](FAccelByteCloudSaveRecordSnapshot const& Snapshot)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (ManagerPtr.IsValid())
+				{
+					ManagerPtr->SetShadow(Key, Snapshot.Value, Snapshot.UpdatedAt);
+					ManagerPtr->WriteDelta(Key);
+				}
+			})
+		, FErrorHandler::CreateLambda(
+			[ManagerWPtr, Key](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (!ManagerPtr.IsValid())
+				{
+					return;
+				}
+
+				if (ErrorCode == ManagerPtr->Backend.NotFoundErrorCode)
+				{
+					ManagerPtr->WriteFull(Key, FDateTime::Now(), true);
+				}
+				else
+				{
+					ManagerPtr->FinishWrite(Key, false, ErrorCode, ErrorMessage);
+				}
+			}));
+}
+
+void FAccelByteCloudSaveRecordManager::WriteDelta(FString const& Key)
+{
+	TSharedPtr<FJsonObject> Shadow;
+	TSharedPtr<FJsonObject> Writing;
+	FDateTime ShadowUpdatedAt{0};
+	{
+		FScopeLock ScopeLock(&Lock);
+		FRecordState& State = Records.FindOrAdd(Key);
+		Shadow = State.Shadow.IsValid() ? State.Shadow : TSharedPtr<FJsonObject>(MakeShared<FJsonObject>());
+		Writing = State.Writing;
+		ShadowUpdatedAt = State.ShadowUpdatedAt;
+	}
+
+	const TSharedRef<FJsonObject> Patch = CreateMergePatch(*Shadow, *Writing);
+	if (Patch->Values.Num() == 0)
+	{
+		FinishWrite(Key, true);
+		return;
+	}
+
+	// The append endpoint merges top level fields only, a changed field is sent with its whole value
+	bool bHasRemovedField = false;
+	TSharedPtr<FJsonObject> Fields = MakeShared<FJsonObject>();
+	for (auto const& Field : Patch->Values)
+	{
+		if (Field.Value->Type == EJson::Null)
+		{
+			bHasRemovedField = true;
+			break;
+		}
+		Fields->SetField(Field.Key, Writing->Values.FindRef(Field.Key));
+	}
+
+	const int32 FieldsSize = GetSerializedSize(Fields);
+	if (bHasRemovedField || FieldsSize >= GetSerializedSize(Writing))
+	{
+		if (Backend.bReplaceChecksUpdatedAt && ShadowUpdatedAt.GetTicks() == 0)
+		{
+			RefetchAndWriteFull(Key);
+		}
+		else
+		{
+			WriteFull(Key, ShadowUpdatedAt, true);
+		}
+		return;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		UploadStats.WriteCount++;
+		UploadStats.DeltaWriteCount++;
+		UploadStats.UploadedBytes += FieldsSize;
+	}
+	UE_LOG(LogAccelByte, Verbose, TEXT("Cloud save record %s: appending %d changed fields, %d bytes"), *Key, Fields->Values.Num(), FieldsSize);
+
+	TWeakPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> ManagerWPtr = AsShared();
+	Backend.AppendRecord(Key
+		, *Fields
+		, THandler<FAccelByteCloudSaveRecordSnapshot>::CreateLambda(
+			[ManagerWPtr, Key, Shadow, Fields](FAccelByteCloudSaveRecordSnapshot const& Snapshot)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (!ManagerPtr.IsValid())
+				{
+					return;
+				}
+
+				TSharedPtr<FJsonObject> Expected = MakeShared<FJsonObject>(*Shadow);
+				for (auto const& Field : Fields->Values)
+				{
+					Expected->SetField(Field.Key, Field.Value);
+				}
+
+				// Anything else that differs was written by someone else since the shadow was taken
+				if (Snapshot.Value.IsValid() && !JsonObjectsEqual(*Snapshot.Value, *Expected))
+				{
+					UE_LOG(LogAccelByte, Warning, TEXT("Cloud save record %s was changed by someone else, replacing it in full"), *Key);
+					{
+						FScopeLock ScopeLock(&ManagerPtr->Lock);
+						ManagerPtr->UploadStats.ConflictCount++;
+					}
+					ManagerPtr->SetShadow(Key, Snapshot.Value, Snapshot.UpdatedAt);
+					ManagerPtr->WriteFull(Key, Snapshot.UpdatedAt, true);
+					return;
+				}
+
+				ManagerPtr->SetShadow(Key, Expected, Snapshot.UpdatedAt);
+				ManagerPtr->FinishWrite(Key, true);
+			})
+		, FErrorHandler::CreateLambda(
+			[ManagerWPtr, Key](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (ManagerPtr.IsValid())
+				{
+					ManagerPtr->FinishWrite(Key, false, ErrorCode, ErrorMessage);
+				}
+			}));
+}
+
+void FAccelByteCloudSaveRecordManager::WriteFull(FString const& Key, FDateTime const& UpdatedAt, bool bRetryOnConflict)
+{
+	TSharedPtr<FJsonObject> Writing;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Writing = Records.FindOrAdd(Key).Writing;
+	}
+
+	const int32 FullSize = GetSerializedSize(Writing);
+	{
+		FScopeLock ScopeLock(&Lock);
+		UploadStats.WriteCount++;
+		UploadStats.UploadedBytes += FullSize;
+	}
+	UE_LOG(LogAccelByte, Verbose, TEXT("Cloud save record %s: replacing in full, %d bytes"), *Key, FullSize);
+
+	TWeakPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> ManagerWPtr = AsShared();
+	Backend.ReplaceRecord(Key
+		, UpdatedAt
+		, *Writing
+		, THandler<FDateTime>::CreateLambda(
+			[ManagerWPtr, Key, Writing](FDateTime const& NewUpdatedAt)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (ManagerPtr.IsValid())
+				{
+					ManagerPtr->SetShadow(Key, Writing, NewUpdatedAt);
+					ManagerPtr->FinishWrite(Key, true);
+				}
+			})
+		, FErrorHandler::CreateLambda(
+			[ManagerWPtr, Key, bRetryOnConflict](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (!ManagerPtr.IsValid())
+				{
+					return;
+				}
+
+				if (bRetryOnConflict && ManagerPtr->Backend.bReplaceChecksUpdatedAt && ErrorCode == ManagerPtr->Backend.ConflictErrorCode)
+				{
+					{
+						FScopeLock ScopeLock(&ManagerPtr->Lock);
+						ManagerPtr->UploadStats.ConflictCount++;
+					}
+					ManagerPtr->RefetchAndWriteFull(Key);
+					return;
+				}
+
+				// The record is in an unknown state, the next save fetches it again
+				ManagerPtr->ForgetRecord(Key);
+				ManagerPtr->FinishWrite(Key, false, ErrorCode, ErrorMessage);
+			}));
+}
+
+void FAccelByteCloudSaveRecordManager::RefetchAndWriteFull(FString const& Key)
+{
+	TWeakPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> ManagerWPtr = AsShared();
+	Backend.GetRecord(Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot>::CreateLambda(
+			[ManagerWPtr, Key](FAccelByteCloudSaveRecordSnapshot const& Snapshot)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (ManagerPtr.IsValid())
+				{
+					ManagerPtr->SetShadow(Key, Snapshot.Value, Snapshot.UpdatedAt);
+					ManagerPtr->WriteFull(Key, Snapshot.UpdatedAt, false);
+				}
+			})
+		, FErrorHandler::CreateLambda(
+			[ManagerWPtr, Key](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				const auto ManagerPtr = ManagerWPtr.Pin();
+				if (!ManagerPtr.IsValid())
+				{
+					return;
+				}
+
+				if (ErrorCode == ManagerPtr->Backend.NotFoundErrorCode)
+				{
+					ManagerPtr->WriteFull(Key, FDateTime::Now(), false);
+				}
+				else
+				{
+					ManagerPtr->FinishWrite(Key, false, ErrorCode, ErrorMessage);
+				}
+			}));
+}
+
+void FAccelByteCloudSaveRecordManager::FinishWrite(FString const& Key, bool bSucceeded, int32 ErrorCode, FString const& ErrorMessage)
+{
+	TArray<FVoidHandler> OnSuccess;
+	TArray<FErrorHandler> OnError;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FRecordState& State = Records.FindOrAdd(Key);
+		State.Writing.Reset();
+		OnSuccess = MoveTemp(State.WritingOnSuccess);
+		State.WritingOnSuccess.Reset();
+		OnError = MoveTemp(State.WritingOnError);
+		State.WritingOnError.Reset();
+	}
+
+	if (bSucceeded)
+	{
+		for (FVoidHandler const& Handler : OnSuccess)
+		{
+			Handler.ExecuteIfBound();
+		}
+	}
+	else
+	{
+		for (FErrorHandler const& Handler : OnError)
+		{
+			Handler.ExecuteIfBound(ErrorCode, ErrorMessage);
+		}
+	}
+}
+
+void FAccelByteCloudSaveRecordManager::SetShadow(FString const& Key, TSharedPtr<FJsonObject> const& Value, FDateTime const& UpdatedAt)
+{
+	FScopeLock ScopeLock(&Lock);
+	FRecordState& State = Records.FindOrAdd(Key);
+	State.Shadow = Value.IsValid() ? Value : TSharedPtr<FJsonObject>(MakeShared<FJsonObject>());
+	State.ShadowUpdatedAt = UpdatedAt;
+}
+
+TSharedPtr<FJsonObject> FAccelByteCloudSaveRecordManager::CloneJsonObject(FJsonObject const& Object)
+{
+	TSharedPtr<FJsonObject> Clone = MakeShared<FJsonObject>();
+	for (auto const& Field : Object.Values)
+	{
+		Clone->SetField(Field.Key, CloneJsonValue(Field.Value));
+	}
+	return Clone;
+}
+
+TSharedPtr<FJsonValue> FAccelByteCloudSaveRecordManager::CloneJsonValue(TSharedPtr<FJsonValue> const& Value)
+{
+	if (!Value.IsValid())
+	{
+		return MakeShared<FJsonValueNull>();
+	}
+
+	switch (Value->Type)
+	{
+	case EJson::Object:
+		return MakeShared<FJsonValueObject>(CloneJsonObject(*Value->AsObject()));
+	case EJson::Array:
+	{
+		TArray<TSharedPtr<FJsonValue>> Elements;
+		for (TSharedPtr<FJsonValue> const& Element : Value->AsArray())
+		{
+			Elements.Add(CloneJsonValue(Element));
+		}
+		return MakeShared<FJsonValueArray>(Elements);
+	}
+	default:
+		// Scalars are never modified in place
+		return Value;
+	}
+}
+
+bool FAccelByteCloudSaveRecordManager::JsonObjectsEqual(FJsonObject const& Lhs, FJsonObject const& Rhs)
+{
+	if (Lhs.Values.Num() != Rhs.Values.Num())
+	{
+		return false;
+	}
+
+	for (auto const& Field : Lhs.Values)
+	{
+		TSharedPtr<FJsonValue> const* RhsValue = Rhs.Values.Find(Field.Key);
+		if (RhsValue == nullptr || !JsonValuesEqual(Field.Value, *RhsValue))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FAccelByteCloudSaveRecordManager::JsonValuesEqual(TSharedPtr<FJsonValue> const& Lhs, TSharedPtr<FJsonValue> const& Rhs)
+{
+	if (!Lhs.IsValid() || !Rhs.IsValid())
+	{
+		return Lhs.IsValid() == Rhs.IsValid();
+	}
+	if (Lhs->Type != Rhs->Type)
+	{
+		return false;
+	}
+
+	switch (Lhs->Type)
+	{
+	case EJson::String:
+		return Lhs->AsString().Equals(Rhs->AsString(), ESearchCase::CaseSensitive);
+	case EJson::Number:
+		return Lhs->AsNumber() == Rhs->AsNumber();
+	case EJson::Boolean:
+		return Lhs->AsBool() == Rhs->AsBool();
+	case EJson::Object:
+		return JsonObjectsEqual(*Lhs->AsObject(), *Rhs->AsObject());
+	case EJson::Array:
+	{
+		TArray<TSharedPtr<FJsonValue>> const& LhsArray = Lhs->AsArray();
+		TArray<TSharedPtr<FJsonValue>> const& RhsArray = Rhs->AsArray();
+		if (LhsArray.Num() != RhsArray.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < LhsArray.Num(); Index++)
+		{
+			if (!JsonValuesEqual(LhsArray[Index], RhsArray[Index]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return true;
+	}
+}
+
+int32 FAccelByteCloudSaveRecordManager::GetSerializedSize(TSharedPtr<FJsonObject> const& Object)
+{
+	if (!Object.IsValid())
+	{
+		return 0;
+	}
+
+	FString Content;
+	FJsonSerializer::Serialize(Object.ToSharedRef(), TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Content));
+	return FTCHARToUTF8(*Content).Length();
+}
+
+}
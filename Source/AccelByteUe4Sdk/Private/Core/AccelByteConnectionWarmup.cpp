@@ -0,0 +1,393 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteConnectionWarmup.h"
+#include "Async/Async.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "SocketSubsystem.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteSettings.h"
+#include "Core/AccelByteServerSettings.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+void FAccelByteConnectionWarmup::LoadConfig()
+{
+	bool bConfigEnabled = false;
+	int32 ConfigKeepAliveSeconds = static_cast<int32>(KeepAliveIntervalSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("bEnableConnectionWarmup"), bConfigEnabled);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("ConnectionKeepAliveSeconds"), ConfigKeepAliveSeconds);
+
+	FScopeLock ScopeLock(&Lock);
+	bIsEnabled = bConfigEnabled;
+	KeepAliveIntervalSeconds = static_cast<float>(FMath::Max(0, ConfigKeepAliveSeconds));
+}
+
+void FAccelByteConnectionWarmup::Warmup(TArray<FString> const& Urls)
+{
+	// A host is sent the warmup request when at least one of its URLs is served over HTTP
+	TMap<FString, bool> Hosts;
+	for (FString const& Url : Urls)
+	{
+		const FString HostUrl = GetHostUrl(Url);
+		if (HostUrl.IsEmpty())
+		{
+			continue;
+		}
+
+		const bool bIsHttpUrl = !Url.StartsWith(TEXT("ws"), ESearchCase::IgnoreCase);
+		bool& bIsHttpHost = Hosts.FindOrAdd(HostUrl, false);
+		bIsHttpHost = bIsHttpHost || bIsHttpUrl;
+	}
+
+	TArray<TPair<FString, bool>> NewHosts;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bIsShuttingDown = false;
+
+		// Hosts of a previous environment are not kept alive anymore
+		for (auto It = Stats.CreateIterator(); It; ++It)
+		{
+			if (!Hosts.Contains(It.Key()))
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		for (auto const& Host : Hosts)
+		{
+			if (Stats.Contains(Host.Key))
+			{
+				continue;
+			}
+
+			FAccelByteHostWarmupStats& HostStats = Stats.Add(Host.Key);
+			HostStats.Host = Host.Key;
+			NewHosts.Emplace(Host.Key, Host.Value);
+		}
+		PendingHostCount += NewHosts.Num();
+	}
+
+	for (auto const& Host : NewHosts)
+	{
+		Resolve(Host.Key, Host.Value);
+	}
+}
+
+void FAccelByteConnectionWarmup::Shutdown()
+{
+	if (KeepAliveHandle.IsValid())
+	{
+		FRegistry::PeriodicTaskScheduler.RemoveTask(KeepAliveHandle);
+	}
+
+	TArray<FHttpRequestPtr> Requests;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bIsShuttingDown = true;
+		PendingHostCount = 0;
+		InFlightRequests.GenerateValueArray(Requests);
+		InFlightRequests.Empty();
+	}
+
+	for (FHttpRequestPtr const& Request : Requests)
+	{
+		if (Request.IsValid())
+		{
+			Request->CancelRequest();
+		}
+	}
+}
+
+TArray<FAccelByteHostWarmupStats> FAccelByteConnectionWarmup::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<FAccelByteHostWarmupStats> Result;
+	Stats.GenerateValueArray(Result);
+	return Result;
+}
+
+TArray<FString> FAccelByteConnectionWarmup::GetServiceUrls(Settings const& InSettings)
+{
+	return {
+		InSettings.BaseUrl,
+		InSettings.IamServerUrl,
+		InSettings.BasicServerUrl,
+		InSettings.PlatformServerUrl,
+		InSettings.LobbyServerUrl,
+		InSettings.ChatServerUrl,
+		InSettings.SessionServerUrl,
+		InSettings.MatchmakingV2ServerUrl,
+		InSettings.LoginQueueServerUrl,
+		InSettings.StatisticServerUrl,
+		InSettings.CloudSaveServerUrl,
+		InSettings.GameTelemetryServerUrl,
+		InSettings.QosManagerServerUrl,
+	};
+}
+
+TArray<FString> FAccelByteConnectionWarmup::GetServiceUrls(ServerSettings const& InSettings)
+{
+	// The AMS watchdog runs next to the server, there is nothing to warm
+	return {
+		InSettings.BaseUrl,
+		InSettings.IamServerUrl,
+		InSettings.BasicServerUrl,
+		InSettings.PlatformServerUrl,
+		InSettings.DSHubServerUrl,
+		InSettings.SessionServerUrl,
+		InSettings.MatchmakingV2ServerUrl,
+		InSettings.StatisticServerUrl,
+		InSettings.CloudSaveServerUrl,
+		InSettings.GameTelemetryServerUrl,
+		InSettings.QosManagerServerUrl,
+	};
+}
+
+FString FAccelByteConnectionWarmup::GetHostUrl(FString const& Url)
+{
+	const int32 SchemeEnd = Url.Find(TEXT("://"));
+	if (SchemeEnd == INDEX_NONE)
+	{
+		return FString();
+	}
+
+	FString Scheme = Url.Left(SchemeEnd).ToLower();
+	if (Scheme == TEXT("wss"))
+	{
+		Scheme = TEXT("https");
+	}
+	else if (Scheme == TEXT("ws"))
+	{
+		Scheme = TEXT("http");
+	}
+	else if (Scheme != TEXT("https") && Scheme != TEXT("http"))
+	{
+		return FString();
+	}
+
+	FString Host = Url.RightChop(SchemeEnd + 3);
+	int32 HostEnd = INDEX_NONE;
+	if (Host.FindChar(TEXT('/'), HostEnd))
+	{
+		Host.LeftInline(HostEnd);
+	}
+	if (Host.FindChar(TEXT('?'), HostEnd))
+	{
+		Host.LeftInline(HostEnd);
+	}
+
+	if (Host.IsEmpty())
+	{
+		return FString();
+	}
+	return Scheme + TEXT("://") + Host.ToLower();
+}
+
+FString FAccelByteConnectionWarmup::GetHostName(FString const& HostUrl)
+{
+	FString Host = HostUrl;
+	const int32 SchemeEnd = Host.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		Host.RightChopInline(SchemeEnd + 3);
+	}
+
+	// IPv6 literal, e.g. "[::1]:8080"
+	if (Host.StartsWith(TEXT("[")))
+	{
+		int32 BracketEnd = INDEX_NONE;
+		return Host.FindChar(TEXT(']'), BracketEnd) ? Host.Mid(1, BracketEnd - 1) : Host;
+	}
+
+	int32 PortStart = INDEX_NONE;
+	if (Host.FindLastChar(TEXT(':'), PortStart))
+	{
+		Host.LeftInline(PortStart);
+	}
+	return Host;
+}
+
+void FAccelByteConnectionWarmup::Resolve(FString const& HostUrl, bool bIsHttpHost)
+{
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, HostUrl, bIsHttpHost]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		bool bIsResolved = false;
+		ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (SocketSubsystem != nullptr)
+		{
+			FAddressInfoResult AddressInfo = SocketSubsystem->GetAddressInfo(*GetHostName(HostUrl)
+				, nullptr
+				, EAddressInfoFlags::Default
+				, NAME_None);
+			bIsResolved = AddressInfo.ReturnCode == SE_NO_ERROR && AddressInfo.Results.Num() > 0;
+		}
+		const double DnsSeconds = FPlatformTime::Seconds() - StartTime;
+
+		bool bIsCancelled = false;
+		{
+			FScopeLock ScopeLock(&Lock);
+			bIsCancelled = bIsShuttingDown;
+			FAccelByteHostWarmupStats* HostStats = Stats.Find(HostUrl);
+			if (HostStats != nullptr)
+			{
+				HostStats->bIsResolved = bIsResolved;
+				HostStats->DnsSeconds = DnsSeconds;
+			}
+		}
+
+		if (bIsResolved)
+		{
+			FRegistry::MetricsRegistry.RecordLatency(TEXT("Warmup.Dns"), DnsSeconds * 1000.0);
+		}
+		else
+		{
+			UE_LOG(LogAccelByte, Warning, TEXT("Connection warmup couldn't resolve %s"), *HostUrl);
+		}
+
+		const bool bIsRequestNeeded = bIsResolved && bIsHttpHost && !bIsCancelled;
+		AsyncTask(ENamedThreads::GameThread, [this, HostUrl, bIsRequestNeeded]()
+		{
+			if (bIsRequestNeeded)
+			{
+				SendWarmupRequest(HostUrl, false);
+			}
+			else
+			{
+				OnHostDone();
+			}
+		});
+	});
+}
+
+void FAccelByteConnectionWarmup::SendWarmupRequest(FString const& HostUrl, bool bIsKeepAlive)
+{
+	// Any answer, even an error status, means the connection is open and pooled
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb(TEXT("HEAD"));
+	Request->SetURL(HostUrl + TEXT("/"));
+
+	const double StartTime = FPlatformTime::Seconds();
+	Request->OnProcessRequestComplete().BindLambda(
+		[this, HostUrl, bIsKeepAlive, StartTime](FHttpRequestPtr, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+			const bool bIsConnected = bConnectedSuccessfully && Response.IsValid();
+
+			bool bIsCancelled = false;
+			{
+				FScopeLock ScopeLock(&Lock);
+				InFlightRequests.Remove(HostUrl);
+				bIsCancelled = bIsShuttingDown;
+				FAccelByteHostWarmupStats* HostStats = Stats.Find(HostUrl);
+				if (HostStats != nullptr && !bIsCancelled)
+				{
+					HostStats->RequestCount++;
+					HostStats->bIsConnected = bIsConnected;
+					if (bIsConnected && bIsKeepAlive)
+					{
+						HostStats->KeepAliveSeconds = Seconds;
+					}
+					else if (bIsConnected)
+					{
+						HostStats->ConnectSeconds = Seconds;
+					}
+				}
+			}
+
+			if (bIsCancelled)
+			{
+				return;
+			}
+
+			if (bIsConnected)
+			{
+				FRegistry::MetricsRegistry.RecordLatency(bIsKeepAlive ? TEXT("Warmup.KeepAlive") : TEXT("Warmup.Connect"), Seconds * 1000.0);
+			}
+			else
+			{
+				UE_LOG(LogAccelByte, Warning, TEXT("Connection warmup couldn't connect to %s"), *HostUrl);
+			}
+
+			if (!bIsKeepAlive)
+			{
+				OnHostDone();
+			}
+		});
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bIsShuttingDown)
+		{
+			return;
+		}
+		InFlightRequests.Emplace(HostUrl, Request);
+	}
+	Request->ProcessRequest();
+}
+
+void FAccelByteConnectionWarmup::OnHostDone()
+{
+	TArray<FAccelByteHostWarmupStats> Result;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bIsShuttingDown || PendingHostCount <= 0)
+		{
+			return;
+		}
+
+		PendingHostCount--;
+		if (PendingHostCount > 0)
+		{
+			return;
+		}
+		Stats.GenerateValueArray(Result);
+	}
+
+	for (FAccelByteHostWarmupStats const& HostStats : Result)
+	{
+		UE_LOG(LogAccelByte, Log, TEXT("Connection warmup of %s: DNS %.0f ms, connect %.0f ms")
+			, *HostStats.Host
+			, HostStats.DnsSeconds * 1000.0
+			, HostStats.ConnectSeconds * 1000.0);
+	}
+
+	if (KeepAliveIntervalSeconds > 0.0f && !KeepAliveHandle.IsValid())
+	{
+		KeepAliveHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("ConnectionKeepAlive")
+			, FTickerDelegate::CreateRaw(this, &FAccelByteConnectionWarmup::KeepAlive)
+			, KeepAliveIntervalSeconds);
+	}
+
+	WarmupComplete.Broadcast(Result);
+}
+
+bool FAccelByteConnectionWarmup::KeepAlive(float DeltaTime)
+{
+	TArray<FString> Hosts;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (auto const& Pair : Stats)
+		{
+			if (Pair.Value.bIsConnected && !InFlightRequests.Contains(Pair.Key))
+			{
+				Hosts.Add(Pair.Key);
+			}
+		}
+	}
+
+	for (FString const& Host : Hosts)
+	{
+		SendWarmupRequest(Host, true);
+	}
+	return true;
+}
+
+}
@@ -49,6 +49,10 @@ void Credentials::ForgetAll()
 {
 	BaseCredentials::ForgetAll();
 	AuthToken = {};
+	FRegistry::TokenRefreshScheduler.Unschedule(this);
+
+	// Logging out, the next login reads the identifiers from the storage again
+	FRegistry::DeviceIdentity.Invalidate();
 }
 
 void Credentials::SetClientCredentials(const ESettingsEnvironment Environment)
@@ -132,6 +136,7 @@ void Credentials::SetAuthToken(const FOauth2Token& NewAuthToken, float CurrentTi
 	AuthToken = NewAuthToken;
 	BackoffCount = 0;
 	SessionState = ESessionState::Valid;
+	FRegistry::TokenRefreshScheduler.Schedule(AsShared(), RefreshTime);
 
 	auto MessagingSystemPtr = MessagingSystemWPtr.Pin();
 
@@ -211,29 +216,13 @@ bool Credentials::IsComply() const
 
 void Credentials::Startup()
 {
-	PollRefreshTokenHandle = FTickerAlias::GetCoreTicker().AddTicker(
-        FTickerDelegate::CreateLambda([this](float DeltaTime)
-        {
-            PollRefreshToken(FPlatformTime::Seconds());
-
-            return true;
-        }),
-        0.2f);
 	IAccelByteUe4SdkModuleInterface& ABSDKModule = IAccelByteUe4SdkModuleInterface::Get();
 	SetClientCredentials(ABSDKModule.GetSettingsEnvironment());
 }
 
 void Credentials::Shutdown()
 {
-	if (PollRefreshTokenHandle.IsValid())
-	{
-		// Core ticker by this point in engine shutdown has already been torn down - only remove ticker if this is not an engine shutdown
-		if (!IsEngineExitRequested())
-		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(PollRefreshTokenHandle);
-		}
-		PollRefreshTokenHandle.Reset();
-	}
+	FRegistry::TokenRefreshScheduler.Unschedule(this);
 }
 
 const FString& Credentials::GetUserId() const
@@ -295,6 +284,7 @@ void Credentials::PollRefreshToken(double CurrentTime)
 				, AuthToken.Refresh_token
 				, THandler<FOauth2Token>::CreateLambda([this](const FOauth2Token& Result)
 				{
+					FRegistry::TokenRefreshScheduler.NotifyRefreshFinished(this);
 					SetAuthToken(Result, FPlatformTime::Seconds());
 					if (RefreshTokenAdditionalActions.IsBound()) 
 					{
@@ -305,6 +295,7 @@ void Credentials::PollRefreshToken(double CurrentTime)
 				})
 				, FErrorHandler::CreateLambda([this](int32 ErrorCode, const FString& ErrorMessage)
 				{
+					FRegistry::TokenRefreshScheduler.NotifyRefreshFinished(this);
 					BackoffCount++;
 
 					if (BackoffCount < MaxBackoffCount)
@@ -357,6 +348,7 @@ void Credentials::PollRefreshToken(double CurrentTime)
 void Credentials::ScheduleRefreshToken(double LRefreshTime)
 {
 	RefreshTime = LRefreshTime;
+	FRegistry::TokenRefreshScheduler.Schedule(AsShared(), RefreshTime);
 }
 
 const FOauth2Token& Credentials::GetAuthToken() const
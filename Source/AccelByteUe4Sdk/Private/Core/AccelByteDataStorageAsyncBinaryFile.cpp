@@ -0,0 +1,485 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteDataStorageAsyncBinaryFile.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteUtilities.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteDataStorageAsyncBinaryFile, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteDataStorageAsyncBinaryFile);
+
+namespace AccelByte
+{
+
+namespace
+{
+	const FString QueueWaitLatencyName = TEXT("DataStorage.QueueWait");
+	const FString WriteLatencyName = TEXT("DataStorage.Write");
+	const FString ReadLatencyName = TEXT("DataStorage.Read");
+}
+
+DataStorageAsyncBinaryFile::DataStorageAsyncBinaryFile(FString DirectoryPath)
+	: DataStorageBinaryFile(DirectoryPath)
+{
+	int32 WriteCoalesceDelayMs = 50;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.DataStorage"), TEXT("WriteCoalesceDelayMs"), WriteCoalesceDelayMs);
+	WriteCoalesceDelaySeconds = FMath::Max(0, WriteCoalesceDelayMs) / 1000.0;
+
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		FlushedEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("AccelByteDataStorageIO"), 0, TPri_BelowNormal);
+	}
+
+	if (Thread == nullptr)
+	{
+		UE_LOG(LogAccelByteDataStorageAsyncBinaryFile, Warning, TEXT("I/O thread not available, files are read and written on the calling thread"));
+	}
+}
+
+DataStorageAsyncBinaryFile::~DataStorageAsyncBinaryFile()
+{
+	if (Thread != nullptr)
+	{
+		// Kill calls Stop and waits for Run to return, which loads and writes whatever is still pending
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	else
+	{
+		for (FCompletion const& Completion : LoadPendingFiles())
+		{
+			Completion();
+		}
+		WritePendingFiles();
+	}
+
+	if (WorkEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+	if (FlushedEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(FlushedEvent);
+		FlushedEvent = nullptr;
+	}
+}
+
+void DataStorageAsyncBinaryFile::Reset(const THandler<bool>& Result, const FString& FileName)
+{
+	Execute(FileName, [this, Result](FFileMirror& Mirror) -> FCompletion
+		{
+			Mirror.Structure = MakeShared<FABBinaryFileStructure>();
+			MarkDirty(Mirror);
+			return [Result]() { Result.ExecuteIfBound(true); };
+		});
+}
+
+void DataStorageAsyncBinaryFile::DeleteItem(const FString& Key, const FVoidHandler OnDone, const FString& FileName)
+{
+	Execute(FileName, [this, Key, OnDone](FFileMirror& Mirror) -> FCompletion
+		{
+			if (Mirror.Structure->RemoveAll([&Key](FBinaryContentIndependentSegment const& Segment) { return Segment.Key == Key; }) > 0)
+			{
+				MarkDirty(Mirror);
+			}
+			return [OnDone]() { OnDone.ExecuteIfBound(); };
+		});
+}
+
+void DataStorageAsyncBinaryFile::SaveItemOverwiteEntireFile(const FString& Key, const FString& Item, const THandler<bool>& OnDone, const FString& FileName)
+{
+	Execute(FileName, [this, Key, Bytes = FAccelByteArrayByteFStringConverter::FStringToBytes(Item), OnDone](FFileMirror& Mirror) -> FCompletion
+		{
+			Mirror.Structure = MakeShared<FABBinaryFileStructure>();
+			Mirror.Structure->Add({ Key, Bytes });
+			MarkDirty(Mirror);
+			return [OnDone]() { OnDone.ExecuteIfBound(true); };
+		});
+}
+
+void DataStorageAsyncBinaryFile::SaveItem(const FString& Key, const TArray<uint8>& Item, const THandler<bool>& OnDone, const FString& FileName)
+{
+	Execute(FileName, [this, Key, Item, OnDone](FFileMirror& Mirror) -> FCompletion
+		{
+			FBinaryContentIndependentSegment* SegmentPtr = Mirror.Structure->FindByPredicate([&Key](FBinaryContentIndependentSegment const& Segment) { return Segment.Key == Key; });
+			if (SegmentPtr == nullptr)
+			{
+				Mirror.Structure->Add({ Key, Item });
+			}
+			else
+			{
+				SegmentPtr->ArrayByte = Item;
+			}
+			MarkDirty(Mirror);
+			return [OnDone]() { OnDone.ExecuteIfBound(true); };
+		});
+}
+
+void DataStorageAsyncBinaryFile::SaveItem(const FString& Key, const FString& Item, const THandler<bool>& OnDone, const FString& FileName)
+{
+	SaveItem(Key, FAccelByteArrayByteFStringConverter::FStringToBytes(Item), OnDone, FileName);
+}
+
+void DataStorageAsyncBinaryFile::SaveItem(const FString& Key, const FJsonObjectWrapper& Item, const THandler<bool>& OnDone, const FString& FileName)
+{
+	FString ItemAsString = Item.JsonString;
+	if (Item.JsonString.IsEmpty() && !Item.JsonObjectToString(ItemAsString))
+	{
+		OnDone.ExecuteIfBound(false);
+		return;
+	}
+
+	SaveItem(Key, ItemAsString, OnDone, FileName);
+}
+
+void DataStorageAsyncBinaryFile::GetItem(const FString& Key, const THandler<TPair<FString, TArray<uint8>>>& OnDone, const FString& FileName)
+{
+	Execute(FileName, [Key, OnDone](FFileMirror& Mirror) -> FCompletion
+		{
+			TPair<FString, TArray<uint8>> Result;
+			FBinaryContentIndependentSegment const* Segment = FindSegment(Mirror, Key);
+			if (Segment != nullptr)
+			{
+				Result.Key = Key;
+				Result.Value = Segment->ArrayByte;
+			}
+			return [OnDone, Result]() { OnDone.ExecuteIfBound(Result); };
+		});
+}
+
+void DataStorageAsyncBinaryFile::GetItem(const FString& Key, const THandler<TPair<FString, FString>>& OnDone, const FString& FileName)
+{
+	GetItem(Key, THandler<TPair<FString, TArray<uint8>>>::CreateLambda(
+		[OnDone](TPair<FString, TArray<uint8>> const& Item)
+		{
+			TPair<FString, FString> Result;
+			if (Item.Value.Num() > 0)
+			{
+				Result.Key = Item.Key;
+				Result.Value = FAccelByteArrayByteFStringConverter::BytesToFString(Item.Value, false);
+			}
+			OnDone.ExecuteIfBound(Result);
+		}), FileName);
+}
+
+void DataStorageAsyncBinaryFile::GetItem(const FString& Key, const THandler<TPair<FString, FJsonObjectWrapper>>& OnDone, const FString& FileName)
+{
+	GetItem(Key, THandler<TPair<FString, TArray<uint8>>>::CreateLambda(
+		[OnDone](TPair<FString, TArray<uint8>> const& Item)
+		{
+			TPair<FString, FJsonObjectWrapper> Result;
+			if (Item.Value.Num() > 0)
+			{
+				Result.Key = Item.Key;
+				Result.Value.JsonObjectFromString(FAccelByteArrayByteFStringConverter::BytesToFString(Item.Value, false));
+			}
+			OnDone.ExecuteIfBound(Result);
+		}), FileName);
+}
+
+bool DataStorageAsyncBinaryFile::Flush()
+{
+	if (Thread == nullptr)
+	{
+		return WritePendingFiles();
+	}
+
+	int64 TargetFlushCount = 0;
+	{
+		FScopeLock ScopeLock(&MirrorLock);
+		TargetFlushCount = ++RequestedFlushCount;
+	}
+	WorkEvent->Trigger();
+
+	while (true)
+	{
+		{
+			FScopeLock ScopeLock(&MirrorLock);
+			if (CompletedFlushCount >= TargetFlushCount)
+			{
+				return bLastFlushSucceeded;
+			}
+		}
+		FlushedEvent->Wait(10);
+	}
+}
+
+int32 DataStorageAsyncBinaryFile::GetQueueDepth() const
+{
+	FScopeLock ScopeLock(&MirrorLock);
+	return QueueDepth;
+}
+
+uint32 DataStorageAsyncBinaryFile::Run()
+{
+	while (!bStopRequested)
+	{
+		WorkEvent->Wait();
+		LoadPendingFilesOnIOThread();
+
+		// Give the burst some time to settle so that it's written once, unless someone is waiting for it. Loads don't
+		// wait, their operations are pending until then
+		const double CoalesceEndTime = FPlatformTime::Seconds() + WriteCoalesceDelaySeconds;
+		while (!bStopRequested && !IsFlushRequested() && FPlatformTime::Seconds() < CoalesceEndTime)
+		{
+			FPlatformProcess::Sleep(0.005f);
+			LoadPendingFilesOnIOThread();
+		}
+
+		// A flush also covers the writes waiting for their file to be loaded
+		LoadPendingFilesOnIOThread();
+		WritePendingFiles();
+	}
+
+	LoadPendingFilesOnIOThread();
+	WritePendingFiles();
+	return 0;
+}
+
+void DataStorageAsyncBinaryFile::Stop()
+{
+	bStopRequested = true;
+	WorkEvent->Trigger();
+}
+
+bool DataStorageAsyncBinaryFile::IsFileExist(const FString& FileName)
+{
+	{
+		FScopeLock ScopeLock(&MirrorLock);
+		FFileMirror const* Mirror = Mirrors.Find(FileName);
+		if (Mirror != nullptr && Mirror->bWritten)
+		{
+			return true;
+		}
+	}
+	return DataStorageBinaryFile::IsFileExist(FileName);
+}
+
+void DataStorageAsyncBinaryFile::Execute(const FString& FileName, FMirrorOperation&& Operation)
+{
+	FCompletion Completion;
+	{
+		FScopeLock ScopeLock(&MirrorLock);
+		FFileMirror& Mirror = Mirrors.FindOrAdd(FileName);
+		if (Mirror.Structure.IsValid())
+		{
+			Completion = Operation(Mirror);
+		}
+		else
+		{
+			if (!Mirror.bIsLoadQueued)
+			{
+				Mirror.bIsLoadQueued = true;
+				FilesToLoad.Add(FileName);
+			}
+			Mirror.PendingOperations.Add(MoveTemp(Operation));
+		}
+	}
+
+	if (Completion)
+	{
+		Completion();
+	}
+	else if (Thread != nullptr)
+	{
+		WorkEvent->Trigger();
+	}
+	else
+	{
+		for (FCompletion const& LoadedCompletion : LoadPendingFiles())
+		{
+			LoadedCompletion();
+		}
+	}
+}
+
+void DataStorageAsyncBinaryFile::Preload(const FString& FileName)
+{
+	{
+		FScopeLock ScopeLock(&MirrorLock);
+		FFileMirror& Mirror = Mirrors.FindOrAdd(FileName);
+		if (Mirror.Structure.IsValid() || Mirror.bIsLoadQueued)
+		{
+			return;
+		}
+		Mirror.bIsLoadQueued = true;
+		FilesToLoad.Add(FileName);
+	}
+
+	if (Thread != nullptr)
+	{
+		WorkEvent->Trigger();
+	}
+	else
+	{
+		LoadPendingFiles();
+	}
+}
+
+FBinaryContentIndependentSegment const* DataStorageAsyncBinaryFile::FindSegment(FFileMirror const& Mirror, const FString& Key)
+{
+	FBinaryContentIndependentSegment const* Found = Mirror.Structure->FindByPredicate([&Key](FBinaryContentIndependentSegment const& Segment) { return Segment.Key == Key; });
+	return Found != nullptr && Found->ArrayByte.Num() > 0 ? Found : nullptr;
+}
+
+TArray<DataStorageAsyncBinaryFile::FCompletion> DataStorageAsyncBinaryFile::LoadPendingFiles()
+{
+	TArray<FCompletion> Completions;
+	while (true)
+	{
+		FString FileName;
+		{
+			FScopeLock ScopeLock(&MirrorLock);
+			if (FilesToLoad.Num() == 0)
+			{
+				break;
+			}
+			FileName = FilesToLoad[0];
+			FilesToLoad.RemoveAt(0);
+		}
+
+		// Disk access is done outside of the lock, the operations on the other files aren't held up
+		const double ReadStartTime = FPlatformTime::Seconds();
+		TSharedPtr<FABBinaryFileStructure> Structure = DataStorageBinaryFile::ParseStructureFromFile(FileName);
+		if (!Structure.IsValid())
+		{
+			Structure = MakeShared<FABBinaryFileStructure>();
+		}
+		FRegistry::MetricsRegistry.RecordLatency(ReadLatencyName, (FPlatformTime::Seconds() - ReadStartTime) * 1000.0);
+
+		FScopeLock ScopeLock(&MirrorLock);
+		FFileMirror& Mirror = Mirrors.FindOrAdd(FileName);
+		Mirror.Structure = Structure;
+		Mirror.bIsLoadQueued = false;
+		for (FMirrorOperation& Operation : Mirror.PendingOperations)
+		{
+			Completions.Add(Operation(Mirror));
+		}
+		Mirror.PendingOperations.Empty();
+	}
+	return Completions;
+}
+
+void DataStorageAsyncBinaryFile::LoadPendingFilesOnIOThread()
+{
+	TArray<FCompletion> Completions = LoadPendingFiles();
+	if (Completions.Num() == 0)
+	{
+		return;
+	}
+
+	// Handlers are called where they would have been called by the synchronous storage
+	AsyncTask(ENamedThreads::GameThread, [Completions = MoveTemp(Completions)]()
+		{
+			for (FCompletion const& Completion : Completions)
+			{
+				Completion();
+			}
+		});
+}
+
+void DataStorageAsyncBinaryFile::MarkDirty(FFileMirror& Mirror)
+{
+	Mirror.bWritten = true;
+	if (Mirror.bDirty)
+	{
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemDataStorage, TEXT("WritesCoalesced"));
+		return;
+	}
+
+	Mirror.bDirty = true;
+	Mirror.DirtySince = FPlatformTime::Seconds();
+	QueueDepth++;
+	FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemDataStorage, TEXT("WritesQueued"));
+
+	if (Thread != nullptr)
+	{
+		WorkEvent->Trigger();
+	}
+	else
+	{
+		WritePendingFiles();
+	}
+}
+
+bool DataStorageAsyncBinaryFile::IsFlushRequested() const
+{
+	FScopeLock ScopeLock(&MirrorLock);
+	return RequestedFlushCount > CompletedFlushCount;
+}
+
+bool DataStorageAsyncBinaryFile::WritePendingFiles()
+{
+	TArray<TPair<FString, FABBinaryFileStructure>> PendingFiles;
+	int64 TargetFlushCount = 0;
+	{
+		FScopeLock ScopeLock(&MirrorLock);
+		TargetFlushCount = RequestedFlushCount;
+
+		const double Now = FPlatformTime::Seconds();
+		for (auto& Entry : Mirrors)
+		{
+			if (!Entry.Value.bDirty)
+			{
+				continue;
+			}
+			PendingFiles.Emplace(Entry.Key, *Entry.Value.Structure);
+			FRegistry::MetricsRegistry.RecordLatency(QueueWaitLatencyName, (Now - Entry.Value.DirtySince) * 1000.0);
+			Entry.Value.bDirty = false;
+		}
+		QueueDepth = 0;
+	}
+
+	// Serialization and disk access are done outside of the lock, readers and writers only ever wait for the mirror
+	bool bAllSucceeded = true;
+	for (auto& PendingFile : PendingFiles)
+	{
+		const double WriteStartTime = FPlatformTime::Seconds();
+
+		FString SerializedText = FABBinaryFileStructureToString(&PendingFile.Value);
+		TArray<uint8> ByteArray = FAccelByteArrayByteFStringConverter::FStringToBytes(SerializedText);
+		const bool bSuccess = FFileHelper::SaveArrayToFile(ByteArray, *CompleteAbsoluteFilePath(PendingFile.Key));
+
+		FRegistry::MetricsRegistry.RecordLatency(WriteLatencyName, (FPlatformTime::Seconds() - WriteStartTime) * 1000.0);
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemDataStorage, bSuccess ? TEXT("FileWrites") : TEXT("FileWriteFailures"));
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogAccelByteDataStorageAsyncBinaryFile, Warning, TEXT("Failed to write %s, it will be retried on the next write"), *PendingFile.Key);
+			bAllSucceeded = false;
+
+			FScopeLock ScopeLock(&MirrorLock);
+			FFileMirror* Mirror = Mirrors.Find(PendingFile.Key);
+			if (Mirror != nullptr && !Mirror->bDirty)
+			{
+				Mirror->bDirty = true;
+				Mirror->DirtySince = WriteStartTime;
+				QueueDepth++;
+			}
+		}
+	}
+
+	{
+		FScopeLock ScopeLock(&MirrorLock);
+		CompletedFlushCount = FMath::Max(CompletedFlushCount, TargetFlushCount);
+		bLastFlushSucceeded = bAllSucceeded;
+	}
+	if (FlushedEvent != nullptr)
+	{
+		FlushedEvent->Trigger();
+	}
+
+	return bAllSucceeded;
+}
+
+}
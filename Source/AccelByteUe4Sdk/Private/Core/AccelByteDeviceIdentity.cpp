@@ -0,0 +1,144 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteDeviceIdentity.h"
+#include "Async/Async.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeLock.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteUtilities.h"
+#include "AccelByteUe4SdkModule.h"
+
+namespace AccelByte
+{
+
+void FAccelByteDeviceIdentity::Prefetch()
+{
+	// The DeviceID and the AuthTrustId are read from the local data storage and the platform storage, which are only
+	// accessed from the game thread, so the identifiers are computed there once the current startup work is done.
+	// The stored DeviceID is read first, so an asynchronous storage has loaded it when the identifiers are computed.
+	AsyncTask(ENamedThreads::GameThread, [this]()
+		{
+			IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->GetItem(FAccelByteUtilities::AccelByteStoredKeyDeviceId()
+				, THandler<TPair<FString, FString>>::CreateLambda([this](TPair<FString, FString> const&)
+					{
+						GetFlightId();
+						GetPlatformName();
+						GetAuthTrustId();
+						GetDeviceId(true);
+					})
+				, FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+		});
+}
+
+FString FAccelByteDeviceIdentity::GetDeviceId(bool bEncoded)
+{
+	FScopeLock ScopeLock(&DeviceIdLock);
+
+	if (!bDeviceIdCached)
+	{
+		PlainDeviceId = FAccelByteUtilities::ComputeDeviceId();
+		bIsClientDevMode = FAccelByteUtilities::IsRunningDevMode() && !IsRunningDedicatedServer();
+		EncodedDeviceId.Empty();
+		EncodedDeviceIdKey.Empty();
+		bDeviceIdCached = true;
+	}
+
+	if (!bEncoded && bIsClientDevMode)
+	{
+		return PlainDeviceId;
+	}
+
+	FString const Key = FRegistry::Settings.PublisherNamespace;
+	if (EncodedDeviceId.IsEmpty() || EncodedDeviceIdKey != Key)
+	{
+		EncodedDeviceId = FAccelByteUtilities::EncodeHMACBase64(PlainDeviceId, Key);
+		EncodedDeviceIdKey = Key;
+	}
+	return EncodedDeviceId;
+}
+
+FString FAccelByteDeviceIdentity::GetAuthTrustId()
+{
+	FScopeLock ScopeLock(&AuthTrustIdLock);
+
+	if (!bAuthTrustIdCached)
+	{
+		AuthTrustId.Empty();
+		FPlatformMisc::GetStoredValue(FAccelByteUtilities::AccelByteStored()
+			, FAccelByteUtilities::AccelByteStoredSectionIAM()
+			, FAccelByteUtilities::AccelByteStoredKeyAuthTrustId()
+			, AuthTrustId);
+		bAuthTrustIdCached = true;
+	}
+	return AuthTrustId;
+}
+
+void FAccelByteDeviceIdentity::SetAuthTrustId(FString const& InAuthTrustId)
+{
+	FScopeLock ScopeLock(&AuthTrustIdLock);
+
+	if (bAuthTrustIdCached && AuthTrustId == InAuthTrustId)
+	{
+		return;
+	}
+
+	FPlatformMisc::SetStoredValue(FAccelByteUtilities::AccelByteStored()
+		, FAccelByteUtilities::AccelByteStoredSectionIAM()
+		, FAccelByteUtilities::AccelByteStoredKeyAuthTrustId()
+		, InAuthTrustId);
+	AuthTrustId = InAuthTrustId;
+	bAuthTrustIdCached = true;
+}
+
+FString FAccelByteDeviceIdentity::GetPlatformName()
+{
+	FScopeLock ScopeLock(&ProcessLock);
+
+	if (PlatformName.IsEmpty())
+	{
+		PlatformName = UGameplayStatics::GetPlatformName();
+	}
+	return PlatformName;
+}
+
+FString FAccelByteDeviceIdentity::GetFlightId()
+{
+	FScopeLock ScopeLock(&ProcessLock);
+
+	if (FlightId.IsEmpty())
+	{
+		FlightId = FGuid::NewGuid().ToString().ToLower();
+	}
+	return FlightId;
+}
+
+void FAccelByteDeviceIdentity::InvalidateDeviceId()
+{
+	FScopeLock ScopeLock(&DeviceIdLock);
+
+	bDeviceIdCached = false;
+	PlainDeviceId.Empty();
+	EncodedDeviceId.Empty();
+	EncodedDeviceIdKey.Empty();
+}
+
+void FAccelByteDeviceIdentity::InvalidateAuthTrustId()
+{
+	FScopeLock ScopeLock(&AuthTrustIdLock);
+
+	bAuthTrustIdCached = false;
+	AuthTrustId.Empty();
+}
+
+void FAccelByteDeviceIdentity::Invalidate()
+{
+	InvalidateDeviceId();
+	InvalidateAuthTrustId();
+
+	FScopeLock ScopeLock(&ProcessLock);
+	PlatformName.Empty();
+}
+
+}
@@ -0,0 +1,280 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteEntityCache.h"
+#include "JsonObjectConverter.h"
+#include "Misc/ScopeLock.h"
+#include "Api/AccelByteLobbyApi.h"
+#include "Api/AccelByteUserApi.h"
+#include "Api/AccelByteUserProfileApi.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FAccelByteEntityCache::FAccelByteEntityCache(Api::Lobby& InLobby
+	, Api::User& InUser
+	, Api::UserProfile& InUserProfile
+	, FAccelByteMessagingSystem& InMessagingSystem)
+	: Lobby{InLobby}
+	, User{InUser}
+	, UserProfile{InUserProfile}
+#if ENGINE_MAJOR_VERSION < 5
+	, MessagingSystemWPtr{InMessagingSystem.AsShared()}
+#else
+	, MessagingSystemWPtr{InMessagingSystem.AsWeak()}
+#endif
+	, State{MakeShared<FState, ESPMode::ThreadSafe>()}
+{
+	int32 PresenceTtlSeconds = 60;
+	int32 PublicProfileTtlSeconds = 600;
+	int32 UserInfoTtlSeconds = 600;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.EntityCache"), TEXT("PresenceTtlSeconds"), PresenceTtlSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.EntityCache"), TEXT("PublicProfileTtlSeconds"), PublicProfileTtlSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.EntityCache"), TEXT("UserInfoTtlSeconds"), UserInfoTtlSeconds);
+	State->Presences.TtlSeconds = FMath::Max(0, PresenceTtlSeconds);
+	State->PublicProfiles.TtlSeconds = FMath::Max(0, PublicProfileTtlSeconds);
+	State->UsersInfo.TtlSeconds = FMath::Max(0, UserInfoTtlSeconds);
+
+	auto MessagingSystemPtr = MessagingSystemWPtr.Pin();
+	if (MessagingSystemPtr.IsValid())
+	{
+		UserPresenceUpdatedDelegateHandle = MessagingSystemPtr->SubscribeToTopic(EAccelByteMessagingTopic::UserPresenceUpdated
+			, FOnMessagingSystemReceivedMessage::CreateRaw(this, &FAccelByteEntityCache::OnUserPresenceUpdated));
+		FriendRemovedDelegateHandle = MessagingSystemPtr->SubscribeToTopic(EAccelByteMessagingTopic::FriendRemoved
+			, FOnMessagingSystemReceivedMessage::CreateRaw(this, &FAccelByteEntityCache::OnFriendRemoved));
+	}
+}
+
+FAccelByteEntityCache::~FAccelByteEntityCache()
+{
+	auto MessagingSystemPtr = MessagingSystemWPtr.Pin();
+	if (MessagingSystemPtr.IsValid())
+	{
+		MessagingSystemPtr->UnsubscribeFromTopic(EAccelByteMessagingTopic::UserPresenceUpdated, UserPresenceUpdatedDelegateHandle);
+		MessagingSystemPtr->UnsubscribeFromTopic(EAccelByteMessagingTopic::FriendRemoved, FriendRemovedDelegateHandle);
+	}
+}
+
+FAccelByteTaskWPtr FAccelByteEntityCache::GetUserPresences(TArray<FString> const& UserIds
+	, THandler<TArray<FAccelByteModelsUserStatusNotif>> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bForceRefresh)
+{
+	TArray<FString> MissingUserIds;
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		MissingUserIds = CollectMissing(State->Presences, UserIds, bForceRefresh, FPlatformTime::Seconds());
+		if (MissingUserIds.Num() == 0)
+		{
+			TArray<FAccelByteModelsUserStatusNotif> Result = CollectCached(State->Presences, UserIds);
+			ScopeLock.Unlock();
+			OnSuccess.ExecuteIfBound(Result);
+			return nullptr;
+		}
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> StateRef = State;
+	return Lobby.BulkGetUserPresence(MissingUserIds
+		, THandler<FAccelByteModelsBulkUserStatusNotif>::CreateLambda(
+			[StateRef, UserIds, OnSuccess](FAccelByteModelsBulkUserStatusNotif const& Response)
+			{
+				TArray<FAccelByteModelsUserStatusNotif> Result;
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					const double Now = FPlatformTime::Seconds();
+					for (FAccelByteModelsUserStatusNotif const& Presence : Response.Data)
+					{
+						StoreEntity(StateRef->Presences, Presence.UserID, Presence, Now);
+					}
+					Result = CollectCached(StateRef->Presences, UserIds);
+				}
+				OnSuccess.ExecuteIfBound(Result);
+			})
+		, OnError);
+}
+
+FAccelByteTaskWPtr FAccelByteEntityCache::GetPublicUserProfiles(TArray<FString> const& UserIds
+	, THandler<TArray<FAccelByteModelsPublicUserProfileInfo>> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bForceRefresh)
+{
+	TArray<FString> MissingUserIds;
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		MissingUserIds = CollectMissing(State->PublicProfiles, UserIds, bForceRefresh, FPlatformTime::Seconds());
+		if (MissingUserIds.Num() == 0)
+		{
+			TArray<FAccelByteModelsPublicUserProfileInfo> Result = CollectCached(State->PublicProfiles, UserIds);
+			ScopeLock.Unlock();
+			OnSuccess.ExecuteIfBound(Result);
+			return nullptr;
+		}
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> StateRef = State;
+	return UserProfile.BulkGetPublicUserProfileInfos(MissingUserIds
+		, THandler<TArray<FAccelByteModelsPublicUserProfileInfo>>::CreateLambda(
+			[StateRef, UserIds, OnSuccess](TArray<FAccelByteModelsPublicUserProfileInfo> const& Response)
+			{
+				TArray<FAccelByteModelsPublicUserProfileInfo> Result;
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					const double Now = FPlatformTime::Seconds();
+					for (FAccelByteModelsPublicUserProfileInfo const& Profile : Response)
+					{
+						StoreEntity(StateRef->PublicProfiles, Profile.UserId, Profile, Now);
+					}
+					Result = CollectCached(StateRef->PublicProfiles, UserIds);
+				}
+				OnSuccess.ExecuteIfBound(Result);
+			})
+		, OnError);
+}
+
+FAccelByteTaskWPtr FAccelByteEntityCache::GetUsersInfo(TArray<FString> const& UserIds
+	, THandler<TArray<FBaseUserInfo>> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bForceRefresh)
+{
+	TArray<FString> MissingUserIds;
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		MissingUserIds = CollectMissing(State->UsersInfo, UserIds, bForceRefresh, FPlatformTime::Seconds());
+		if (MissingUserIds.Num() == 0)
+		{
+			TArray<FBaseUserInfo> Result = CollectCached(State->UsersInfo, UserIds);
+			ScopeLock.Unlock();
+			OnSuccess.ExecuteIfBound(Result);
+			return nullptr;
+		}
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> StateRef = State;
+	return User.BulkGetUserInfo(MissingUserIds
+		, THandler<FListBulkUserInfo>::CreateLambda(
+			[StateRef, UserIds, OnSuccess](FListBulkUserInfo const& Response)
+			{
+				TArray<FBaseUserInfo> Result;
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					const double Now = FPlatformTime::Seconds();
+					for (FBaseUserInfo const& UserInfo : Response.Data)
+					{
+						StoreEntity(StateRef->UsersInfo, UserInfo.UserId, UserInfo, Now);
+					}
+					Result = CollectCached(StateRef->UsersInfo, UserIds);
+				}
+				OnSuccess.ExecuteIfBound(Result);
+			})
+		, OnError);
+}
+
+bool FAccelByteEntityCache::TryGetCachedUserPresence(FString const& UserId, FAccelByteModelsUserStatusNotif& OutPresence) const
+{
+	FScopeLock ScopeLock(&State->Lock);
+	auto const* Entry = State->Presences.Entries.Find(UserId);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+	OutPresence = Entry->Entity;
+	return true;
+}
+
+void FAccelByteEntityCache::Invalidate(FString const& UserId)
+{
+	FScopeLock ScopeLock(&State->Lock);
+	State->Presences.Entries.Remove(UserId);
+	State->PublicProfiles.Entries.Remove(UserId);
+	State->UsersInfo.Entries.Remove(UserId);
+}
+
+void FAccelByteEntityCache::Clear()
+{
+	FScopeLock ScopeLock(&State->Lock);
+	State->Presences.Entries.Empty();
+	State->PublicProfiles.Entries.Empty();
+	State->UsersInfo.Entries.Empty();
+}
+
+void FAccelByteEntityCache::OnUserPresenceUpdated(FString const& Payload)
+{
+	FAccelByteModelsUsersPresenceNotice Notice;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Payload, &Notice, 0, 0) || Notice.UserID.IsEmpty())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&State->Lock);
+	auto const* Entry = State->Presences.Entries.Find(Notice.UserID);
+
+	// Keep what the notification doesn't carry from the previous entry
+	FAccelByteModelsUserStatusNotif Presence = Entry != nullptr ? Entry->Entity : FAccelByteModelsUserStatusNotif{};
+	Presence.UserID = Notice.UserID;
+	Presence.Availability = Notice.Availability;
+	Presence.Activity = Notice.Activity;
+	Presence.Platform = Notice.Platform;
+	Presence.LastSeenAt = Notice.LastSeenAt.ToIso8601();
+	StoreEntity(State->Presences, Notice.UserID, Presence, FPlatformTime::Seconds());
+}
+
+void FAccelByteEntityCache::OnFriendRemoved(FString const& Payload)
+{
+	FAccelByteModelsUnfriendNotif Notice;
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Payload, &Notice, 0, 0))
+	{
+		return;
+	}
+
+	// Presence of a former friend is not pushed anymore, the cached one would silently go out of date
+	FScopeLock ScopeLock(&State->Lock);
+	State->Presences.Entries.Remove(Notice.friendId);
+}
+
+template<typename TEntity>
+TArray<FString> FAccelByteEntityCache::CollectMissing(TEntityStore<TEntity> const& Store, TArray<FString> const& UserIds, bool bForceRefresh, double Now)
+{
+	TArray<FString> MissingUserIds;
+	for (FString const& UserId : UserIds)
+	{
+		auto const* Entry = Store.Entries.Find(UserId);
+		if (bForceRefresh || Entry == nullptr || Entry->ExpiresAt <= Now)
+		{
+			MissingUserIds.AddUnique(UserId);
+		}
+	}
+	return MissingUserIds;
+}
+
+template<typename TEntity>
+TArray<TEntity> FAccelByteEntityCache::CollectCached(TEntityStore<TEntity> const& Store, TArray<FString> const& UserIds)
+{
+	TArray<TEntity> Result;
+	Result.Reserve(UserIds.Num());
+	for (FString const& UserId : UserIds)
+	{
+		auto const* Entry = Store.Entries.Find(UserId);
+		if (Entry != nullptr)
+		{
+			Result.Add(Entry->Entity);
+		}
+	}
+	return Result;
+}
+
+template<typename TEntity>
+void FAccelByteEntityCache::StoreEntity(TEntityStore<TEntity>& Store, FString const& UserId, TEntity const& Entity, double Now)
+{
+	if (UserId.IsEmpty())
+	{
+		return;
+	}
+
+	auto& Entry = Store.Entries.FindOrAdd(UserId);
+	Entry.Entity = Entity;
+	Entry.ExpiresAt = Now + Store.TtlSeconds;
+}
+
+}
@@ -307,6 +307,8 @@ namespace AccelByte
 		{ static_cast<int32>(ErrorCodes::JsonDeserializationFailed), TEXT("JSON deserialization failed.") },
 		{ static_cast<int32>(ErrorCodes::NetworkError), TEXT("There is no response.") },
 		{ static_cast<int32>(ErrorCodes::IsNotLoggedIn), TEXT("User not logged in.") },
+		{ static_cast<int32>(ErrorCodes::ServiceCircuitOpen), TEXT("Request not sent, the service keeps failing and its circuit is open.") },
+		{ static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("Request cancelled before it produced a result.") },
 		{ static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("WebSocket connect failed.") },
 		
 	};
@@ -0,0 +1,256 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpCircuitBreaker.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+void FAccelByteHttpCircuitBreaker::LoadConfig()
+{
+	int32 ConfigOpenSeconds = static_cast<int32>(OpenSeconds);
+	int32 RetryBudgetPercent = static_cast<int32>(RetryTokensPerSuccess * 100.0);
+	int32 RetryBudgetMaxTokens = static_cast<int32>(MaxRetryTokens);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("bEnableCircuitBreaker"), bIsEnabled);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("bEnableRetryBudget"), bIsRetryBudgetEnabled);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("CircuitBreakerFailureThreshold"), FailureThreshold);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("CircuitBreakerOpenSeconds"), ConfigOpenSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("RetryBudgetPercent"), RetryBudgetPercent);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("RetryBudgetMaxTokens"), RetryBudgetMaxTokens);
+
+	FScopeLock ScopeLock(&Lock);
+	FailureThreshold = FMath::Max(1, FailureThreshold);
+	OpenSeconds = FMath::Max(1, ConfigOpenSeconds);
+	RetryTokensPerSuccess = FMath::Max(0, RetryBudgetPercent) / 100.0;
+	MaxRetryTokens = FMath::Max(1, RetryBudgetMaxTokens);
+}
+
+FString FAccelByteHttpCircuitBreaker::GetServiceKey(FString const& Url)
+{
+	FString Rest = Url;
+	int32 SchemeEnd = Rest.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		Rest.RightChopInline(SchemeEnd + 3);
+	}
+
+	int32 QueryStart = INDEX_NONE;
+	if (Rest.FindChar(TEXT('?'), QueryStart))
+	{
+		Rest.LeftInline(QueryStart);
+	}
+
+	// Host and first path segment
+	TArray<FString> Segments;
+	Rest.ParseIntoArray(Segments, TEXT("/"));
+	if (Segments.Num() == 0)
+	{
+		return Rest;
+	}
+	if (Segments.Num() == 1)
+	{
+		return Segments[0];
+	}
+	return Segments[0] / Segments[1];
+}
+
+bool FAccelByteHttpCircuitBreaker::TryAcquire(FString const& Service, double Now)
+{
+	if (!bIsEnabled)
+	{
+		return true;
+	}
+
+	bool bIsAcquired = true;
+	bool bIsStateChanged = false;
+	EAccelByteCircuitState NewState = EAccelByteCircuitState::Closed;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FCircuit* Circuit = Circuits.Find(Service);
+		if (Circuit == nullptr || Circuit->Status.State == EAccelByteCircuitState::Closed)
+		{
+			return true;
+		}
+
+		if (Circuit->Status.State == EAccelByteCircuitState::Open && Now >= Circuit->OpenUntil)
+		{
+			SetState(*Circuit, EAccelByteCircuitState::HalfOpen, Now);
+			bIsStateChanged = true;
+			NewState = EAccelByteCircuitState::HalfOpen;
+		}
+
+		if (Circuit->Status.State == EAccelByteCircuitState::HalfOpen)
+		{
+			// A probe that never reported back, e.g. cancelled, doesn't keep the circuit half-open forever
+			const bool bIsProbeLost = Now - Circuit->LastProbeTime > FHttpRetryScheduler::TotalTimeout;
+			if (!Circuit->bIsProbing || bIsProbeLost)
+			{
+				Circuit->bIsProbing = true;
+				Circuit->LastProbeTime = Now;
+			}
+			else
+			{
+				bIsAcquired = false;
+			}
+		}
+		else
+		{
+			bIsAcquired = false;
+		}
+
+		if (!bIsAcquired)
+		{
+			Circuit->Status.RejectedCount++;
+		}
+	}
+
+	if (bIsStateChanged)
+	{
+		CircuitStateChanged.Broadcast(Service, NewState);
+	}
+	return bIsAcquired;
+}
+
+bool FAccelByteHttpCircuitBreaker::TryConsumeRetry(FString const& Service)
+{
+	if (!bIsEnabled && !bIsRetryBudgetEnabled)
+	{
+		return true;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	FCircuit& Circuit = FindOrAddCircuit(Service);
+	const bool bIsCircuitOpen = bIsEnabled && Circuit.Status.State != EAccelByteCircuitState::Closed;
+	const bool bIsBudgetExhausted = bIsRetryBudgetEnabled && Circuit.Status.RetryTokens < 1.0;
+	if (bIsCircuitOpen || bIsBudgetExhausted)
+	{
+		Circuit.Status.DeniedRetryCount++;
+		return false;
+	}
+
+	if (bIsRetryBudgetEnabled)
+	{
+		Circuit.Status.RetryTokens -= 1.0;
+	}
+	return true;
+}
+
+void FAccelByteHttpCircuitBreaker::RecordSuccess(FString const& Service)
+{
+	if (!bIsEnabled && !bIsRetryBudgetEnabled)
+	{
+		return;
+	}
+
+	bool bIsStateChanged = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FCircuit& Circuit = FindOrAddCircuit(Service);
+		Circuit.Status.ConsecutiveFailures = 0;
+		Circuit.Status.RetryTokens = FMath::Min(MaxRetryTokens, Circuit.Status.RetryTokens + RetryTokensPerSuccess);
+
+		if (bIsEnabled && Circuit.Status.State != EAccelByteCircuitState::Closed)
+		{
+			SetState(Circuit, EAccelByteCircuitState::Closed, 0.0);
+			bIsStateChanged = true;
+		}
+	}
+
+	if (bIsStateChanged)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Log, TEXT("Circuit of %s closed"), *Service);
+		CircuitStateChanged.Broadcast(Service, EAccelByteCircuitState::Closed);
+	}
+}
+
+void FAccelByteHttpCircuitBreaker::RecordFailure(FString const& Service, double Now)
+{
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	bool bIsStateChanged = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FCircuit& Circuit = FindOrAddCircuit(Service);
+		Circuit.Status.ConsecutiveFailures++;
+
+		const bool bIsProbeFailed = Circuit.Status.State == EAccelByteCircuitState::HalfOpen;
+		const bool bIsThresholdReached = Circuit.Status.State == EAccelByteCircuitState::Closed
+			&& Circuit.Status.ConsecutiveFailures >= FailureThreshold;
+		if (bIsProbeFailed || bIsThresholdReached)
+		{
+			SetState(Circuit, EAccelByteCircuitState::Open, Now);
+			bIsStateChanged = true;
+		}
+	}
+
+	if (bIsStateChanged)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Circuit of %s opened, requests fail fast for %.0f seconds"), *Service, OpenSeconds);
+		CircuitStateChanged.Broadcast(Service, EAccelByteCircuitState::Open);
+	}
+}
+
+bool FAccelByteHttpCircuitBreaker::IsServiceFailure(int32 StatusCode)
+{
+	return (StatusCode >= EHttpResponseCodes::ServerError && StatusCode <= 599)
+		|| StatusCode == EHttpResponseCodes::TooManyRequests;
+}
+
+EAccelByteCircuitState FAccelByteHttpCircuitBreaker::GetState(FString const& Service) const
+{
+	FScopeLock ScopeLock(&Lock);
+	FCircuit const* Circuit = Circuits.Find(Service);
+	return Circuit != nullptr ? Circuit->Status.State : EAccelByteCircuitState::Closed;
+}
+
+TArray<FAccelByteCircuitStatus> FAccelByteHttpCircuitBreaker::GetStatus() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<FAccelByteCircuitStatus> Result;
+	Result.Reserve(Circuits.Num());
+	for (auto const& Pair : Circuits)
+	{
+		Result.Add(Pair.Value.Status);
+	}
+	return Result;
+}
+
+void FAccelByteHttpCircuitBreaker::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	Circuits.Empty();
+}
+
+FAccelByteHttpCircuitBreaker::FCircuit& FAccelByteHttpCircuitBreaker::FindOrAddCircuit(FString const& Service)
+{
+	FCircuit* Circuit = Circuits.Find(Service);
+	if (Circuit != nullptr)
+	{
+		return *Circuit;
+	}
+
+	FCircuit& NewCircuit = Circuits.Add(Service);
+	NewCircuit.Status.Service = Service;
+	NewCircuit.Status.RetryTokens = MaxRetryTokens;
+	return NewCircuit;
+}
+
+void FAccelByteHttpCircuitBreaker::SetState(FCircuit& Circuit, EAccelByteCircuitState State, double Now)
+{
+	Circuit.Status.State = State;
+	Circuit.bIsProbing = false;
+	if (State == EAccelByteCircuitState::Open)
+	{
+		Circuit.OpenUntil = Now + OpenSeconds;
+	}
+}
+
+}
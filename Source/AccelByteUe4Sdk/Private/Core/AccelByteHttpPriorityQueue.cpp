@@ -0,0 +1,334 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpPriorityQueue.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+namespace
+{
+	const FString DefaultInteractiveServices = TEXT("iam,session,match2,login-queue,sessionbrowser");
+	const FString DefaultBackgroundServices = TEXT("game-telemetry,cloudsave,ugc");
+}
+
+FAccelByteHttpPriorityQueue::FAccelByteHttpPriorityQueue()
+{
+	const int32 DefaultWeights[] = {6, 3, 1};
+	const int32 DefaultMaxConcurrent[] = {16, 12, 4};
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteHttpPriority::Count); Index++)
+	{
+		FAccelByteHttpPriorityStats& Stats = Classes[Index].Stats;
+		Stats.Priority = static_cast<EAccelByteHttpPriority>(Index);
+		Stats.Weight = DefaultWeights[Index];
+		Stats.MaxConcurrent = DefaultMaxConcurrent[Index];
+	}
+
+	TArray<FString> Services;
+	DefaultInteractiveServices.ParseIntoArray(Services, TEXT(","));
+	for (FString const& Service : Services)
+	{
+		ServicePriorities.Emplace(Service, EAccelByteHttpPriority::Interactive);
+	}
+	DefaultBackgroundServices.ParseIntoArray(Services, TEXT(","));
+	for (FString const& Service : Services)
+	{
+		ServicePriorities.Emplace(Service, EAccelByteHttpPriority::Background);
+	}
+}
+
+void FAccelByteHttpPriorityQueue::LoadConfig()
+{
+	bool bConfigEnabled = false;
+	int32 ConfigMaxConcurrent = 16;
+	int32 ConfigInteractiveReservedSlots = 4;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("bEnablePriorityQueue"), bConfigEnabled);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("MaxConcurrentRequests"), ConfigMaxConcurrent);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("InteractiveReservedSlots"), ConfigInteractiveReservedSlots);
+
+	int32 Weights[static_cast<int32>(EAccelByteHttpPriority::Count)];
+	int32 ClassMaxConcurrent[static_cast<int32>(EAccelByteHttpPriority::Count)];
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (int32 Index = 0; Index < static_cast<int32>(EAccelByteHttpPriority::Count); Index++)
+		{
+			Weights[Index] = Classes[Index].Stats.Weight;
+			ClassMaxConcurrent[Index] = Classes[Index].Stats.MaxConcurrent;
+		}
+	}
+
+	TMap<FString, EAccelByteHttpPriority> ConfigServicePriorities;
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteHttpPriority::Count); Index++)
+	{
+		const EAccelByteHttpPriority Priority = static_cast<EAccelByteHttpPriority>(Index);
+		const FString Name = GetPriorityName(Priority);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), Name + TEXT("Weight"), Weights[Index]);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), Name + TEXT("MaxConcurrent"), ClassMaxConcurrent[Index]);
+
+		FString ServiceList;
+		if (Priority != EAccelByteHttpPriority::Normal
+			&& FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), Name + TEXT("Services"), ServiceList))
+		{
+			TArray<FString> Services;
+			ServiceList.ParseIntoArray(Services, TEXT(","));
+			for (FString const& Service : Services)
+			{
+				ConfigServicePriorities.Emplace(Service.TrimStartAndEnd(), Priority);
+			}
+		}
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	bIsEnabled = bConfigEnabled;
+	MaxConcurrent = FMath::Max(1, ConfigMaxConcurrent);
+	InteractiveReservedSlots = FMath::Clamp(ConfigInteractiveReservedSlots, 0, MaxConcurrent - 1);
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteHttpPriority::Count); Index++)
+	{
+		Classes[Index].Stats.Weight = FMath::Max(1, Weights[Index]);
+		Classes[Index].Stats.MaxConcurrent = FMath::Max(1, ClassMaxConcurrent[Index]);
+	}
+	if (ConfigServicePriorities.Num() > 0)
+	{
+		ServicePriorities = MoveTemp(ConfigServicePriorities);
+	}
+}
+
+EAccelByteHttpPriority FAccelByteHttpPriorityQueue::GetPriority(FString const& Url) const
+{
+	const FString ServiceName = GetServiceName(Url);
+
+	FScopeLock ScopeLock(&Lock);
+	EAccelByteHttpPriority const* Priority = ServicePriorities.Find(ServiceName);
+	return Priority != nullptr ? *Priority : EAccelByteHttpPriority::Normal;
+}
+
+void FAccelByteHttpPriorityQueue::SetServicePriority(FString const& ServiceName, EAccelByteHttpPriority Priority)
+{
+	if (Priority == EAccelByteHttpPriority::Count)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	ServicePriorities.Emplace(ServiceName, Priority);
+}
+
+bool FAccelByteHttpPriorityQueue::Submit(FAccelByteTaskPtr const& Task, EAccelByteHttpPriority Priority, double Now)
+{
+	if (!bIsEnabled || !Task.IsValid() || Priority == EAccelByteHttpPriority::Count)
+	{
+		return true;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	// A task resumed or retried while it still holds its slot keeps it
+	if (InFlight.Contains(Task.Get()))
+	{
+		return true;
+	}
+
+	FPriorityClass& Class = Classes[static_cast<int32>(Priority)];
+	Class.Pending.RemoveAll([&Task](FEntry const& Entry) { return Entry.Task == Task; });
+
+	// Requests of a class start in order, a new one never overtakes the queued ones
+	if (!Class.Stats.bIsSuspended && Class.Pending.Num() == 0 && CanStart(Class))
+	{
+		Acquire(Task, Priority);
+		return true;
+	}
+
+	Class.Pending.Add(FEntry{Task, Now});
+	Class.Stats.QueuedCount = Class.Pending.Num();
+	Class.Stats.DelayedCount++;
+	return false;
+}
+
+void FAccelByteHttpPriorityQueue::Dispatch(double Now, TArray<FDispatch>& OutDispatched)
+{
+	FScopeLock ScopeLock(&Lock);
+	while (FPriorityClass* Class = PickNextClass())
+	{
+		FEntry Entry = Class->Pending[0];
+		Class->Pending.RemoveAt(0);
+		Class->Stats.QueuedCount = Class->Pending.Num();
+
+		if (!Entry.Task.IsValid() || Entry.Task->State() != EAccelByteTaskState::Pending)
+		{
+			continue;
+		}
+
+		const double QueuedSeconds = FMath::Max(0.0, Now - Entry.EnqueueTime);
+		Class->Stats.MaxQueueSeconds = FMath::Max(Class->Stats.MaxQueueSeconds, QueuedSeconds);
+		Acquire(Entry.Task, Class->Stats.Priority);
+		OutDispatched.Add(FDispatch{Entry.Task, QueuedSeconds});
+	}
+}
+
+void FAccelByteHttpPriorityQueue::Release(FAccelByteTaskPtr const& Task)
+{
+	if (!Task.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	EAccelByteHttpPriority Priority;
+	if (InFlight.RemoveAndCopyValue(Task.Get(), Priority))
+	{
+		Classes[static_cast<int32>(Priority)].Stats.InFlightCount--;
+		return;
+	}
+
+	for (FPriorityClass& Class : Classes)
+	{
+		if (Class.Pending.RemoveAll([&Task](FEntry const& Entry) { return Entry.Task == Task; }) > 0)
+		{
+			Class.Stats.QueuedCount = Class.Pending.Num();
+			return;
+		}
+	}
+}
+
+void FAccelByteHttpPriorityQueue::Suspend(EAccelByteHttpPriority Priority)
+{
+	if (Priority == EAccelByteHttpPriority::Count)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Classes[static_cast<int32>(Priority)].Stats.bIsSuspended = true;
+}
+
+void FAccelByteHttpPriorityQueue::Resume(EAccelByteHttpPriority Priority)
+{
+	if (Priority == EAccelByteHttpPriority::Count)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Classes[static_cast<int32>(Priority)].Stats.bIsSuspended = false;
+}
+
+bool FAccelByteHttpPriorityQueue::IsSuspended(EAccelByteHttpPriority Priority) const
+{
+	if (Priority == EAccelByteHttpPriority::Count)
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	return Classes[static_cast<int32>(Priority)].Stats.bIsSuspended;
+}
+
+TArray<FAccelByteHttpPriorityStats> FAccelByteHttpPriorityQueue::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<FAccelByteHttpPriorityStats> Result;
+	Result.Reserve(static_cast<int32>(EAccelByteHttpPriority::Count));
+	for (FPriorityClass const& Class : Classes)
+	{
+		Result.Add(Class.Stats);
+	}
+	return Result;
+}
+
+void FAccelByteHttpPriorityQueue::Empty()
+{
+	FScopeLock ScopeLock(&Lock);
+	InFlight.Empty();
+	for (FPriorityClass& Class : Classes)
+	{
+		Class.Pending.Empty();
+		Class.CurrentWeight = 0;
+		Class.Stats.QueuedCount = 0;
+		Class.Stats.InFlightCount = 0;
+	}
+}
+
+FString FAccelByteHttpPriorityQueue::GetServiceName(FString const& Url)
+{
+	FString Rest = Url;
+	int32 SchemeEnd = Rest.Find(TEXT("://"));
+	if (SchemeEnd != INDEX_NONE)
+	{
+		Rest.RightChopInline(SchemeEnd + 3);
+	}
+
+	int32 QueryStart = INDEX_NONE;
+	if (Rest.FindChar(TEXT('?'), QueryStart))
+	{
+		Rest.LeftInline(QueryStart);
+	}
+
+	// First segment is the host
+	TArray<FString> Segments;
+	Rest.ParseIntoArray(Segments, TEXT("/"));
+	return Segments.Num() > 1 ? Segments[1] : FString();
+}
+
+FString FAccelByteHttpPriorityQueue::GetPriorityName(EAccelByteHttpPriority Priority)
+{
+	switch (Priority)
+	{
+	case EAccelByteHttpPriority::Interactive:
+		return TEXT("Interactive");
+	case EAccelByteHttpPriority::Normal:
+		return TEXT("Normal");
+	case EAccelByteHttpPriority::Background:
+		return TEXT("Background");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+bool FAccelByteHttpPriorityQueue::CanStart(FPriorityClass const& Class) const
+{
+	// Lower classes stop short of the global cap, the remaining slots are kept for Interactive requests
+	const int32 GlobalCap = Class.Stats.Priority == EAccelByteHttpPriority::Interactive
+		? MaxConcurrent
+		: MaxConcurrent - InteractiveReservedSlots;
+	return InFlight.Num() < GlobalCap && Class.Stats.InFlightCount < Class.Stats.MaxConcurrent;
+}
+
+void FAccelByteHttpPriorityQueue::Acquire(FAccelByteTaskPtr const& Task, EAccelByteHttpPriority Priority)
+{
+	FPriorityClass& Class = Classes[static_cast<int32>(Priority)];
+	InFlight.Emplace(Task.Get(), Priority);
+	Class.Stats.InFlightCount++;
+	Class.Stats.DispatchedCount++;
+}
+
+FAccelByteHttpPriorityQueue::FPriorityClass* FAccelByteHttpPriorityQueue::PickNextClass()
+{
+	// Smooth weighted round robin, the picks of each class are spread out in proportion of their weight
+	FPriorityClass* Best = nullptr;
+	int32 TotalWeight = 0;
+	for (FPriorityClass& Class : Classes)
+	{
+		if (Class.Stats.bIsSuspended || Class.Pending.Num() == 0 || !CanStart(Class))
+		{
+			continue;
+		}
+
+		Class.CurrentWeight += Class.Stats.Weight;
+		TotalWeight += Class.Stats.Weight;
+		if (Best == nullptr || Class.CurrentWeight > Best->CurrentWeight)
+		{
+			Best = &Class;
+		}
+	}
+
+	if (Best != nullptr)
+	{
+		Best->CurrentWeight -= TotalWeight;
+	}
+	return Best;
+}
+
+}
@@ -5,6 +5,7 @@
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteMetricsRegistry.h"
 #include "Core/AccelByteHttpRetryTask.h"
 #include "Core/AccelByteUtilities.h"
 
@@ -55,6 +56,18 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 	( FHttpRequestPtr Request
 	, FHttpRequestCompleteDelegate const& CompleteDelegate
 	, double RequestTime )
+{
+	const EAccelByteHttpPriority Priority = Request.IsValid()
+		? PriorityQueue.GetPriority(Request->GetURL())
+		: EAccelByteHttpPriority::Normal;
+	return ProcessRequest(Request, CompleteDelegate, RequestTime, Priority);
+}
+
+FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
+	( FHttpRequestPtr Request
+	, FHttpRequestCompleteDelegate const& CompleteDelegate
+	, double RequestTime
+	, EAccelByteHttpPriority Priority )
 {
 	FAccelByteTaskPtr Task(nullptr);
 	if (State == EState::ShuttingDown)
@@ -79,9 +92,12 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 		, InitialDelay
 		, OnBearerAuthReject
 		, BearerAuthRejectedRefresh
-		, FHttpRetryScheduler::ResponseCodeDelegates );
+		, FHttpRetryScheduler::ResponseCodeDelegates
+		, &CircuitBreaker
+		, &PriorityQueue );
 
 	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	HttpRetryTaskPtr->SetPriority(Priority);
 
 	//Http header
 	Request->SetHeader("Namespace", HeaderNamespace);
@@ -96,15 +112,35 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 	else
 	{
 		FHttpResponsePtr CachedResponse;
-		if (UAccelByteBlueprintsSettings::IsHttpCacheEnabled() && HttpCache.TryRetrieving(Request, CachedResponse))
+		const bool bIsHttpCacheEnabled = UAccelByteBlueprintsSettings::IsHttpCacheEnabled();
+		if (bIsHttpCacheEnabled && HttpCache.TryRetrieving(Request, CachedResponse))
 		{
+			FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttpCache, TEXT("Hit"));
 			HttpRetryTaskPtr->FinishFromCached(CachedResponse);
 		}
 		else
 		{
+			if (bIsHttpCacheEnabled)
+			{
+				FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttpCache, TEXT("Miss"));
+			}
+
 			uint32 AvailableToken = RateLimit;
 			double ResetTokenTime = RequestTime + 1.0f; //Reset every second
 			bool bCancelRequest = false;
+
+			// Fail fast instead of adding load to a service that keeps failing
+			const FString Service = FAccelByteHttpCircuitBreaker::GetServiceKey(Request->GetURL());
+			if (!CircuitBreaker.TryAcquire(Service, RequestTime))
+			{
+				UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, circuit open for %s"), *Service);
+				FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("CircuitOpen"));
+				Request->SetHeader(GHeaderABCircuitOpen, TEXT("true"));
+				Task->Cancel();
+				TaskQueue.Enqueue(Task);
+				return Task;
+			}
+
 			RequestBucketLock.Lock();
 			if (FRequestBucket* LastRequest = RequestsBucket.Find(Request->GetURL()))
 			{
@@ -113,6 +149,7 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 					if (LastRequest->AvailableToken <= 0)
 					{
 						UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, rate limit reached %s"), *Request->GetURL());
+						FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("RateLimited"));
 						Task->Cancel();
 						bCancelRequest = true;
 					}
@@ -134,7 +171,15 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 			RequestBucketLock.Unlock();
 			if (!bCancelRequest)
 			{
-				Task->Start();
+				// Otherwise the task waits in its priority class until a slot is released
+				if (PriorityQueue.Submit(Task, Priority, RequestTime))
+				{
+					Task->Start();
+				}
+				else
+				{
+					FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("Queued"));
+				}
 			}
 		}
 
@@ -270,6 +315,15 @@ bool FHttpRetryScheduler::PollRetry(double Time)
 		}
 	} while (Loop);
 
+	for (auto& Task : RemovedTasks)
+	{
+		PriorityQueue.Release(Task);
+	}
+
+	// Slots are handed over as responses are received, this catches the tasks that finished without one and the
+	// classes resumed since the last poll
+	FHttpRetryTask::StartQueued(PriorityQueue, Time);
+
 	const bool bIsHttpCacheEnabled = UAccelByteBlueprintsSettings::IsHttpCacheEnabled();
 	for (auto& Task : RemovedTasks)
 	{
@@ -288,6 +342,8 @@ bool FHttpRetryScheduler::PollRetry(double Time)
 void FHttpRetryScheduler::Startup()
 {
 	InitializeRateLimit();
+	CircuitBreaker.LoadConfig();
+	PriorityQueue.LoadConfig();
 	
 	PollRetryHandle = FTickerAlias::GetCoreTicker().AddTicker(
         FTickerDelegate::CreateLambda([this](float DeltaTime)
@@ -308,6 +364,9 @@ void FHttpRetryScheduler::Shutdown()
 {
 	State = EState::ShuttingDown;
 
+	// Queued requests were never sent, there is nothing to flush for them
+	PriorityQueue.Empty();
+
 	if (PollRetryHandle.IsValid())
 	{
 		// Core ticker by this point in engine shutdown has already been torn down - only remove ticker if this is not an engine shutdown
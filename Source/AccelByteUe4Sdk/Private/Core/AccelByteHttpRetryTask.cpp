@@ -4,6 +4,8 @@
 
 #include "Core/AccelByteHttpRetryTask.h"
 #include "Core/AccelByteReport.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteMetricsRegistry.h"
 
 namespace AccelByte
 {
@@ -14,7 +16,9 @@ namespace AccelByte
 		double InNextDelay,
 		const FVoidHandler& InOnBearerAuthRejectDelegate,
 		FBearerAuthRejectedRefresh& InBearerAuthRejectedRefresh,
-		TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> HandlerDelegates)
+		TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> HandlerDelegates,
+		FAccelByteHttpCircuitBreaker* InCircuitBreaker,
+		FAccelByteHttpPriorityQueue* InPriorityQueue)
 		: Request{ InRequest }
 		, CompleteDelegate{ InCompleteDelegate }
 		, RequestTime{ InRequestTime }
@@ -24,7 +28,14 @@ namespace AccelByte
 		, NextDelay{ InNextDelay }
 		, OnBearerAuthRejectDelegate{ InOnBearerAuthRejectDelegate }
 		, BearerAuthRejectedRefresh{ InBearerAuthRejectedRefresh }
+		, CircuitBreaker{ InCircuitBreaker }
+		, PriorityQueue{ InPriorityQueue }
 	{
+		if (CircuitBreaker != nullptr && Request.IsValid())
+		{
+			Service = FAccelByteHttpCircuitBreaker::GetServiceKey(Request->GetURL());
+		}
+
 		Request->OnProcessRequestComplete().BindRaw(this, &FHttpRetryTask::OnProcessRequestComplete);
 		
 		TaskTime = RequestTime;
@@ -53,6 +64,28 @@ namespace AccelByte
 		return FAccelByteTask::Start();
 	}
 
+	bool FHttpRetryTask::StartFromQueue(double QueuedSeconds)
+	{
+		QueuedDuration += QueuedSeconds;
+		if (FRegistry::MetricsRegistry.IsEnabled())
+		{
+			FRegistry::MetricsRegistry.RecordLatency(TEXT("Http.QueueWait.") + FAccelByteHttpPriorityQueue::GetPriorityName(Priority)
+				, QueuedSeconds * 1000.0);
+		}
+		return Start();
+	}
+
+	void FHttpRetryTask::StartQueued(FAccelByteHttpPriorityQueue& PriorityQueue, double Now)
+	{
+		TArray<FAccelByteHttpPriorityQueue::FDispatch> DispatchedTasks;
+		PriorityQueue.Dispatch(Now, DispatchedTasks);
+		for (auto& Dispatched : DispatchedTasks)
+		{
+			FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Dispatched.Task));
+			HttpRetryTaskPtr->StartFromQueue(Dispatched.QueuedSeconds);
+		}
+	}
+
 	bool FHttpRetryTask::Cancel()
 	{
 		if (!Request.IsValid())
@@ -102,6 +135,12 @@ namespace AccelByte
 
 		TaskTime = CurrentTime;
 
+		// Waiting for a slot, the request keeps the status of its previous attempt until dispatched
+		if (TaskState == EAccelByteTaskState::Pending)
+		{
+			return;
+		}
+
 		if (TaskState == EAccelByteTaskState::Paused)
 		{
 			double DeltaTime = TaskTime - PauseTime;
@@ -121,6 +160,11 @@ namespace AccelByte
 				return;
 			}
 			NextState = Retry();
+			if (NextState == EAccelByteTaskState::Pending)
+			{
+				TaskState = NextState;
+				return;
+			}
 		}
 		
 		const EHttpRequestStatus::Type RequestStatus = Request->GetStatus();
@@ -140,6 +184,7 @@ namespace AccelByte
 			if (Response.IsValid())
 			{
 				const int32 ResponseCode = Response->GetResponseCode();
+				RecordAttempt(FAccelByteHttpCircuitBreaker::IsServiceFailure(ResponseCode));
 				if (ResponseCodeDelegates.Contains(ResponseCode))
 				{
 					NextState = ResponseCodeDelegates[ResponseCode].Execute(ResponseCode);
@@ -163,7 +208,10 @@ namespace AccelByte
 			const EHttpFailureReason FailureReason = Request->GetFailureReason();
 			if (FailureReason == EHttpFailureReason::ConnectionError)
 			{
-				CheckRetry(NextState);
+				if (!CheckRetry(NextState))
+				{
+					NextState = EAccelByteTaskState::Failed;
+				}
 			}
 			else
 			{
@@ -174,7 +222,10 @@ namespace AccelByte
 		}
 #else
 		case EHttpRequestStatus::Failed_ConnectionError: //network error
-			CheckRetry(NextState);
+			if (!CheckRetry(NextState))
+			{
+				NextState = EAccelByteTaskState::Failed;
+			}
 			break;
 		case EHttpRequestStatus::Failed: //request cancelled
 			Cancel();
@@ -195,6 +246,15 @@ namespace AccelByte
 
 		if (TaskState == EAccelByteTaskState::Completed || TaskState == EAccelByteTaskState::Cancelled || TaskState == EAccelByteTaskState::Failed)
 		{
+			RecordMetrics();
+
+			// Nobody wants the result of a request cancelled through its token, don't deserialize it
+			if (IsCancelledByToken())
+			{
+				UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Request to %s cancelled, handlers skipped"), *Request->GetURL());
+				return FAccelByteTask::Finish();
+			}
+
 			FReport::LogHttpResponse(Request, Request->GetResponse());
 			CompleteDelegate.ExecuteIfBound(Request, Request->GetResponse(), IsFinished());
 		}
@@ -289,7 +349,7 @@ namespace AccelByte
 	{
 		bool WillRetry = false;
 
-		if (!IsTimedOut())
+		if (!IsTimedOut() && TryConsumeRetryBudget())
 		{
 			Out = ScheduleNextRetry();
 			WillRetry = true;
@@ -298,8 +358,44 @@ namespace AccelByte
 		return WillRetry;
 	}
 
+	bool FHttpRetryTask::TryConsumeRetryBudget()
+	{
+		if (CircuitBreaker == nullptr || CircuitBreaker->TryConsumeRetry(Service))
+		{
+			return true;
+		}
+
+		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Retry budget of %s exhausted, the request will not be retried"), *Service);
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("RetryBudgetExhausted"));
+		return false;
+	}
+
+	void FHttpRetryTask::RecordAttempt(bool bIsServiceFailure)
+	{
+		if (CircuitBreaker == nullptr)
+		{
+			return;
+		}
+
+		if (bIsServiceFailure)
+		{
+			CircuitBreaker->RecordFailure(Service, TaskTime);
+		}
+		else
+		{
+			CircuitBreaker->RecordSuccess(Service);
+		}
+	}
+
 	EAccelByteTaskState FHttpRetryTask::Retry()
 	{
+		// Retries and requests resumed after a bearer refresh go through the priority queue like new requests
+		if (!TryAcquireSlot())
+		{
+			TaskState = EAccelByteTaskState::Pending;
+			return TaskState;
+		}
+
 		if (Start())
 		{
 			FReport::LogHttpRequest(Request);
@@ -307,6 +403,34 @@ namespace AccelByte
 		return TaskState;
 	}
 
+	bool FHttpRetryTask::TryAcquireSlot()
+	{
+		if (PriorityQueue == nullptr || !PriorityQueue->IsEnabled())
+		{
+			return true;
+		}
+
+		if (PriorityQueue->Submit(AsShared(), Priority, TaskTime))
+		{
+			return true;
+		}
+
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("Queued"));
+		return false;
+	}
+
+	void FHttpRetryTask::ReleaseSlot()
+	{
+		if (PriorityQueue == nullptr || !PriorityQueue->IsEnabled())
+		{
+			return;
+		}
+
+		// The slot is free once the response is received, whether the task then completes, retries or pauses
+		PriorityQueue->Release(AsShared());
+		StartQueued(*PriorityQueue, FPlatformTime::Seconds());
+	}
+
 	EAccelByteTaskState FHttpRetryTask::ScheduleNextRetry()
 	{
 		NextDelay *= 2;
@@ -319,11 +443,13 @@ namespace AccelByte
 
 		NextRetryTime = TaskTime + NextDelay;
 
-		if (NextRetryTime > RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout)
+		if (NextRetryTime > RequestTime + PauseDuration + QueuedDuration + FHttpRetryScheduler::TotalTimeout)
 		{
-			NextRetryTime = RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout;
+			NextRetryTime = RequestTime + PauseDuration + QueuedDuration + FHttpRetryScheduler::TotalTimeout;
 		}
 
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("Retry"));
+
 		Request->OnRequestWillRetry().ExecuteIfBound(Request, Request->GetResponse(), NextRetryTime);
 
 		return EAccelByteTaskState::Retrying;
@@ -356,12 +482,44 @@ namespace AccelByte
 
 	bool FHttpRetryTask::IsTimedOut()
 	{
-		return TaskTime >= RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout;
+		return TaskTime >= RequestTime + PauseDuration + QueuedDuration + FHttpRetryScheduler::TotalTimeout;
+	}
+
+	void FHttpRetryTask::RecordMetrics()
+	{
+		FAccelByteMetricsRegistry& Metrics = FRegistry::MetricsRegistry;
+		if (!Metrics.IsEnabled())
+		{
+			return;
+		}
+
+		const FHttpResponsePtr Response = Request->GetResponse();
+		const int32 StatusCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+		const double LatencyMs = (FPlatformTime::Seconds() - RequestTime) * 1000.0;
+
+		Metrics.RecordHttpLatency(Request->GetVerb(), Request->GetURL(), LatencyMs, StatusCode);
+		Metrics.RecordLatency(TEXT("Http.") + FAccelByteHttpPriorityQueue::GetPriorityName(Priority), LatencyMs);
+
+		switch (TaskState)
+		{
+		case EAccelByteTaskState::Completed:
+			Metrics.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("Completed"));
+			break;
+		case EAccelByteTaskState::Cancelled:
+			Metrics.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("Cancelled"));
+			break;
+		case EAccelByteTaskState::Failed:
+			Metrics.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("Failed"));
+			break;
+		default:
+			break;
+		}
 	}
 
 	void FHttpRetryTask::OnProcessRequestComplete(FHttpRequestPtr InRequest, FHttpResponsePtr InResponse,
 		bool bConnectedSuccessfully)
 	{
 		SetResponseTime(FDateTime::UtcNow());
+		ReleaseSlot();
 	}
 }
@@ -13,7 +13,9 @@ namespace AccelByte
 {
 	typedef FHttpRetryScheduler::FBearerAuthRejectedRefresh FBearerAuthRejectedRefresh;
 
-	class FHttpRetryTask : public FAccelByteTask
+	class FHttpRetryTask
+		: public FAccelByteTask
+		, public TSharedFromThis<FHttpRetryTask, ESPMode::ThreadSafe>
 	{
 	public:
 		FHttpRetryTask(
@@ -23,10 +25,22 @@ namespace AccelByte
 			double InNextDelay,
 			const FVoidHandler& InOnBearerAuthRejectDelegate,
 			FBearerAuthRejectedRefresh& InBearerAuthRejectedRefresh,
-			TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> HandlerDelegates = {});
+			TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> HandlerDelegates = {},
+			FAccelByteHttpCircuitBreaker* InCircuitBreaker = nullptr,
+			FAccelByteHttpPriorityQueue* InPriorityQueue = nullptr);
 		virtual ~FHttpRetryTask() override;
 
 		virtual bool Start() override;
+
+		/**
+		 * @brief Start a task that waited for a slot, the wait doesn't count against its timeout.
+		 */
+		bool StartFromQueue(double QueuedSeconds);
+
+		/**
+		 * @brief Start the tasks given a slot freed in the priority queue.
+		 */
+		static void StartQueued(FAccelByteHttpPriorityQueue& PriorityQueue, double Now);
 		virtual bool Cancel() override;
 		virtual void Tick(double CurrentTime) override;
 		virtual bool Finish() override;
@@ -39,12 +53,16 @@ namespace AccelByte
 		void SetResponseTime(FDateTime InResponseTime) { ResponseTime = InResponseTime; };
 		FDateTime GetResponseTime() const { return ResponseTime; };
 
+		void SetPriority(EAccelByteHttpPriority InPriority) { Priority = InPriority; };
+		EAccelByteHttpPriority GetPriority() const { return Priority; };
+
 	private:
 		FHttpRequestPtr Request{};
 		const FHttpRequestCompleteDelegate CompleteDelegate{};
 		const double RequestTime{};
 		double PauseTime{};
 		double PauseDuration{};
+		double QueuedDuration{};
 		double NextRetryTime{};
 		double NextDelay{};
 		const FVoidHandler OnBearerAuthRejectDelegate{};
@@ -53,16 +71,25 @@ namespace AccelByte
 		bool bIsBeenRunFromPause{};
 		TMap<int32, FHttpRetryScheduler::FHttpResponseCodeHandler> ResponseCodeDelegates{};
 		FDateTime ResponseTime{0};
+		FAccelByteHttpCircuitBreaker* CircuitBreaker{};
+		FAccelByteHttpPriorityQueue* PriorityQueue{};
+		FString Service{};
+		EAccelByteHttpPriority Priority{EAccelByteHttpPriority::Normal};
 
 		void InitializeDefaultDelegates();
 		void BearerAuthUpdated(const FString& AccessToken);
 		EAccelByteTaskState HandleDefaultRetry(int32 StatusCode);
 		bool CheckRetry(EAccelByteTaskState& Out);
+		bool TryConsumeRetryBudget();
+		void RecordAttempt(bool bIsServiceFailure);
 		EAccelByteTaskState Retry();
+		bool TryAcquireSlot();
+		void ReleaseSlot();
 		EAccelByteTaskState ScheduleNextRetry();
 		bool IsFinished();
 		bool IsRefreshable();
 		bool IsTimedOut();
+		void RecordMetrics();
 
 		void OnProcessRequestComplete(FHttpRequestPtr InRequest, FHttpResponsePtr InResponse, bool bConnectedSuccessfully);
 	};
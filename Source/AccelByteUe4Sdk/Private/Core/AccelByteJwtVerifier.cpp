@@ -0,0 +1,460 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteJwtVerifier.h"
+#include "Core/AccelByteReport.h"
+#include "Async/Async.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonSerializer.h"
+#include <memory>
+
+#if !PLATFORM_SWITCH
+// enclosing with namespace because of collision with Unreal types
+namespace openssl
+{
+THIRD_PARTY_INCLUDES_START
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+THIRD_PARTY_INCLUDES_END
+}
+
+using namespace openssl;
+#endif
+
+DEFINE_LOG_CATEGORY(LogAccelByteJwtVerifier);
+
+namespace AccelByte
+{
+
+namespace
+{
+	constexpr int32 MaxVerifiedTokens = 1024;
+
+	FString UnescapeB64Url(FString B64UrlString)
+	{
+		B64UrlString.ReplaceCharInline('-', '+');
+		B64UrlString.ReplaceCharInline('_', '/');
+		while (B64UrlString.Len() % 4 != 0)
+		{
+			B64UrlString.AppendChar('=');
+		}
+		return B64UrlString;
+	}
+
+	TSharedPtr<FJsonObject> DecodeJsonSegment(FString const& Segment)
+	{
+		FString JsonStr;
+		if (!FBase64::Decode(UnescapeB64Url(Segment), JsonStr))
+		{
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> JsonObjectPtr;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonStr), JsonObjectPtr))
+		{
+			return nullptr;
+		}
+		return JsonObjectPtr;
+	}
+}
+
+struct FAccelByteJwtVerifier::FPublicKey
+{
+#if !PLATFORM_SWITCH
+	explicit FPublicKey(EVP_PKEY* InKey)
+		: Key(InKey)
+	{
+	}
+
+	~FPublicKey()
+	{
+		EVP_PKEY_free(Key);
+	}
+
+	EVP_PKEY* Key;
+#endif
+};
+
+FAccelByteJwtVerifier::FAccelByteJwtVerifier(FJwksFetcher InJwksFetcher
+	, double InVerifiedCacheTtlSeconds
+	, double InMinRefreshIntervalSeconds)
+	: JwksFetcher(MoveTemp(InJwksFetcher))
+	, VerifiedCacheTtlSeconds(InVerifiedCacheTtlSeconds)
+	, MinRefreshIntervalSeconds(InMinRefreshIntervalSeconds)
+{
+}
+
+FAccelByteJwtVerifier::~FAccelByteJwtVerifier()
+{
+}
+
+void FAccelByteJwtVerifier::Verify(FString const& Token, FOnJwtVerified const& OnComplete)
+{
+	TSharedPtr<FJsonObject> Payload;
+	if (FindVerified(HashToken(Token), Payload))
+	{
+		// Still deferred to the game thread, the delegate is never executed before Verify returns
+		AsyncTask(ENamedThreads::GameThread, [OnComplete, Payload]()
+			{
+				OnComplete.ExecuteIfBound(EJwtResult::Ok, Payload);
+			});
+		return;
+	}
+
+	TWeakPtr<FAccelByteJwtVerifier, ESPMode::ThreadSafe> VerifierWPtr = AsShared();
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [VerifierWPtr, Token, OnComplete]()
+		{
+			const auto VerifierPtr = VerifierWPtr.Pin();
+			if (VerifierPtr.IsValid())
+			{
+				VerifierPtr->VerifyOnWorker(Token, OnComplete, true);
+			}
+		});
+}
+
+EJwtResult FAccelByteJwtVerifier::VerifySync(FString const& Token, TSharedPtr<FJsonObject>& OutPayload)
+{
+	const FSHAHash TokenHash = HashToken(Token);
+	if (FindVerified(TokenHash, OutPayload))
+	{
+		return EJwtResult::Ok;
+	}
+
+	FString KeyId;
+	const EJwtResult Result = VerifyWithKey(Token, KeyId, OutPayload);
+	if (Result == EJwtResult::Ok)
+	{
+		AddVerified(TokenHash, OutPayload);
+	}
+	return Result;
+}
+
+void FAccelByteJwtVerifier::SetJwks(FJwkSet const& JwkSet)
+{
+	TMap<FString, TSharedPtr<FPublicKey, ESPMode::ThreadSafe>> NewKeys;
+
+#if !PLATFORM_SWITCH
+	for (FJsonObjectWrapper const& Jwk : JwkSet.keys)
+	{
+		TSharedPtr<FJsonObject> const& JwkObject = Jwk.JsonObject;
+		FString KeyType, KeyId, Modulus, Exponent;
+		if (!JwkObject.IsValid()
+			|| !JwkObject->TryGetStringField(TEXT("kty"), KeyType)
+			|| KeyType != TEXT("RSA")
+			|| !JwkObject->TryGetStringField(TEXT("kid"), KeyId)
+			|| !JwkObject->TryGetStringField(TEXT("n"), Modulus)
+			|| !JwkObject->TryGetStringField(TEXT("e"), Exponent))
+		{
+			continue;
+		}
+
+		const FRsaPublicKey RsaPublicKey{ Modulus, Exponent };
+		if (!RsaPublicKey.IsValid())
+		{
+			UE_LOG(LogAccelByteJwtVerifier, Warning, TEXT("Skipping unsupported RSA key %s"), *KeyId);
+			continue;
+		}
+
+		// Parsed only once per key, verification uses the EVP_PKEY directly
+		const FTCHARToUTF8 Pem(*RsaPublicKey.ToPem());
+		std::unique_ptr<BIO, decltype(&BIO_free_all)> const BIOPublicKeyPtr{BIO_new_mem_buf(Pem.Get(), Pem.Length()), BIO_free_all};
+		if (!BIOPublicKeyPtr)
+		{
+			continue;
+		}
+
+		EVP_PKEY* PublicKey = PEM_read_bio_PUBKEY(BIOPublicKeyPtr.get(), nullptr, nullptr, nullptr);
+		if (PublicKey == nullptr)
+		{
+			UE_LOG(LogAccelByteJwtVerifier, Warning, TEXT("Failed to parse RSA key %s"), *KeyId);
+			continue;
+		}
+
+		NewKeys.Emplace(KeyId, MakeShared<FPublicKey, ESPMode::ThreadSafe>(PublicKey));
+	}
+#endif
+
+	UE_LOG(LogAccelByteJwtVerifier, Verbose, TEXT("JWKS updated with %d key(s)"), NewKeys.Num());
+
+	FScopeLock Lock(&KeysLock);
+	Keys = MoveTemp(NewKeys);
+}
+
+void FAccelByteJwtVerifier::RefreshJwks()
+{
+	FJwksFetcher Fetcher;
+	{
+		FScopeLock Lock(&PendingLock);
+		Fetcher = JwksFetcher;
+		bRefreshInProgress = true;
+		LastRefreshTime = FPlatformTime::Seconds();
+	}
+
+	if (!Fetcher)
+	{
+		OnJwksRefreshed(false);
+		return;
+	}
+
+	TWeakPtr<FAccelByteJwtVerifier, ESPMode::ThreadSafe> VerifierWPtr = AsShared();
+	Fetcher(THandler<FJwkSet>::CreateLambda([VerifierWPtr](FJwkSet const& JwkSet)
+			{
+				const auto VerifierPtr = VerifierWPtr.Pin();
+				if (VerifierPtr.IsValid())
+				{
+					VerifierPtr->SetJwks(JwkSet);
+					VerifierPtr->OnJwksRefreshed(true);
+				}
+			})
+		, FErrorHandler::CreateLambda([VerifierWPtr](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				UE_LOG(LogAccelByteJwtVerifier, Warning, TEXT("Failed to fetch JWKS, error %d: %s"), ErrorCode, *ErrorMessage);
+				const auto VerifierPtr = VerifierWPtr.Pin();
+				if (VerifierPtr.IsValid())
+				{
+					VerifierPtr->OnJwksRefreshed(false);
+				}
+			}));
+}
+
+void FAccelByteJwtVerifier::Shutdown()
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		JwksFetcher = nullptr;
+	}
+	{
+		FScopeLock Lock(&KeysLock);
+		Keys.Empty();
+	}
+	{
+		FScopeLock Lock(&VerifiedLock);
+		VerifiedTokens.Empty();
+	}
+}
+
+int32 FAccelByteJwtVerifier::GetCachedKeyCount() const
+{
+	FScopeLock Lock(&KeysLock);
+	return Keys.Num();
+}
+
+EJwtResult FAccelByteJwtVerifier::VerifyWithKey(FString const& Token, FString& OutKeyId, TSharedPtr<FJsonObject>& OutPayload)
+{
+#if !PLATFORM_SWITCH
+	int32 HeaderEnd = INDEX_NONE;
+	int32 PayloadEnd = INDEX_NONE;
+	if (!Token.FindChar('.', HeaderEnd) || !Token.FindLastChar('.', PayloadEnd) || HeaderEnd == PayloadEnd)
+	{
+		return EJwtResult::MalformedJwt;
+	}
+
+	const TSharedPtr<FJsonObject> Header = DecodeJsonSegment(Token.Left(HeaderEnd));
+	if (!Header.IsValid())
+	{
+		return EJwtResult::MalformedJwt;
+	}
+
+	FString Algorithm;
+	if (!Header->TryGetStringField(TEXT("alg"), Algorithm) || Algorithm != TEXT("RS256"))
+	{
+		return EJwtResult::AlgorithmMismatch;
+	}
+
+	Header->TryGetStringField(TEXT("kid"), OutKeyId);
+	const TSharedPtr<FPublicKey, ESPMode::ThreadSafe> PublicKey = FindKey(OutKeyId);
+	if (!PublicKey.IsValid())
+	{
+		return EJwtResult::UnknownKeyId;
+	}
+
+	TArray<uint8> SignatureBytes;
+	if (!FBase64::Decode(UnescapeB64Url(Token.RightChop(PayloadEnd + 1)), SignatureBytes))
+	{
+		return EJwtResult::MalformedJwt;
+	}
+
+	// JWT is plain ASCII, the signing input is the first PayloadEnd bytes of the UTF-8 token
+	const FTCHARToUTF8 TokenUtf8(*Token);
+
+	std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> const MDContextPtr{EVP_MD_CTX_new(), EVP_MD_CTX_free};
+	if (!MDContextPtr
+		|| !EVP_VerifyInit(MDContextPtr.get(), EVP_sha256())
+		|| !EVP_VerifyUpdate(MDContextPtr.get(), TokenUtf8.Get(), PayloadEnd)
+		|| EVP_VerifyFinal(MDContextPtr.get(), SignatureBytes.GetData(), SignatureBytes.Num(), PublicKey->Key) != 1)
+	{
+		return EJwtResult::SignatureMismatch;
+	}
+
+	OutPayload = DecodeJsonSegment(Token.Mid(HeaderEnd + 1, PayloadEnd - HeaderEnd - 1));
+	if (!OutPayload.IsValid())
+	{
+		return EJwtResult::MalformedJwt;
+	}
+
+	int64 ExpiresAt = 0;
+	if (OutPayload->TryGetNumberField(TEXT("exp"), ExpiresAt) && ExpiresAt < FDateTime::UtcNow().ToUnixTimestamp())
+	{
+		return EJwtResult::Expired;
+	}
+
+	return EJwtResult::Ok;
+#else
+	FReport::Log(TEXT("FAccelByteJwtVerifier is disabled on nintendo switch!"));
+	return EJwtResult::MalformedJwt;
+#endif
+}
+
+TSharedPtr<FAccelByteJwtVerifier::FPublicKey, ESPMode::ThreadSafe> FAccelByteJwtVerifier::FindKey(FString const& KeyId) const
+{
+	FScopeLock Lock(&KeysLock);
+	return Keys.FindRef(KeyId);
+}
+
+bool FAccelByteJwtVerifier::FindVerified(FSHAHash const& TokenHash, TSharedPtr<FJsonObject>& OutPayload)
+{
+	FScopeLock Lock(&VerifiedLock);
+
+	FVerifiedToken const* VerifiedToken = VerifiedTokens.Find(TokenHash);
+	if (VerifiedToken == nullptr)
+	{
+		return false;
+	}
+
+	if (VerifiedToken->ExpiresAt < FPlatformTime::Seconds())
+	{
+		VerifiedTokens.Remove(TokenHash);
+		return false;
+	}
+
+	OutPayload = VerifiedToken->Payload;
+	return true;
+}
+
+void FAccelByteJwtVerifier::AddVerified(FSHAHash const& TokenHash, TSharedPtr<FJsonObject> const& Payload)
+{
+	const double Now = FPlatformTime::Seconds();
+	double ExpiresAt = Now + VerifiedCacheTtlSeconds;
+
+	// Never remember a token past its own expiration
+	int64 TokenExpiresAt = 0;
+	if (Payload.IsValid() && Payload->TryGetNumberField(TEXT("exp"), TokenExpiresAt))
+	{
+		ExpiresAt = FMath::Min(ExpiresAt, Now + static_cast<double>(TokenExpiresAt - FDateTime::UtcNow().ToUnixTimestamp()));
+	}
+
+	FScopeLock Lock(&VerifiedLock);
+
+	if (VerifiedTokens.Num() >= MaxVerifiedTokens)
+	{
+		for (auto It = VerifiedTokens.CreateIterator(); It; ++It)
+		{
+			if (It.Value().ExpiresAt < Now)
+			{
+				It.RemoveCurrent();
+			}
+		}
+		if (VerifiedTokens.Num() >= MaxVerifiedTokens)
+		{
+			VerifiedTokens.Empty();
+		}
+	}
+
+	VerifiedTokens.Emplace(TokenHash, FVerifiedToken{ Payload, ExpiresAt });
+}
+
+void FAccelByteJwtVerifier::VerifyOnWorker(FString const& Token, FOnJwtVerified const& OnComplete, bool bAllowRefresh)
+{
+	FString KeyId;
+	TSharedPtr<FJsonObject> Payload;
+	const EJwtResult Result = VerifyWithKey(Token, KeyId, Payload);
+
+	if (Result == EJwtResult::UnknownKeyId && bAllowRefresh)
+	{
+		bool bStartRefresh = false;
+		bool bWaitForRefresh = false;
+		{
+			FScopeLock Lock(&PendingLock);
+			if (bRefreshInProgress)
+			{
+				bWaitForRefresh = true;
+			}
+			else if (JwksFetcher && FPlatformTime::Seconds() - LastRefreshTime >= MinRefreshIntervalSeconds)
+			{
+				bRefreshInProgress = true;
+				bStartRefresh = true;
+				bWaitForRefresh = true;
+			}
+
+			if (bWaitForRefresh)
+			{
+				PendingVerifications.Add(FPendingVerification{ Token, OnComplete });
+			}
+		}
+
+		if (bStartRefresh)
+		{
+			UE_LOG(LogAccelByteJwtVerifier, Log, TEXT("Unknown key id %s, refreshing JWKS"), *KeyId);
+			TWeakPtr<FAccelByteJwtVerifier, ESPMode::ThreadSafe> VerifierWPtr = AsShared();
+			AsyncTask(ENamedThreads::GameThread, [VerifierWPtr]()
+				{
+					const auto VerifierPtr = VerifierWPtr.Pin();
+					if (VerifierPtr.IsValid())
+					{
+						VerifierPtr->RefreshJwks();
+					}
+				});
+		}
+
+		if (bWaitForRefresh)
+		{
+			return;
+		}
+	}
+
+	if (Result == EJwtResult::Ok)
+	{
+		AddVerified(HashToken(Token), Payload);
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [OnComplete, Result, Payload]()
+		{
+			OnComplete.ExecuteIfBound(Result, Payload);
+		});
+}
+
+void FAccelByteJwtVerifier::OnJwksRefreshed(bool bSuccess)
+{
+	TArray<FPendingVerification> Verifications;
+	{
+		FScopeLock Lock(&PendingLock);
+		Verifications = MoveTemp(PendingVerifications);
+		PendingVerifications.Reset();
+		bRefreshInProgress = false;
+	}
+
+	// Resume the waiting verifications, a key that is still unknown after the refresh is reported as such
+	TWeakPtr<FAccelByteJwtVerifier, ESPMode::ThreadSafe> VerifierWPtr = AsShared();
+	for (FPendingVerification& Verification : Verifications)
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [VerifierWPtr, Verification]()
+			{
+				const auto VerifierPtr = VerifierWPtr.Pin();
+				if (VerifierPtr.IsValid())
+				{
+					VerifierPtr->VerifyOnWorker(Verification.Token, Verification.OnComplete, false);
+				}
+			});
+	}
+}
+
+FSHAHash FAccelByteJwtVerifier::HashToken(FString const& Token)
+{
+	const FTCHARToUTF8 TokenUtf8(*Token);
+	FSHAHash Hash;
+	FSHA1::HashBuffer(TokenUtf8.Get(), TokenUtf8.Length(), Hash.Hash);
+	return Hash;
+}
+
+}
@@ -0,0 +1,333 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteLoginQueuePoller.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FAccelByteLoginQueuePollPolicy FAccelByteLoginQueuePollPolicy::LoadFromConfig()
+{
+	FAccelByteLoginQueuePollPolicy Policy;
+
+	int32 DefaultIntervalSeconds = static_cast<int32>(Policy.DefaultIntervalSeconds);
+	int32 MaxIntervalSeconds = static_cast<int32>(Policy.MaxIntervalSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.LoginQueue"), TEXT("DefaultPollIntervalSeconds"), DefaultIntervalSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.LoginQueue"), TEXT("MaxPollIntervalSeconds"), MaxIntervalSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.LoginQueue"), TEXT("NearFrontPosition"), Policy.NearFrontPosition);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.LoginQueue"), TEXT("MinProgressPercent"), Policy.MinProgressPercent);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.LoginQueue"), TEXT("PollJitterPercent"), Policy.JitterPercent);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.LoginQueue"), TEXT("MaxConsecutivePollErrors"), Policy.MaxConsecutiveErrors);
+
+	Policy.DefaultIntervalSeconds = FMath::Max(1, DefaultIntervalSeconds);
+	Policy.MaxIntervalSeconds = FMath::Max(Policy.DefaultIntervalSeconds, static_cast<float>(MaxIntervalSeconds));
+	Policy.NearFrontPosition = FMath::Max(0, Policy.NearFrontPosition);
+	Policy.MinProgressPercent = FMath::Clamp(Policy.MinProgressPercent, 0, 100);
+	Policy.JitterPercent = FMath::Clamp(Policy.JitterPercent, 0, 100);
+	Policy.MaxConsecutiveErrors = FMath::Max(1, Policy.MaxConsecutiveErrors);
+
+	return Policy;
+}
+
+FAccelByteLoginQueuePoller::FAccelByteLoginQueuePoller(FRefreshTicket InRefreshTicket, FAccelByteLoginQueuePollPolicy const& InPolicy)
+	: RefreshTicket(MoveTemp(InRefreshTicket))
+	, Policy(InPolicy)
+{
+}
+
+FAccelByteLoginQueuePoller::~FAccelByteLoginQueuePoller()
+{
+	Cancel();
+}
+
+void FAccelByteLoginQueuePoller::Start(FAccelByteModelsLoginQueueTicketInfo const& TicketInfo
+	, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnTicketUpdated
+	, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnReady
+	, FErrorHandler const& OnError)
+{
+	if (TicketInfo.Position <= 0)
+	{
+		OnReady.ExecuteIfBound(TicketInfo);
+		return;
+	}
+
+	float Delay = 0.0f;
+	{
+		FScopeLock ScopeLock(&Lock);
+		CurrentTicket = TicketInfo;
+		State = FAccelByteLoginQueuePollState();
+		OnTicketUpdatedDelegate = OnTicketUpdated;
+		OnReadyDelegate = OnReady;
+		OnErrorDelegate = OnError;
+		bIsPolling = true;
+		Delay = ComputePollDelay(State, TicketInfo, 0.0f, Policy, FMath::FRand());
+	}
+
+	ScheduleNextPoll(Delay);
+}
+
+void FAccelByteLoginQueuePoller::Cancel()
+{
+	FAccelByteTaskPtr Task;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bIsPolling)
+		{
+			return;
+		}
+		bIsPolling = false;
+		Task = PollTask.Pin();
+		PollTask.Reset();
+		OnTicketUpdatedDelegate.Unbind();
+		OnReadyDelegate.Unbind();
+		OnErrorDelegate.Unbind();
+
+		if (TickerHandle.IsValid())
+		{
+			FTickerAlias::GetCoreTicker().RemoveTicker(TickerHandle);
+			TickerHandle.Reset();
+		}
+	}
+
+	if (Task.IsValid())
+	{
+		Task->Cancel();
+	}
+}
+
+bool FAccelByteLoginQueuePoller::IsPolling() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return bIsPolling;
+}
+
+int32 FAccelByteLoginQueuePoller::GetPollCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PollCount;
+}
+
+float FAccelByteLoginQueuePoller::ComputePollDelay(FAccelByteLoginQueuePollState& State
+	, FAccelByteModelsLoginQueueTicketInfo const& TicketInfo
+	, float RetryAfterSeconds
+	, FAccelByteLoginQueuePollPolicy const& Policy
+	, float JitterRandom)
+{
+	const float ServerInterval = TicketInfo.PlayerPollingTimeInSeconds > 0
+		? static_cast<float>(TicketInfo.PlayerPollingTimeInSeconds)
+		: Policy.DefaultIntervalSeconds;
+	State.LastServerIntervalSeconds = ServerInterval;
+	State.ErrorCount = 0;
+
+	if (State.LastPosition >= 0)
+	{
+		const int32 Progress = State.LastPosition - TicketInfo.Position;
+		const int32 MinProgress = FMath::Max(1, State.LastPosition * Policy.MinProgressPercent / 100);
+		State.StallCount = Progress < MinProgress ? State.StallCount + 1 : 0;
+	}
+	State.LastPosition = TicketInfo.Position;
+
+	float Delay = ServerInterval;
+	if (TicketInfo.Position > Policy.NearFrontPosition)
+	{
+		Delay = FMath::Min(ServerInterval * FMath::Pow(2.0f, static_cast<float>(FMath::Min(State.StallCount, 16))), Policy.MaxIntervalSeconds);
+
+		// Don't sleep through the admission
+		if (TicketInfo.EstimatedWaitingTimeInSeconds > 0)
+		{
+			Delay = FMath::Min(Delay, TicketInfo.EstimatedWaitingTimeInSeconds * 0.5f);
+		}
+	}
+
+	// The server interval is a floor, the jitter only delays
+	Delay = FMath::Max(Delay, ServerInterval);
+	Delay *= 1.0f + Policy.JitterPercent / 100.0f * JitterRandom;
+
+	if (RetryAfterSeconds > 0.0f)
+	{
+		Delay = FMath::Max(Delay, RetryAfterSeconds * (1.0f + Policy.JitterPercent / 100.0f * JitterRandom));
+	}
+
+	return Delay;
+}
+
+float FAccelByteLoginQueuePoller::ComputeErrorDelay(FAccelByteLoginQueuePollState& State
+	, float RetryAfterSeconds
+	, FAccelByteLoginQueuePollPolicy const& Policy
+	, float JitterRandom)
+{
+	const float ServerInterval = State.LastServerIntervalSeconds > 0.0f
+		? State.LastServerIntervalSeconds
+		: Policy.DefaultIntervalSeconds;
+
+	State.ErrorCount++;
+
+	float Delay = FMath::Min(ServerInterval * FMath::Pow(2.0f, static_cast<float>(FMath::Min(State.ErrorCount - 1, 16))), Policy.MaxIntervalSeconds);
+	Delay = FMath::Max(Delay, ServerInterval);
+	Delay *= 1.0f + Policy.JitterPercent / 100.0f * JitterRandom;
+
+	if (RetryAfterSeconds > 0.0f)
+	{
+		Delay = FMath::Max(Delay, RetryAfterSeconds * (1.0f + Policy.JitterPercent / 100.0f * JitterRandom));
+	}
+
+	return Delay;
+}
+
+float FAccelByteLoginQueuePoller::ParseRetryAfter(FString const& HeaderValue)
+{
+	const FString Value = HeaderValue.TrimStartAndEnd();
+	if (Value.IsEmpty())
+	{
+		return 0.0f;
+	}
+
+	if (Value.IsNumeric())
+	{
+		return FMath::Max(0.0f, FCString::Atof(*Value));
+	}
+
+	FDateTime RetryAt;
+	if (FDateTime::ParseHttpDate(Value, RetryAt))
+	{
+		return FMath::Max(0.0f, static_cast<float>((RetryAt - FDateTime::UtcNow()).GetTotalSeconds()));
+	}
+
+	return 0.0f;
+}
+
+void FAccelByteLoginQueuePoller::ScheduleNextPoll(float DelaySeconds)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bIsPolling)
+	{
+		return;
+	}
+
+	TWeakPtr<FAccelByteLoginQueuePoller, ESPMode::ThreadSafe> PollerWPtr = AsShared();
+	TickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[PollerWPtr](float DeltaTime)
+		{
+			const auto PollerPtr = PollerWPtr.Pin();
+			if (PollerPtr.IsValid())
+			{
+				PollerPtr->Poll(DeltaTime);
+			}
+			return false;
+		}), DelaySeconds);
+}
+
+bool FAccelByteLoginQueuePoller::Poll(float DeltaTime)
+{
+	FString Ticket;
+	{
+		FScopeLock ScopeLock(&Lock);
+		TickerHandle.Reset();
+		if (!bIsPolling)
+		{
+			return false;
+		}
+		Ticket = CurrentTicket.Ticket;
+		PollCount++;
+	}
+
+	FReport::Log(FString(__FUNCTION__));
+
+	TWeakPtr<FAccelByteLoginQueuePoller, ESPMode::ThreadSafe> PollerWPtr = AsShared();
+	FAccelByteTaskWPtr Task = RefreshTicket(Ticket
+		, THandler<FAccelByteLoginQueueRefreshResult>::CreateLambda(
+			[PollerWPtr](FAccelByteLoginQueueRefreshResult const& Result)
+			{
+				const auto PollerPtr = PollerWPtr.Pin();
+				if (PollerPtr.IsValid())
+				{
+					PollerPtr->OnRefreshed(Result);
+				}
+			}));
+
+	FScopeLock ScopeLock(&Lock);
+	if (bIsPolling)
+	{
+		PollTask = Task;
+	}
+	return false;
+}
+
+void FAccelByteLoginQueuePoller::OnRefreshed(FAccelByteLoginQueueRefreshResult const& Result)
+{
+	THandler<FAccelByteModelsLoginQueueTicketInfo> OnTicketUpdated;
+	THandler<FAccelByteModelsLoginQueueTicketInfo> OnReady;
+	FErrorHandler OnError;
+	float Delay = 0.0f;
+	bool bIsDone = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bIsPolling)
+		{
+			return;
+		}
+		PollTask.Reset();
+
+		OnTicketUpdated = OnTicketUpdatedDelegate;
+		if (Result.bSucceeded)
+		{
+			CurrentTicket = Result.TicketInfo;
+			if (CurrentTicket.Position <= 0)
+			{
+				bIsDone = true;
+				OnReady = OnReadyDelegate;
+			}
+			else
+			{
+				Delay = ComputePollDelay(State, CurrentTicket, Result.RetryAfterSeconds, Policy, FMath::FRand());
+			}
+		}
+		else
+		{
+			Delay = ComputeErrorDelay(State, Result.RetryAfterSeconds, Policy, FMath::FRand());
+			if (!IsRetriable(Result.ErrorCode) || State.ErrorCount >= Policy.MaxConsecutiveErrors)
+			{
+				bIsDone = true;
+				OnError = OnErrorDelegate;
+			}
+		}
+
+		if (bIsDone)
+		{
+			bIsPolling = false;
+			OnTicketUpdatedDelegate.Unbind();
+			OnReadyDelegate.Unbind();
+			OnErrorDelegate.Unbind();
+		}
+	}
+
+	if (!Result.bSucceeded)
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Refreshing login queue ticket failed. Error %d: %s"), Result.ErrorCode, *Result.ErrorMessage);
+		OnError.ExecuteIfBound(Result.ErrorCode, Result.ErrorMessage);
+	}
+	else
+	{
+		OnTicketUpdated.ExecuteIfBound(Result.TicketInfo);
+		OnReady.ExecuteIfBound(Result.TicketInfo);
+	}
+
+	if (!bIsDone)
+	{
+		ScheduleNextPoll(Delay);
+	}
+}
+
+bool FAccelByteLoginQueuePoller::IsRetriable(int32 ErrorCode)
+{
+	// Anything else means the ticket is gone, e.g. expired or cancelled
+	return ErrorCode == static_cast<int32>(ErrorCodes::NetworkError)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::InvalidResponse)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::StatusTooManyRequests)
+		|| (ErrorCode >= 500 && ErrorCode < 600);
+}
+
+}
@@ -8,6 +8,7 @@
 #include "Misc/ScopeLock.h"
 
 #include "Core/AccelByteDefines.h"
+#include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteUtilities.h"
 
 using namespace AccelByte;
@@ -17,13 +18,13 @@ DEFINE_LOG_CATEGORY(LogAccelByteMessagingSystem);
 FAccelByteMessagingSystem::FAccelByteMessagingSystem()
 {
 	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByte::FAccelByteMessagingSystem::PollMessages);
-	PollHandle = FTickerAlias::GetCoreTicker().AddTicker(TickerDelegate, PollingIntervalSecs);
+	PollHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("MessagingSystem.PollMessages"), TickerDelegate, PollingIntervalSecs);
 }
 
 FAccelByteMessagingSystem::~FAccelByteMessagingSystem()
 {
 	UnsubscribeAll();
-	FTickerAlias::GetCoreTicker().RemoveTicker(PollHandle);
+	FRegistry::PeriodicTaskScheduler.RemoveTask(PollHandle);
 }
 
 FDelegateHandle FAccelByteMessagingSystem::SubscribeToTopic(const EAccelByteMessagingTopic& Topic, const FOnMessagingSystemReceivedMessage& Delegate)
@@ -0,0 +1,395 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteMetricsRegistry.h"
+#include "Core/AccelByteUtilities.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteMetrics);
+
+namespace AccelByte
+{
+
+#pragma region FAccelByteLatencyHistogram
+
+FAccelByteLatencyHistogram::FAccelByteLatencyHistogram()
+{
+	Buckets.SetNumZeroed(BucketCount);
+}
+
+int32 FAccelByteLatencyHistogram::GetBucketIndex(uint64 ValueUs)
+{
+	if (ValueUs < static_cast<uint64>(SubBucketCount))
+	{
+		return static_cast<int32>(ValueUs);
+	}
+
+	const uint64 MaxValue = (static_cast<uint64>(1) << MaxTrackableBits) - 1;
+	ValueUs = FMath::Min(ValueUs, MaxValue);
+
+	const int32 MostSignificantBit = static_cast<int32>(FMath::FloorLog2_64(ValueUs));
+	const int32 Shift = MostSignificantBit - SubBucketBits;
+	const int32 SubBucket = static_cast<int32>((ValueUs >> Shift) & (SubBucketCount - 1));
+
+	return SubBucketCount + Shift * SubBucketCount + SubBucket;
+}
+
+uint64 FAccelByteLatencyHistogram::GetBucketUpperBoundUs(int32 Index)
+{
+	if (Index < SubBucketCount)
+	{
+		return static_cast<uint64>(Index);
+	}
+
+	const int32 Shift = (Index - SubBucketCount) / SubBucketCount;
+	const uint64 SubBucket = static_cast<uint64>((Index - SubBucketCount) % SubBucketCount);
+
+	return ((SubBucketCount + SubBucket + 1) << Shift) - 1;
+}
+
+void FAccelByteLatencyHistogram::Record(double LatencyMs)
+{
+	const uint64 ValueUs = static_cast<uint64>(FMath::Max(0.0, LatencyMs) * 1000.0);
+
+	++Buckets[GetBucketIndex(ValueUs)];
+	++TotalCount;
+	MinUs = FMath::Min(MinUs, ValueUs);
+	MaxUs = FMath::Max(MaxUs, ValueUs);
+	SumUs += static_cast<double>(ValueUs);
+}
+
+void FAccelByteLatencyHistogram::Reset()
+{
+	FMemory::Memzero(Buckets.GetData(), Buckets.Num() * Buckets.GetTypeSize());
+	TotalCount = 0;
+	MinUs = MAX_uint64;
+	MaxUs = 0;
+	SumUs = 0.0;
+}
+
+double FAccelByteLatencyHistogram::GetMinMs() const
+{
+	return TotalCount > 0 ? static_cast<double>(MinUs) / 1000.0 : 0.0;
+}
+
+double FAccelByteLatencyHistogram::GetMaxMs() const
+{
+	return static_cast<double>(MaxUs) / 1000.0;
+}
+
+double FAccelByteLatencyHistogram::GetMeanMs() const
+{
+	return TotalCount > 0 ? SumUs / static_cast<double>(TotalCount) / 1000.0 : 0.0;
+}
+
+double FAccelByteLatencyHistogram::GetPercentileMs(double Percentile) const
+{
+	if (TotalCount == 0)
+	{
+		return 0.0;
+	}
+
+	const double ClampedPercentile = FMath::Clamp(Percentile, 0.0, 100.0);
+	const int64 TargetCount = FMath::Max<int64>(1, static_cast<int64>(FMath::CeilToDouble(ClampedPercentile / 100.0 * TotalCount)));
+
+	int64 RunningCount = 0;
+	for (int32 Index = 0; Index < Buckets.Num(); Index++)
+	{
+		RunningCount += Buckets[Index];
+		if (RunningCount >= TargetCount)
+		{
+			// The bucket bound may exceed the largest recorded sample, never report more than that
+			const uint64 ValueUs = FMath::Min(GetBucketUpperBoundUs(Index), MaxUs);
+			return static_cast<double>(ValueUs) / 1000.0;
+		}
+	}
+
+	return GetMaxMs();
+}
+
+void FAccelByteLatencyHistogram::Merge(FAccelByteLatencyHistogram const& Other)
+{
+	for (int32 Index = 0; Index < Buckets.Num(); Index++)
+	{
+		Buckets[Index] += Other.Buckets[Index];
+	}
+	TotalCount += Other.TotalCount;
+	MinUs = FMath::Min(MinUs, Other.MinUs);
+	MaxUs = FMath::Max(MaxUs, Other.MaxUs);
+	SumUs += Other.SumUs;
+}
+
+#pragma endregion
+
+#pragma region FAccelByteHealthSnapshot
+
+int64 FAccelByteHealthSnapshot::GetCounter(FString const& Subsystem, FString const& Name) const
+{
+	if (TMap<FString, int64> const* SubsystemCounters = Counters.Find(Subsystem))
+	{
+		if (int64 const* Value = SubsystemCounters->Find(Name))
+		{
+			return *Value;
+		}
+	}
+	return 0;
+}
+
+#pragma endregion
+
+#pragma region FAccelByteMetricsRegistry
+
+const FString FAccelByteMetricsRegistry::SubsystemHttp = TEXT("Http");
+const FString FAccelByteMetricsRegistry::SubsystemHttpCache = TEXT("HttpCache");
+const FString FAccelByteMetricsRegistry::SubsystemWebSocket = TEXT("WebSocket");
+const FString FAccelByteMetricsRegistry::SubsystemDataStorage = TEXT("DataStorage");
+
+namespace
+{
+	FAccelByteLatencySummary CreateLatencySummary(FString const& Name, FAccelByteLatencyHistogram const& Histogram)
+	{
+		FAccelByteLatencySummary Summary;
+		Summary.Endpoint = Name;
+		Summary.Count = Histogram.GetCount();
+		Summary.MinMs = Histogram.GetMinMs();
+		Summary.MeanMs = Histogram.GetMeanMs();
+		Summary.P50Ms = Histogram.GetPercentileMs(50.0);
+		Summary.P90Ms = Histogram.GetPercentileMs(90.0);
+		Summary.P99Ms = Histogram.GetPercentileMs(99.0);
+		Summary.MaxMs = Histogram.GetMaxMs();
+		return Summary;
+	}
+}
+
+FAccelByteMetricsRegistry::FAccelByteMetricsRegistry()
+	: StartTime(FPlatformTime::Seconds())
+{
+}
+
+FAccelByteMetricsRegistry::~FAccelByteMetricsRegistry()
+{
+}
+
+void FAccelByteMetricsRegistry::InitializeFromConfig()
+{
+	bool bEnableMetrics = true;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Metrics"), TEXT("bEnableMetrics"), bEnableMetrics);
+	bEnabled = bEnableMetrics;
+
+	int32 MaxSeries = 200;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Metrics"), TEXT("MaxEndpointSeries"), MaxSeries);
+	{
+		FScopeLock ScopeLock(&Lock);
+		MaxEndpointSeries = FMath::Max(1, MaxSeries);
+	}
+
+	UE_LOG(LogAccelByteMetrics, Verbose, TEXT("Metrics registry %s"), bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
+}
+
+void FAccelByteMetricsRegistry::RecordHttpLatency(FString const& Verb, FString const& Url, double LatencyMs, int32 StatusCode)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FString Endpoint = NormalizeEndpoint(Verb, Url);
+	const bool bIsError = StatusCode == 0 || StatusCode >= 400;
+
+	FScopeLock ScopeLock(&Lock);
+	if (EndpointMetrics.Num() >= MaxEndpointSeries && !EndpointMetrics.Contains(Endpoint))
+	{
+		// A route shape we don't template, keep the series bounded rather than adding one per key
+		Endpoint = FString::Printf(TEXT("%s {other}"), *Verb.ToUpper());
+	}
+	FEndpointMetrics& Metrics = EndpointMetrics.FindOrAdd(Endpoint);
+	Metrics.Histogram.Record(LatencyMs);
+	if (bIsError)
+	{
+		++Metrics.ErrorCount;
+	}
+}
+
+void FAccelByteMetricsRegistry::RecordLatency(FString const& Name, double LatencyMs)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	NamedHistograms.FindOrAdd(Name).Record(LatencyMs);
+}
+
+void FAccelByteMetricsRegistry::IncrementCounter(FString const& Subsystem, FString const& Name, int64 Delta)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Counters.FindOrAdd(Subsystem).FindOrAdd(Name) += Delta;
+}
+
+int64 FAccelByteMetricsRegistry::GetCounter(FString const& Subsystem, FString const& Name) const
+{
+	FScopeLock ScopeLock(&Lock);
+	if (TMap<FString, int64> const* SubsystemCounters = Counters.Find(Subsystem))
+	{
+		if (int64 const* Value = SubsystemCounters->Find(Name))
+		{
+			return *Value;
+		}
+	}
+	return 0;
+}
+
+FAccelByteHealthSnapshot FAccelByteMetricsRegistry::GetHealthSnapshot() const
+{
+	FAccelByteHealthSnapshot Snapshot;
+	Snapshot.CapturedAt = FDateTime::UtcNow();
+	Snapshot.UptimeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	FScopeLock ScopeLock(&Lock);
+
+	Snapshot.Endpoints.Reserve(EndpointMetrics.Num());
+	for (auto const& Kvp : EndpointMetrics)
+	{
+		FAccelByteLatencySummary Summary = CreateLatencySummary(Kvp.Key, Kvp.Value.Histogram);
+		Summary.ErrorCount = Kvp.Value.ErrorCount;
+		Snapshot.Endpoints.Add(Summary);
+	}
+	Snapshot.Endpoints.Sort([](FAccelByteLatencySummary const& A, FAccelByteLatencySummary const& B)
+	{
+		return A.Count > B.Count;
+	});
+
+	Snapshot.Latencies.Reserve(NamedHistograms.Num());
+	for (auto const& Kvp : NamedHistograms)
+	{
+		Snapshot.Latencies.Add(CreateLatencySummary(Kvp.Key, Kvp.Value));
+	}
+
+	Snapshot.Counters = Counters;
+
+	const int64 CacheHit = Snapshot.GetCounter(SubsystemHttpCache, TEXT("Hit"));
+	const int64 CacheMiss = Snapshot.GetCounter(SubsystemHttpCache, TEXT("Miss"));
+	if (CacheHit + CacheMiss > 0)
+	{
+		Snapshot.HttpCacheHitRatio = static_cast<double>(CacheHit) / static_cast<double>(CacheHit + CacheMiss);
+	}
+
+	return Snapshot;
+}
+
+void FAccelByteMetricsRegistry::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	EndpointMetrics.Empty();
+	NamedHistograms.Empty();
+	Counters.Empty();
+	StartTime = FPlatformTime::Seconds();
+}
+
+bool FAccelByteMetricsRegistry::IsIdentifierSegment(FString const& Segment)
+{
+	if (Segment.IsEmpty())
+	{
+		return false;
+	}
+
+	if (Segment.IsNumeric())
+	{
+		return true;
+	}
+
+	// AccelByte ids are 32 hex chars, UUIDs are 36 chars with hyphens, anything shorter is most likely a path keyword
+	if (Segment.Len() < 16)
+	{
+		return false;
+	}
+
+	for (TCHAR const Char : Segment)
+	{
+		if (!FChar::IsHexDigit(Char) && Char != TEXT('-'))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FAccelByteMetricsRegistry::IsParameterizedCollection(FString const& Segment)
+{
+	// Collections of the service routes whose next segment is a caller provided key rather than an id
+	static const TSet<FString> Collections = {
+		TEXT("records"),
+		TEXT("adminrecords"),
+		TEXT("statcodes"),
+		TEXT("stats"),
+		TEXT("achievements"),
+		TEXT("leaderboards"),
+		TEXT("skus"),
+		TEXT("sku"),
+		TEXT("bycode"),
+		TEXT("codes"),
+		TEXT("slots"),
+		TEXT("tags"),
+		TEXT("channels"),
+		TEXT("topics"),
+		TEXT("configs"),
+		TEXT("platforms"),
+	};
+	return Collections.Contains(Segment.ToLower());
+}
+
+FString FAccelByteMetricsRegistry::NormalizeEndpoint(FString const& Verb, FString const& Url)
+{
+	FString Path = Url;
+
+	int32 QueryIndex = INDEX_NONE;
+	if (Path.FindChar(TEXT('?'), QueryIndex))
+	{
+		Path.LeftInline(QueryIndex);
+	}
+
+	const int32 SchemeIndex = Path.Find(TEXT("://"));
+	if (SchemeIndex != INDEX_NONE)
+	{
+		const int32 PathIndex = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeIndex + 3);
+		Path = PathIndex != INDEX_NONE ? Path.Mid(PathIndex) : TEXT("/");
+	}
+
+	TArray<FString> Segments;
+	Path.ParseIntoArray(Segments, TEXT("/"));
+
+	FString Result = Verb.ToUpper();
+	Result.Append(TEXT(" "));
+	for (int32 Index = 0; Index < Segments.Num(); Index++)
+	{
+		Result.Append(TEXT("/"));
+		if (Index > 0 && Segments[Index - 1].Equals(TEXT("namespaces"), ESearchCase::IgnoreCase))
+		{
+			Result.Append(TEXT("{namespace}"));
+		}
+		else if (Index > 0 && IsParameterizedCollection(Segments[Index - 1]))
+		{
+			Result.Append(TEXT("{key}"));
+		}
+		else if (IsIdentifierSegment(Segments[Index]))
+		{
+			Result.Append(TEXT("{id}"));
+		}
+		else
+		{
+			Result.Append(Segments[Index]);
+		}
+	}
+
+	return Result;
+}
+
+#pragma endregion
+
+}
@@ -0,0 +1,557 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteOfflineWriteQueue.h"
+#include "AccelByteUe4SdkModule.h"
+#include "Core/AccelByteBaseCredentials.h"
+#include "Core/AccelByteHttpClient.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteUtilities.h"
+#include "JsonUtilities.h"
+
+namespace AccelByte
+{
+
+namespace
+{
+	const FString OfflineQueueKey = TEXT("OfflineWriteQueue");
+}
+
+FAccelByteOfflineOperation FAccelByteOfflineOperation::Make(FString const& Verb
+	, FString const& Url
+	, FString const& Content
+	, FString const& UserId
+	, EAccelByteOfflineReplaySafety ReplaySafety)
+{
+	FAccelByteOfflineOperation Operation;
+	Operation.IdempotencyKey = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	Operation.Verb = Verb;
+	Operation.Url = Url;
+	Operation.Content = Content;
+	Operation.UserId = UserId;
+	Operation.ReplaySafety = ReplaySafety;
+	return Operation;
+}
+
+FAccelByteOfflineWriteQueue::FAccelByteOfflineWriteQueue(BaseCredentials const& InCredentialsRef, FHttpClient& InHttpClientRef)
+	: CredentialsRef(InCredentialsRef)
+	, HttpClientRef(InHttpClientRef)
+{
+}
+
+void FAccelByteOfflineWriteQueue::Startup()
+{
+	LoadConfig();
+	Load();
+
+	if (!ReplayHandle.IsValid())
+	{
+		ReplayHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("OfflineWriteQueueReplay")
+			, FTickerDelegate::CreateRaw(this, &FAccelByteOfflineWriteQueue::Replay)
+			, 1.0f);
+	}
+}
+
+void FAccelByteOfflineWriteQueue::Shutdown()
+{
+	if (ReplayHandle.IsValid())
+	{
+		FRegistry::PeriodicTaskScheduler.RemoveTask(ReplayHandle);
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	bIsStarted = false;
+	bIsReplaying = false;
+	CurrentReplayId++;
+}
+
+bool FAccelByteOfflineWriteQueue::Enqueue(FAccelByteOfflineOperation const& Operation)
+{
+	if (Operation.IdempotencyKey.IsEmpty() || Operation.Verb.IsEmpty() || Operation.Url.IsEmpty())
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Offline write not queued, the idempotency key, verb and URL are required"));
+		return false;
+	}
+	if (Operation.ReplaySafety == EAccelByteOfflineReplaySafety::Unsafe)
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Offline write %s not queued, a replay after a lost response would apply it twice"), *Operation.IdempotencyKey);
+		return false;
+	}
+
+	FAccelByteOfflineOperation NewOperation = Operation;
+	if (NewOperation.UserId.IsEmpty())
+	{
+		NewOperation.UserId = CredentialsRef.GetUserId();
+	}
+	if (NewOperation.UserId.IsEmpty())
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Offline write %s not queued, no user is logged in"), *Operation.IdempotencyKey);
+		return false;
+	}
+	NewOperation.EnqueuedAt = FDateTime::UtcNow();
+	NewOperation.AttemptCount = 0;
+
+	TArray<FAccelByteOfflineOperation> Evicted;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Operations.ContainsByPredicate([&NewOperation](FAccelByteOfflineOperation const& Queued)
+			{
+				return Queued.IdempotencyKey == NewOperation.IdempotencyKey;
+			}))
+		{
+			Stats.DuplicateCount++;
+			return false;
+		}
+
+		Add(NewOperation, Evicted);
+		Stats.EnqueuedCount++;
+		Stats.QueuedCount = Operations.Num();
+	}
+
+	FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("OfflineQueue.Enqueued"));
+	Persist();
+
+	BroadcastEvicted(Evicted);
+	return true;
+}
+
+FErrorHandler FAccelByteOfflineWriteQueue::EnqueueOnError(FAccelByteOfflineOperation const& Operation, FErrorHandler const& OnError)
+{
+	return FErrorHandler::CreateLambda([this, Operation, OnError](int32 ErrorCode, FString const& ErrorMessage)
+		{
+			if (IsRetryableError(ErrorCode)
+				&& Operation.ReplaySafety == EAccelByteOfflineReplaySafety::Idempotent
+				&& Enqueue(Operation))
+			{
+				UE_LOG(LogAccelByte, Log, TEXT("Write failed with %d, queued as offline write %s"), ErrorCode, *Operation.IdempotencyKey);
+				return;
+			}
+			OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
+		});
+}
+
+bool FAccelByteOfflineWriteQueue::IsRetryableError(int32 ErrorCode)
+{
+	return ErrorCode == static_cast<int32>(ErrorCodes::NetworkError)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::ServiceCircuitOpen)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::RequestCancelled)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::StatusUnauthorized)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::StatusRequestTimeout)
+		|| ErrorCode == static_cast<int32>(ErrorCodes::StatusTooManyRequests)
+		|| (ErrorCode >= 500 && ErrorCode <= 599);
+}
+
+void FAccelByteOfflineWriteQueue::ReplayNow()
+{
+	FScopeLock ScopeLock(&Lock);
+	NextReplayTime = 0.0;
+}
+
+void FAccelByteOfflineWriteQueue::Clear(FString const& UserId)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		Operations.RemoveAll([&UserId](FAccelByteOfflineOperation const& Operation)
+			{
+				return Operation.UserId == UserId;
+			});
+		Stats.QueuedCount = Operations.Num();
+	}
+	Persist();
+}
+
+TArray<FAccelByteOfflineOperation> FAccelByteOfflineWriteQueue::GetOperations() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Operations;
+}
+
+FAccelByteOfflineQueueStats FAccelByteOfflineWriteQueue::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+void FAccelByteOfflineWriteQueue::LoadConfig()
+{
+	int32 ConfigMaxOperations = MaxOperations;
+	int32 ConfigBackoffBaseSeconds = static_cast<int32>(BackoffBaseSeconds);
+	int32 ConfigBackoffMaxSeconds = static_cast<int32>(BackoffMaxSeconds);
+	int32 ConfigReplayTimeoutSeconds = static_cast<int32>(ReplayTimeoutSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OfflineQueue"), TEXT("MaxOperations"), ConfigMaxOperations);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OfflineQueue"), TEXT("BackoffBaseSeconds"), ConfigBackoffBaseSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OfflineQueue"), TEXT("BackoffMaxSeconds"), ConfigBackoffMaxSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OfflineQueue"), TEXT("ReplayTimeoutSeconds"), ConfigReplayTimeoutSeconds);
+
+	FScopeLock ScopeLock(&Lock);
+	MaxOperations = FMath::Max(1, ConfigMaxOperations);
+	BackoffBaseSeconds = FMath::Max(1, ConfigBackoffBaseSeconds);
+	BackoffMaxSeconds = FMath::Max(BackoffBaseSeconds, static_cast<double>(ConfigBackoffMaxSeconds));
+	ReplayTimeoutSeconds = FMath::Max(FHttpRetryScheduler::TotalTimeout, ConfigReplayTimeoutSeconds);
+}
+
+void FAccelByteOfflineWriteQueue::Load()
+{
+	IAccelByteDataStorage* Storage = IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage();
+	if (Storage == nullptr)
+	{
+		FScopeLock ScopeLock(&Lock);
+		bIsStarted = true;
+		return;
+	}
+
+	Storage->GetItem(OfflineQueueKey
+		, THandler<TPair<FString, FString>>::CreateLambda(
+			[this](TPair<FString, FString> Pair)
+			{
+				TArray<FAccelByteOfflineOperation> Stored;
+				if (!Pair.Value.IsEmpty() && !OperationsFromJsonString(Pair.Value, Stored))
+				{
+					UE_LOG(LogAccelByte, Warning, TEXT("Offline write queue storage is corrupted, the stored writes are dropped"));
+				}
+
+				TArray<FAccelByteOfflineOperation> Evicted;
+				bool bIsChanged = Stored.Num() > 0;
+				{
+					FScopeLock ScopeLock(&Lock);
+
+					// Stored writes were enqueued before the ones of this run
+					TArray<FAccelByteOfflineOperation> Enqueued = MoveTemp(Operations);
+					bIsChanged = bIsChanged || Enqueued.Num() > 0;
+					Operations.Reset();
+					for (FAccelByteOfflineOperation const& Operation : Stored)
+					{
+						Add(Operation, Evicted);
+					}
+					for (FAccelByteOfflineOperation const& Operation : Enqueued)
+					{
+						if (!Operations.ContainsByPredicate([&Operation](FAccelByteOfflineOperation const& Queued)
+							{
+								return Queued.IdempotencyKey == Operation.IdempotencyKey;
+							}))
+						{
+							Add(Operation, Evicted);
+						}
+					}
+					Stats.QueuedCount = Operations.Num();
+					bIsStarted = true;
+				}
+
+				if (Stored.Num() > 0)
+				{
+					UE_LOG(LogAccelByte, Log, TEXT("Offline write queue loaded %d stored writes"), Stored.Num());
+				}
+				if (bIsChanged)
+				{
+					Persist();
+				}
+				BroadcastEvicted(Evicted);
+			})
+		, FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+}
+
+void FAccelByteOfflineWriteQueue::Persist()
+{
+	IAccelByteDataStorage* Storage = IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage();
+	if (Storage == nullptr)
+	{
+		return;
+	}
+
+	// Saved under the lock so an older snapshot never overwrites a newer one, and never before the stored writes are
+	// loaded, they would be lost
+	FScopeLock ScopeLock(&Lock);
+	if (!bIsStarted)
+	{
+		return;
+	}
+
+	Storage->SaveItem(OfflineQueueKey
+		, OperationsToJsonString(Operations)
+		, THandler<bool>::CreateLambda([](bool bIsSuccess)
+			{
+				if (!bIsSuccess)
+				{
+					UE_LOG(LogAccelByte, Warning, TEXT("Offline write queue couldn't be stored"));
+				}
+			})
+		, FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+}
+
+bool FAccelByteOfflineWriteQueue::Replay(float DeltaTime)
+{
+	FAccelByteOfflineOperation Operation;
+	int32 ReplayId = 0;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bIsReplaying && FPlatformTime::Seconds() - ReplayStartTime > ReplayTimeoutSeconds)
+		{
+			// The request ended without calling either handler, e.g. dropped by the scheduler, so the queue doesn't stall
+			ReplayId = CurrentReplayId;
+			const FString TimedOutKey = ReplayingKey;
+			ScopeLock.Unlock();
+			OnReplayDone(ReplayId, TimedOutKey, false, static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The replay got no response"));
+			return true;
+		}
+
+		if (!bIsStarted || bIsReplaying || Operations.Num() == 0 || FPlatformTime::Seconds() < NextReplayTime)
+		{
+			return true;
+		}
+
+		if (CredentialsRef.GetSessionState() != BaseCredentials::ESessionState::Valid)
+		{
+			return true;
+		}
+
+		// Writes of other users wait for them to log in again, the order of each user's writes is kept
+		const FString& UserId = CredentialsRef.GetUserId();
+		FAccelByteOfflineOperation* Next = Operations.FindByPredicate([&UserId](FAccelByteOfflineOperation const& Queued)
+			{
+				return Queued.UserId == UserId;
+			});
+		if (Next == nullptr)
+		{
+			return true;
+		}
+
+		Next->AttemptCount++;
+		Operation = *Next;
+		bIsReplaying = true;
+		ReplayId = ++CurrentReplayId;
+		ReplayingKey = Operation.IdempotencyKey;
+		ReplayStartTime = FPlatformTime::Seconds();
+	}
+
+	const FString IdempotencyKey = Operation.IdempotencyKey;
+	TMap<FString, FString> Headers = {
+		{TEXT("Content-Type"), Operation.ContentType},
+		{TEXT("Accept"), TEXT("application/json")},
+		{GHeaderABIdempotencyKey, IdempotencyKey}
+	};
+	const FAccelByteTaskPtr Task = HttpClientRef.ApiRequest(Operation.Verb
+		, Operation.Url
+		, {}
+		, Operation.Content
+		, Headers
+		, FVoidHandler::CreateLambda([this, ReplayId, IdempotencyKey]()
+			{
+				OnReplayDone(ReplayId, IdempotencyKey, true, 0, FString());
+			})
+		, FErrorHandler::CreateLambda([this, ReplayId, IdempotencyKey](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				OnReplayDone(ReplayId, IdempotencyKey, false, ErrorCode, ErrorMessage);
+			}));
+
+	if (!Task.IsValid())
+	{
+		// Ignored when a handler was already called
+		OnReplayDone(ReplayId, IdempotencyKey, false, static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The replay couldn't be sent"));
+	}
+	return true;
+}
+
+void FAccelByteOfflineWriteQueue::OnReplayDone(int32 ReplayId
+	, FString const& IdempotencyKey
+	, bool bIsSucceeded
+	, int32 ErrorCode
+	, FString const& ErrorMessage)
+{
+	const bool bIsRetryLater = !bIsSucceeded && IsRetryableError(ErrorCode);
+
+	bool bIsRemoved = false;
+	FAccelByteOfflineOperation Finished;
+	double QueueSeconds = 0.0;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bIsReplaying || ReplayId != CurrentReplayId)
+		{
+			return;
+		}
+		bIsReplaying = false;
+
+		if (bIsRetryLater)
+		{
+			ConsecutiveFailures++;
+			const double Backoff = FMath::Min(BackoffMaxSeconds, BackoffBaseSeconds * FMath::Pow(2.0, FMath::Min(ConsecutiveFailures - 1, 16)));
+			NextReplayTime = FPlatformTime::Seconds() + Backoff * FMath::FRandRange(0.8, 1.2);
+			Stats.RetryCount++;
+		}
+		else
+		{
+			ConsecutiveFailures = 0;
+			NextReplayTime = 0.0;
+
+			// Gone when a later write with the same coalesce key replaced it while in flight
+			const int32 Index = Operations.IndexOfByPredicate([&IdempotencyKey](FAccelByteOfflineOperation const& Queued)
+				{
+					return Queued.IdempotencyKey == IdempotencyKey;
+				});
+			if (Index != INDEX_NONE)
+			{
+				Finished = Operations[Index];
+				Operations.RemoveAt(Index);
+				bIsRemoved = true;
+			}
+
+			if (bIsSucceeded)
+			{
+				Stats.ReplayedCount++;
+				QueueSeconds = (FDateTime::UtcNow() - Finished.EnqueuedAt).GetTotalSeconds();
+				if (bIsRemoved)
+				{
+					Stats.MaxQueueSeconds = FMath::Max(Stats.MaxQueueSeconds, QueueSeconds);
+				}
+			}
+			else
+			{
+				Stats.RejectedCount++;
+			}
+			Stats.QueuedCount = Operations.Num();
+		}
+	}
+
+	if (bIsRetryLater)
+	{
+		UE_LOG(LogAccelByte, Verbose, TEXT("Offline write %s failed with %d, replay postponed"), *IdempotencyKey, ErrorCode);
+		return;
+	}
+
+	if (bIsSucceeded)
+	{
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("OfflineQueue.Replayed"));
+		if (bIsRemoved)
+		{
+			FRegistry::MetricsRegistry.RecordLatency(TEXT("OfflineQueue.QueueTime"), QueueSeconds * 1000.0);
+		}
+	}
+	else
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Offline write %s rejected with %d: %s"), *IdempotencyKey, ErrorCode, *ErrorMessage);
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemHttp, TEXT("OfflineQueue.Rejected"));
+	}
+
+	if (bIsRemoved)
+	{
+		Persist();
+		OperationCompleted.Broadcast(Finished, bIsSucceeded, ErrorCode, ErrorMessage);
+	}
+}
+
+void FAccelByteOfflineWriteQueue::Add(FAccelByteOfflineOperation const& Operation, TArray<FAccelByteOfflineOperation>& OutEvicted)
+{
+	// The later write goes last, it must not overtake the writes enqueued between the two
+	if (!Operation.CoalesceKey.IsEmpty())
+	{
+		const int32 RemovedCount = Operations.RemoveAll([&Operation](FAccelByteOfflineOperation const& Queued)
+			{
+				return Queued.CoalesceKey == Operation.CoalesceKey && Queued.UserId == Operation.UserId;
+			});
+		Stats.CoalescedCount += RemovedCount;
+	}
+
+	Operations.Add(Operation);
+	while (Operations.Num() > MaxOperations)
+	{
+		OutEvicted.Add(Operations[0]);
+		Operations.RemoveAt(0);
+		Stats.EvictedCount++;
+	}
+}
+
+void FAccelByteOfflineWriteQueue::BroadcastEvicted(TArray<FAccelByteOfflineOperation> const& Evicted)
+{
+	for (FAccelByteOfflineOperation const& Operation : Evicted)
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Offline write %s dropped, the queue is full"), *Operation.IdempotencyKey);
+		OperationCompleted.Broadcast(Operation
+			, false
+			, static_cast<int32>(ErrorCodes::RequestCancelled)
+			, TEXT("Dropped, the offline write queue is full."));
+	}
+}
+
+FString FAccelByteOfflineWriteQueue::OperationsToJsonString(TArray<FAccelByteOfflineOperation> const& Operations)
+{
+	TArray<TSharedPtr<FJsonValue>> JsonOperations;
+	for (FAccelByteOfflineOperation const& Operation : Operations)
+	{
+		TSharedRef<FJsonObject> JsonObj = MakeShared<FJsonObject>();
+		JsonObj->SetStringField(TEXT("idempotencyKey"), Operation.IdempotencyKey);
+		JsonObj->SetStringField(TEXT("coalesceKey"), Operation.CoalesceKey);
+		JsonObj->SetNumberField(TEXT("replaySafety"), static_cast<int32>(Operation.ReplaySafety));
+		JsonObj->SetStringField(TEXT("verb"), Operation.Verb);
+		JsonObj->SetStringField(TEXT("url"), Operation.Url);
+		JsonObj->SetStringField(TEXT("content"), Operation.Content);
+		JsonObj->SetStringField(TEXT("contentType"), Operation.ContentType);
+		JsonObj->SetStringField(TEXT("userId"), Operation.UserId);
+		JsonObj->SetStringField(TEXT("enqueuedAt"), Operation.EnqueuedAt.ToIso8601());
+		JsonObj->SetNumberField(TEXT("attemptCount"), Operation.AttemptCount);
+		JsonOperations.Add(MakeShared<FJsonValueObject>(JsonObj));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetArrayField(TEXT("operations"), JsonOperations);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(Root, Writer);
+	return JsonString;
+}
+
+bool FAccelByteOfflineWriteQueue::OperationsFromJsonString(FString const& JsonString, TArray<FAccelByteOfflineOperation>& OutOperations)
+{
+	TSharedPtr<FJsonObject> Root;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> const* JsonOperations = nullptr;
+	if (!Root->TryGetArrayField(TEXT("operations"), JsonOperations))
+	{
+		return false;
+	}
+
+	for (TSharedPtr<FJsonValue> const& JsonValue : *JsonOperations)
+	{
+		TSharedPtr<FJsonObject> const* JsonObj = nullptr;
+		if (!JsonValue.IsValid() || !JsonValue->TryGetObject(JsonObj))
+		{
+			continue;
+		}
+
+		FAccelByteOfflineOperation Operation;
+		(*JsonObj)->TryGetStringField(TEXT("idempotencyKey"), Operation.IdempotencyKey);
+		(*JsonObj)->TryGetStringField(TEXT("coalesceKey"), Operation.CoalesceKey);
+		int32 ReplaySafety = static_cast<int32>(EAccelByteOfflineReplaySafety::Unsafe);
+		(*JsonObj)->TryGetNumberField(TEXT("replaySafety"), ReplaySafety);
+		Operation.ReplaySafety = static_cast<EAccelByteOfflineReplaySafety>(ReplaySafety);
+		(*JsonObj)->TryGetStringField(TEXT("verb"), Operation.Verb);
+		(*JsonObj)->TryGetStringField(TEXT("url"), Operation.Url);
+		(*JsonObj)->TryGetStringField(TEXT("content"), Operation.Content);
+		(*JsonObj)->TryGetStringField(TEXT("contentType"), Operation.ContentType);
+		(*JsonObj)->TryGetStringField(TEXT("userId"), Operation.UserId);
+		(*JsonObj)->TryGetNumberField(TEXT("attemptCount"), Operation.AttemptCount);
+
+		FString EnqueuedAt;
+		if ((*JsonObj)->TryGetStringField(TEXT("enqueuedAt"), EnqueuedAt))
+		{
+			FDateTime::ParseIso8601(*EnqueuedAt, Operation.EnqueuedAt);
+		}
+
+		const bool bIsReplaySafe = Operation.ReplaySafety == EAccelByteOfflineReplaySafety::Idempotent
+			|| Operation.ReplaySafety == EAccelByteOfflineReplaySafety::AtLeastOnce;
+		if (bIsReplaySafe && !Operation.IdempotencyKey.IsEmpty() && !Operation.Verb.IsEmpty() && !Operation.Url.IsEmpty() && !Operation.UserId.IsEmpty())
+		{
+			OutOperations.Add(Operation);
+		}
+	}
+	return true;
+}
+
+}
@@ -0,0 +1,691 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteOwnershipCache.h"
+#include "JsonObjectConverter.h"
+#include "Misc/ScopeLock.h"
+#include "Api/AccelByteEntitlementApi.h"
+#include "Api/AccelByteFulfillmentApi.h"
+#include "Api/AccelByteLobbyApi.h"
+#include "Containers/Ticker.h"
+#include "Core/AccelByteBaseCredentials.h"
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteJwtWrapper.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FAccelByteOwnershipCache::FAccelByteOwnershipCache(BaseCredentials const& InCredentialsRef
+	, Api::Entitlement& InEntitlement
+	, Api::Fulfillment& InFulfillment
+	, Api::Lobby& InLobby)
+	: CredentialsRef{InCredentialsRef}
+	, Entitlement{InEntitlement}
+	, Fulfillment{InFulfillment}
+	, Lobby{InLobby}
+	, State{MakeShared<FState, ESPMode::ThreadSafe>()}
+{
+	int32 OwnedTtlSeconds = 300;
+	int32 NotOwnedTtlSeconds = 60;
+	FString Topics = TEXT("ENTITLEMENT,FULFILL");
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OwnershipCache"), TEXT("OwnedTtlSeconds"), OwnedTtlSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OwnershipCache"), TEXT("NotOwnedTtlSeconds"), NotOwnedTtlSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.OwnershipCache"), TEXT("InvalidationTopics"), Topics);
+	State->OwnedTtlSeconds = FMath::Max(0, OwnedTtlSeconds);
+	State->NotOwnedTtlSeconds = FMath::Max(0, NotOwnedTtlSeconds);
+
+	Topics.ParseIntoArray(InvalidationTopics, TEXT(","), true);
+	for (FString& Topic : InvalidationTopics)
+	{
+		Topic.TrimStartAndEndInline();
+	}
+	InvalidationTopics.RemoveAll([](FString const& Topic) { return Topic.IsEmpty(); });
+
+	EntitlementsChangedDelegateHandle = Entitlement.OnEntitlementsChanged().AddRaw(this, &FAccelByteOwnershipCache::OnEntitlementsChanged);
+	FulfillmentDelegateHandle = Fulfillment.OnEntitlementsChanged().AddRaw(this, &FAccelByteOwnershipCache::OnEntitlementsChanged);
+
+	Api::Lobby::FNotifBroadcaster OnNotification;
+	OnNotification.AddRaw(this, &FAccelByteOwnershipCache::OnLobbyNotification);
+	LobbyNotificationDelegateHandle = Lobby.AddMessageNotifBroadcasterDelegate(OnNotification);
+}
+
+FAccelByteOwnershipCache::~FAccelByteOwnershipCache()
+{
+	Entitlement.OnEntitlementsChanged().Remove(EntitlementsChangedDelegateHandle);
+	Fulfillment.OnEntitlementsChanged().Remove(FulfillmentDelegateHandle);
+	Lobby.RemoveMessageNotifBroadcasterDelegate(LobbyNotificationDelegateHandle);
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnershipByAppId(FString const& AppId
+	, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bUsePublisherNamespace
+	, bool bForceRefresh)
+{
+	Api::Entitlement& EntitlementApi = Entitlement;
+	return GetOwnership(MakeKey(CredentialsRef.GetUserId(), TEXT("AppId"), {}, {AppId}, {}, bUsePublisherNamespace)
+		, {}, {AppId}, {}
+		, bUsePublisherNamespace
+		, bForceRefresh
+		, [&EntitlementApi, AppId, bUsePublisherNamespace](THandler<FAccelByteModelsEntitlementOwnership> const& InOnSuccess, FErrorHandler const& InOnError)
+		{
+			return EntitlementApi.GetUserEntitlementOwnershipByAppId(AppId, InOnSuccess, InOnError, bUsePublisherNamespace);
+		}
+		, OnSuccess
+		, OnError);
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnershipBySku(FString const& Sku
+	, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bUsePublisherNamespace
+	, bool bForceRefresh)
+{
+	Api::Entitlement& EntitlementApi = Entitlement;
+	return GetOwnership(MakeKey(CredentialsRef.GetUserId(), TEXT("Sku"), {}, {}, {Sku}, bUsePublisherNamespace)
+		, {}, {}, {Sku}
+		, bUsePublisherNamespace
+		, bForceRefresh
+		, [&EntitlementApi, Sku, bUsePublisherNamespace](THandler<FAccelByteModelsEntitlementOwnership> const& InOnSuccess, FErrorHandler const& InOnError)
+		{
+			return EntitlementApi.GetUserEntitlementOwnershipBySku(Sku, InOnSuccess, InOnError, bUsePublisherNamespace);
+		}
+		, OnSuccess
+		, OnError);
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnershipByItemId(FString const& ItemId
+	, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bUsePublisherNamespace
+	, bool bForceRefresh)
+{
+	Api::Entitlement& EntitlementApi = Entitlement;
+	return GetOwnership(MakeKey(CredentialsRef.GetUserId(), TEXT("ItemId"), {ItemId}, {}, {}, bUsePublisherNamespace)
+		, {ItemId}, {}, {}
+		, bUsePublisherNamespace
+		, bForceRefresh
+		, [&EntitlementApi, ItemId, bUsePublisherNamespace](THandler<FAccelByteModelsEntitlementOwnership> const& InOnSuccess, FErrorHandler const& InOnError)
+		{
+			return EntitlementApi.GetUserEntitlementOwnershipByItemId(ItemId, InOnSuccess, InOnError, bUsePublisherNamespace);
+		}
+		, OnSuccess
+		, OnError);
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnershipAny(TArray<FString> const& ItemIds
+	, TArray<FString> const& AppIds
+	, TArray<FString> const& Skus
+	, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bUsePublisherNamespace
+	, bool bForceRefresh)
+{
+	Api::Entitlement& EntitlementApi = Entitlement;
+	return GetOwnership(MakeKey(CredentialsRef.GetUserId(), TEXT("Any"), ItemIds, AppIds, Skus, bUsePublisherNamespace)
+		, ItemIds, AppIds, Skus
+		, bUsePublisherNamespace
+		, bForceRefresh
+		, [&EntitlementApi, ItemIds, AppIds, Skus, bUsePublisherNamespace](THandler<FAccelByteModelsEntitlementOwnership> const& InOnSuccess, FErrorHandler const& InOnError)
+		{
+			return EntitlementApi.GetUserEntitlementOwnershipAny(ItemIds, AppIds, Skus, InOnSuccess, InOnError, bUsePublisherNamespace);
+		}
+		, OnSuccess
+		, OnError);
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnershipByItemIds(TArray<FString> const& ItemIds
+	, THandler<TArray<FAccelByteModelsEntitlementOwnershipItemIds>> const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bForceRefresh)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const FString UserId = CredentialsRef.GetUserId();
+	TMap<FString, bool> CachedOwned;
+	TArray<FString> MissingItemIds;
+	int32 Generation = 0;
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		for (FString const& ItemId : ItemIds)
+		{
+			auto const* Entry = State->Entries.Find(MakeKey(UserId, TEXT("ItemIds"), {ItemId}, {}, {}, false));
+			if (!bForceRefresh && Entry != nullptr && Entry->ExpiresAt > StartTime)
+			{
+				CachedOwned.Add(ItemId, Entry->Ownership.Owned);
+			}
+			else
+			{
+				MissingItemIds.AddUnique(ItemId);
+			}
+		}
+
+		if (MissingItemIds.Num() == 0)
+		{
+			State->Stats.MemoryHitCount++;
+			State->RecordCheck(StartTime);
+			ScopeLock.Unlock();
+
+			TArray<FAccelByteModelsEntitlementOwnershipItemIds> Result;
+			for (FString const& ItemId : ItemIds)
+			{
+				FAccelByteModelsEntitlementOwnershipItemIds& Ownership = Result.AddDefaulted_GetRef();
+				Ownership.ItemId = ItemId;
+				Ownership.Owned = CachedOwned.FindRef(ItemId);
+			}
+			OnSuccess.ExecuteIfBound(Result);
+			return nullptr;
+		}
+
+		State->Stats.MissCount++;
+		Generation = State->Generation;
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> StateRef = State;
+	return Entitlement.GetUserEntitlementOwnershipByItemIds(MissingItemIds
+		, THandler<TArray<FAccelByteModelsEntitlementOwnershipItemIds>>::CreateLambda(
+			[StateRef, UserId, ItemIds, CachedOwned, Generation, StartTime, OnSuccess](TArray<FAccelByteModelsEntitlementOwnershipItemIds> const& Response)
+			{
+				TMap<FString, bool> Owned = CachedOwned;
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					const double Now = FPlatformTime::Seconds();
+					for (FAccelByteModelsEntitlementOwnershipItemIds const& Ownership : Response)
+					{
+						Owned.Add(Ownership.ItemId, Ownership.Owned);
+						if (Generation == StateRef->Generation)
+						{
+							FAccelByteModelsEntitlementOwnership Entry;
+							Entry.Owned = Ownership.Owned;
+							StateRef->StoreOwnership(MakeKey(UserId, TEXT("ItemIds"), {Ownership.ItemId}, {}, {}, false), Entry, Now);
+						}
+					}
+					StateRef->RecordCheck(StartTime);
+				}
+
+				TArray<FAccelByteModelsEntitlementOwnershipItemIds> Result;
+				for (FString const& ItemId : ItemIds)
+				{
+					bool const* bIsOwned = Owned.Find(ItemId);
+					if (bIsOwned != nullptr)
+					{
+						FAccelByteModelsEntitlementOwnershipItemIds& Ownership = Result.AddDefaulted_GetRef();
+						Ownership.ItemId = ItemId;
+						Ownership.Owned = *bIsOwned;
+					}
+				}
+				OnSuccess.ExecuteIfBound(Result);
+			})
+		, FErrorHandler::CreateLambda(
+			[StateRef, StartTime, OnError](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					StateRef->RecordCheck(StartTime);
+				}
+				OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
+			}));
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnershipViaToken(FString const& PublicKey
+	, TArray<FString> const& ItemIds
+	, TArray<FString> const& AppIds
+	, TArray<FString> const& Skus
+	, THandler<FAccelByteModelsEntitlementOwnershipDetails> const& OnSuccess
+	, FErrorHandler const& OnError
+	, FString const& VerifySub
+	, bool bUsePublisherNamespace
+	, bool bForceRefresh)
+{
+	if (PublicKey.IsEmpty() || (ItemIds.Num() == 0 && AppIds.Num() == 0 && Skus.Num() == 0))
+	{
+		// Let the API report the invalid arguments
+		return Entitlement.GetUserEntitlementOwnershipViaToken(PublicKey, ItemIds, AppIds, Skus, OnSuccess, OnError
+			, true, true, VerifySub, bUsePublisherNamespace);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const FString UserId = CredentialsRef.GetUserId();
+	const FString Key = MakeKey(UserId, TEXT("Token"), ItemIds, AppIds, Skus, bUsePublisherNamespace);
+
+	FString CachedToken;
+	if (!bForceRefresh)
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		auto const* Entry = State->Tokens.Find(Key);
+		if (Entry != nullptr)
+		{
+			CachedToken = Entry->OwnershipToken;
+		}
+	}
+
+	if (!CachedToken.IsEmpty())
+	{
+		// Verified again with the key of this call, the token may have expired or be checked against another key
+		FAccelByteModelsEntitlementOwnershipDetails Details;
+		int32 ErrorCode = 0;
+		FString ErrorMessage;
+		if (TryDecodeToken(CachedToken, PublicKey, VerifySub, Details, ErrorCode, ErrorMessage))
+		{
+			{
+				FScopeLock ScopeLock(&State->Lock);
+				State->Stats.TokenHitCount++;
+				State->RecordCheck(StartTime);
+			}
+			OnSuccess.ExecuteIfBound(Details);
+			return nullptr;
+		}
+
+		UE_LOG(LogAccelByte, Verbose, TEXT("Cached ownership token rejected, requesting a new one: %s"), *ErrorMessage);
+		FScopeLock ScopeLock(&State->Lock);
+		auto const* Entry = State->Tokens.Find(Key);
+		if (Entry != nullptr && Entry->OwnershipToken == CachedToken)
+		{
+			State->Tokens.Remove(Key);
+		}
+	}
+
+	int32 Generation = 0;
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		State->Stats.MissCount++;
+		Generation = State->Generation;
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> StateRef = State;
+	return Entitlement.GetUserEntitlementOwnershipTokenOnly(ItemIds, AppIds, Skus
+		, THandler<FAccelByteModelsOwnershipToken>::CreateLambda(
+			[StateRef, Key, UserId, PublicKey, VerifySub, ItemIds, AppIds, Skus, bUsePublisherNamespace, Generation, StartTime, OnSuccess, OnError](FAccelByteModelsOwnershipToken const& Result)
+			{
+				FAccelByteModelsEntitlementOwnershipDetails Details;
+				int32 ErrorCode = 0;
+				FString ErrorMessage;
+				const bool bIsValid = TryDecodeToken(Result.OwnershipToken, PublicKey, VerifySub, Details, ErrorCode, ErrorMessage);
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					if (bIsValid && Generation == StateRef->Generation)
+					{
+						FTokenEntry Entry;
+						Entry.OwnershipToken = Result.OwnershipToken;
+						Entry.UserId = UserId;
+						AccelByteJwtWrapper::GetExpirationDateTime(Result.OwnershipToken, Entry.ExpiresAt);
+						Entry.bUsePublisherNamespace = bUsePublisherNamespace;
+						Entry.ItemIds.Append(ItemIds);
+						Entry.AppIds.Append(AppIds);
+						Entry.Skus.Append(Skus);
+						Entry.Details = Details;
+						StateRef->Tokens.Add(Key, MoveTemp(Entry));
+					}
+					StateRef->RecordCheck(StartTime);
+				}
+
+				if (bIsValid)
+				{
+					OnSuccess.ExecuteIfBound(Details);
+				}
+				else
+				{
+					OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
+				}
+			})
+		, FErrorHandler::CreateLambda(
+			[StateRef, StartTime, OnError](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					StateRef->RecordCheck(StartTime);
+				}
+				OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
+			})
+		, bUsePublisherNamespace);
+}
+
+void FAccelByteOwnershipCache::Clear()
+{
+	FScopeLock ScopeLock(&State->Lock);
+	State->Entries.Empty();
+	State->Tokens.Empty();
+	State->Generation++;
+}
+
+FAccelByteOwnershipCacheStats FAccelByteOwnershipCache::GetStats() const
+{
+	FScopeLock ScopeLock(&State->Lock);
+	FAccelByteOwnershipCacheStats Stats = State->Stats;
+	Stats.AverageCheckMs = State->CheckCount > 0 ? State->TotalCheckMs / State->CheckCount : 0.0;
+	return Stats;
+}
+
+void FAccelByteOwnershipCache::FState::RecordCheck(double StartTime)
+{
+	const double CheckMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	CheckCount++;
+	TotalCheckMs += CheckMs;
+	FRegistry::MetricsRegistry.RecordLatency(TEXT("Ownership.Check"), CheckMs);
+}
+
+void FAccelByteOwnershipCache::FState::StoreOwnership(FString const& Key, FAccelByteModelsEntitlementOwnership const& Ownership, double Now)
+{
+	const double TtlSeconds = Ownership.Owned ? OwnedTtlSeconds : NotOwnedTtlSeconds;
+	if (TtlSeconds <= 0.0)
+	{
+		return;
+	}
+
+	auto& Entry = Entries.FindOrAdd(Key);
+	Entry.Ownership = Ownership;
+	Entry.ExpiresAt = Now + TtlSeconds;
+}
+
+FAccelByteTaskWPtr FAccelByteOwnershipCache::GetOwnership(FString const& Key
+	, TArray<FString> const& ItemIds
+	, TArray<FString> const& AppIds
+	, TArray<FString> const& Skus
+	, bool bUsePublisherNamespace
+	, bool bForceRefresh
+	, FOwnershipRequest const& Request
+	, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	FString PendingKey;
+	int32 Generation = 0;
+	{
+		FScopeLock ScopeLock(&State->Lock);
+		if (!bForceRefresh)
+		{
+			FAccelByteModelsEntitlementOwnership Ownership;
+			bool bIsHit = false;
+			auto const* Entry = State->Entries.Find(Key);
+			if (Entry != nullptr && Entry->ExpiresAt > StartTime)
+			{
+				Ownership = Entry->Ownership;
+				State->Stats.MemoryHitCount++;
+				bIsHit = true;
+			}
+			else if (TryGetFromTokens(*State, CredentialsRef.GetUserId(), ItemIds, AppIds, Skus, bUsePublisherNamespace, Ownership))
+			{
+				State->StoreOwnership(Key, Ownership, StartTime);
+				State->Stats.TokenHitCount++;
+				bIsHit = true;
+			}
+
+			if (bIsHit)
+			{
+				State->RecordCheck(StartTime);
+				ScopeLock.Unlock();
+				OnSuccess.ExecuteIfBound(Ownership);
+				return nullptr;
+			}
+		}
+
+		State->Stats.MissCount++;
+		Generation = State->Generation;
+
+		// Checks sent after an invalidation never share the request of a check sent before it
+		PendingKey = FString::Printf(TEXT("%d|%s"), Generation, *Key);
+		TArray<FPendingCheck>* PendingChecks = State->PendingChecks.Find(PendingKey);
+		if (PendingChecks != nullptr)
+		{
+			PendingChecks->Add({OnSuccess, OnError, StartTime});
+			return nullptr;
+		}
+		State->PendingChecks.Add(PendingKey).Add({OnSuccess, OnError, StartTime});
+	}
+
+	TSharedRef<FState, ESPMode::ThreadSafe> StateRef = State;
+	const FAccelByteTaskWPtr Task = Request(THandler<FAccelByteModelsEntitlementOwnership>::CreateLambda(
+			[StateRef, Key, PendingKey, Generation](FAccelByteModelsEntitlementOwnership const& Result)
+			{
+				TArray<FPendingCheck> PendingChecks;
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					StateRef->PendingChecks.RemoveAndCopyValue(PendingKey, PendingChecks);
+					StateRef->PendingRequests.Remove(PendingKey);
+					if (Generation == StateRef->Generation)
+					{
+						StateRef->StoreOwnership(Key, Result, FPlatformTime::Seconds());
+					}
+					for (FPendingCheck const& PendingCheck : PendingChecks)
+					{
+						StateRef->RecordCheck(PendingCheck.StartTime);
+					}
+				}
+
+				for (FPendingCheck const& PendingCheck : PendingChecks)
+				{
+					PendingCheck.OnSuccess.ExecuteIfBound(Result);
+				}
+			})
+		, FErrorHandler::CreateLambda(
+			[StateRef, PendingKey](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				TArray<FPendingCheck> PendingChecks;
+				{
+					FScopeLock ScopeLock(&StateRef->Lock);
+					StateRef->PendingChecks.RemoveAndCopyValue(PendingKey, PendingChecks);
+					StateRef->PendingRequests.Remove(PendingKey);
+					for (FPendingCheck const& PendingCheck : PendingChecks)
+					{
+						StateRef->RecordCheck(PendingCheck.StartTime);
+					}
+				}
+
+				for (FPendingCheck const& PendingCheck : PendingChecks)
+				{
+					PendingCheck.OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
+				}
+			}));
+
+	{
+		// The handlers may have run already, e.g. on an invalid request
+		FScopeLock ScopeLock(&State->Lock);
+		if (State->PendingChecks.Contains(PendingKey))
+		{
+			State->PendingRequests.Add(PendingKey, FPendingRequest{Task});
+			StartWatchdog(State);
+		}
+	}
+	return Task;
+}
+
+void FAccelByteOwnershipCache::StartWatchdog(TSharedRef<FState, ESPMode::ThreadSafe> const& InState)
+{
+	if (InState->bIsWatchdogRunning)
+	{
+		return;
+	}
+	InState->bIsWatchdogRunning = true;
+
+	TWeakPtr<FState, ESPMode::ThreadSafe> StateWPtr = InState;
+	FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[StateWPtr](float DeltaTime)
+		{
+			const auto StatePtr = StateWPtr.Pin();
+			return StatePtr.IsValid() && FailAbortedChecks(*StatePtr);
+		}), WatchdogPeriodSeconds);
+}
+
+bool FAccelByteOwnershipCache::FailAbortedChecks(FState& InState)
+{
+	TArray<FString> AbortedKeys;
+	{
+		FScopeLock ScopeLock(&InState.Lock);
+		for (auto& Pair : InState.PendingRequests)
+		{
+			const FAccelByteTaskPtr Task = Pair.Value.Task.Pin();
+
+			// A request cancelled through its token never calls its handlers
+			if (Task.IsValid() && Task->IsCancelledByToken())
+			{
+				AbortedKeys.Add(Pair.Key);
+				continue;
+			}
+
+			const bool bIsDone = !Task.IsValid()
+				|| Task->State() == EAccelByteTaskState::Completed
+				|| Task->State() == EAccelByteTaskState::Failed
+				|| Task->State() == EAccelByteTaskState::Cancelled;
+			Pair.Value.UnansweredCheckCount = bIsDone ? Pair.Value.UnansweredCheckCount + 1 : 0;
+			if (Pair.Value.UnansweredCheckCount >= MaxUnansweredCheckCount)
+			{
+				AbortedKeys.Add(Pair.Key);
+			}
+		}
+	}
+
+	for (FString const& PendingKey : AbortedKeys)
+	{
+		FailPendingChecks(InState, PendingKey, TEXT("The shared ownership request was cancelled"));
+	}
+
+	FScopeLock ScopeLock(&InState.Lock);
+	if (InState.PendingRequests.Num() == 0)
+	{
+		InState.bIsWatchdogRunning = false;
+		return false;
+	}
+	return true;
+}
+
+void FAccelByteOwnershipCache::FailPendingChecks(FState& InState, FString const& PendingKey, FString const& ErrorMessage)
+{
+	TArray<FPendingCheck> PendingChecks;
+	{
+		FScopeLock ScopeLock(&InState.Lock);
+		InState.PendingChecks.RemoveAndCopyValue(PendingKey, PendingChecks);
+		InState.PendingRequests.Remove(PendingKey);
+		for (FPendingCheck const& PendingCheck : PendingChecks)
+		{
+			InState.RecordCheck(PendingCheck.StartTime);
+		}
+	}
+
+	for (FPendingCheck const& PendingCheck : PendingChecks)
+	{
+		PendingCheck.OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), ErrorMessage);
+	}
+}
+
+void FAccelByteOwnershipCache::OnLobbyNotification(FAccelByteModelsNotificationMessage const& Message)
+{
+	for (FString const& Topic : InvalidationTopics)
+	{
+		if (Message.Topic.Contains(Topic, ESearchCase::IgnoreCase))
+		{
+			OnEntitlementsChanged();
+			return;
+		}
+	}
+}
+
+void FAccelByteOwnershipCache::OnEntitlementsChanged()
+{
+	UE_LOG(LogAccelByte, Verbose, TEXT("Entitlements changed, dropping the cached ownership"));
+
+	FScopeLock ScopeLock(&State->Lock);
+	State->Entries.Empty();
+	State->Tokens.Empty();
+	State->Generation++;
+	State->Stats.InvalidationCount++;
+}
+
+FString FAccelByteOwnershipCache::MakeKey(FString const& UserId
+	, TCHAR const* Kind
+	, TArray<FString> const& ItemIds
+	, TArray<FString> const& AppIds
+	, TArray<FString> const& Skus
+	, bool bUsePublisherNamespace)
+{
+	auto JoinSorted = [](TArray<FString> Ids)
+	{
+		Ids.Sort();
+		return FString::Join(Ids, TEXT(","));
+	};
+
+	return FString::Printf(TEXT("%s|%s|%s|%s|%s|%s")
+		, *UserId
+		, Kind
+		, bUsePublisherNamespace ? TEXT("Publisher") : TEXT("Game")
+		, *JoinSorted(ItemIds)
+		, *JoinSorted(AppIds)
+		, *JoinSorted(Skus));
+}
+
+bool FAccelByteOwnershipCache::TryGetFromTokens(FState const& InState
+	, FString const& UserId
+	, TArray<FString> const& ItemIds
+	, TArray<FString> const& AppIds
+	, TArray<FString> const& Skus
+	, bool bUsePublisherNamespace
+	, FAccelByteModelsEntitlementOwnership& OutOwnership)
+{
+	if (ItemIds.Num() == 0 && AppIds.Num() == 0 && Skus.Num() == 0)
+	{
+		return false;
+	}
+
+	auto IsSubsetOf = [](TArray<FString> const& Ids, TSet<FString> const& TokenIds)
+	{
+		return !Ids.ContainsByPredicate([&TokenIds](FString const& Id) { return !TokenIds.Contains(Id); });
+	};
+
+	const FDateTime Now = FDateTime::UtcNow();
+	for (auto const& Pair : InState.Tokens)
+	{
+		FTokenEntry const& Token = Pair.Value;
+		if (Token.UserId != UserId
+			|| Token.bUsePublisherNamespace != bUsePublisherNamespace
+			|| Token.ExpiresAt <= Now
+			|| !IsSubsetOf(ItemIds, Token.ItemIds)
+			|| !IsSubsetOf(AppIds, Token.AppIds)
+			|| !IsSubsetOf(Skus, Token.Skus))
+		{
+			continue;
+		}
+
+		// The token lists the owned entitlements out of the ids it was requested for
+		OutOwnership = FAccelByteModelsEntitlementOwnership{};
+		OutOwnership.Owned = Token.Details.Entitlements.ContainsByPredicate(
+			[&ItemIds, &AppIds, &Skus](FAccelByteModelsEntitlementOwnershipDetail const& Detail)
+			{
+				return (!Detail.ItemId.IsEmpty() && ItemIds.Contains(Detail.ItemId))
+					|| (!Detail.AppId.IsEmpty() && AppIds.Contains(Detail.AppId))
+					|| (!Detail.Sku.IsEmpty() && Skus.Contains(Detail.Sku));
+			});
+		return true;
+	}
+	return false;
+}
+
+bool FAccelByteOwnershipCache::TryDecodeToken(FString const& OwnershipToken
+	, FString const& PublicKey
+	, FString const& VerifySub
+	, FAccelByteModelsEntitlementOwnershipDetails& OutDetails
+	, int32& OutErrorCode
+	, FString& OutErrorMessage)
+{
+	TSharedPtr<FJsonObject> DecodedToken;
+	FAccelByteJwtError Error;
+	AccelByteJwtWrapper::TryDecode(OwnershipToken, PublicKey, DecodedToken, Error, true, true, VerifySub);
+	if (Error.Code != 0)
+	{
+		OutErrorCode = Error.Code;
+		OutErrorMessage = Error.Message;
+		return false;
+	}
+
+	if (!DecodedToken.IsValid()
+		|| !FJsonObjectConverter::JsonObjectToUStruct<FAccelByteModelsEntitlementOwnershipDetails>(DecodedToken.ToSharedRef(), &OutDetails))
+	{
+		OutErrorCode = static_cast<int32>(ErrorCodes::InvalidResponse);
+		OutErrorMessage = TEXT("Cannot parse decoded token.");
+		return false;
+	}
+	return true;
+}
+
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelBytePageIterator.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FString FAccelBytePageIteratorBase::ResolvePageUrl(FString const& PageUrl, FString const& Next)
+{
+	if (Next.StartsWith(TEXT("http://")) || Next.StartsWith(TEXT("https://")))
+	{
+		return Next;
+	}
+
+	FString PagePath = PageUrl;
+	int32 QueryIndex = INDEX_NONE;
+	if (PagePath.FindChar(TEXT('?'), QueryIndex))
+	{
+		PagePath.LeftInline(QueryIndex);
+	}
+
+	if (Next.StartsWith(TEXT("?")))
+	{
+		return PagePath + Next;
+	}
+
+	if (Next.StartsWith(TEXT("/")))
+	{
+		// Keep the scheme and host of the page
+		const int32 SchemeEnd = PagePath.Find(TEXT("://"));
+		const int32 HostEnd = SchemeEnd == INDEX_NONE
+			? INDEX_NONE
+			: PagePath.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+		return (HostEnd == INDEX_NONE ? PagePath : PagePath.Left(HostEnd)) + Next;
+	}
+
+	return Next;
+}
+
+int32 FAccelBytePageIteratorBase::GetConfiguredMaxInFlight()
+{
+	int32 MaxInFlight = 2;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("PageMaxInFlightRequests"), MaxInFlight);
+	return MaxInFlight;
+}
+
+}
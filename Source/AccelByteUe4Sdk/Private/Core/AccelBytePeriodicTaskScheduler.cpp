@@ -0,0 +1,308 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelBytePeriodicTaskScheduler.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FAccelBytePeriodicTaskScheduler::FAccelBytePeriodicTaskScheduler()
+{
+}
+
+FAccelBytePeriodicTaskScheduler::~FAccelBytePeriodicTaskScheduler()
+{
+	TArray<FTaskRef> RemainingTasks;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Tasks.GenerateValueArray(RemainingTasks);
+		Tasks.Empty();
+	}
+
+	// Background runs capture the scheduler, they must be done before it's gone
+	for (FTaskRef const& Task : RemainingTasks)
+	{
+		Task->bRemoved = true;
+		while (Task->bRunning)
+		{
+			FPlatformProcess::Sleep(0.0f);
+		}
+	}
+
+	// Same as FAccelByteWebSocketLoop, the scheduler is a static that may be destroyed after the engine is gone
+	if (UObjectInitialized())
+	{
+		FScopeLock ScopeLock(&Lock);
+		StopTicker();
+	}
+}
+
+FAccelBytePeriodicTaskHandle FAccelBytePeriodicTaskScheduler::AddTask(FString const& Name
+	, FTickerDelegate const& Task
+	, float IntervalSeconds
+	, EAccelBytePeriodicTaskThread Thread)
+{
+	FAccelBytePeriodicTaskHandle Handle;
+	if (!Task.IsBound())
+	{
+		return Handle;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double Interval = FMath::Max(static_cast<double>(IntervalSeconds), 0.001);
+
+	FTaskRef NewTask = MakeShared<FTask, ESPMode::ThreadSafe>();
+	NewTask->Delegate = Task;
+	NewTask->LastRunTime = Now;
+	NewTask->Stats.Name = Name;
+	NewTask->Stats.IntervalSeconds = static_cast<float>(Interval);
+	NewTask->Stats.Thread = Thread;
+
+	// Phase-locked on the interval grid, tasks of the same or multiple intervals are due together whenever they're added
+	NewTask->GridTime = FMath::CeilToDouble((Now + Interval * 0.5) / Interval) * Interval;
+
+	FScopeLock ScopeLock(&Lock);
+
+	NewTask->Id = NextTaskId++;
+	NewTask->DueTime = AlignDueTime(NewTask->GridTime);
+	Tasks.Add(NewTask->Id, NewTask);
+	Handle.Id = NewTask->Id;
+
+	ArmTicker(Now);
+
+	return Handle;
+}
+
+void FAccelBytePeriodicTaskScheduler::RemoveTask(FAccelBytePeriodicTaskHandle& Handle)
+{
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+
+	TSharedPtr<FTask, ESPMode::ThreadSafe> Task;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FTaskRef const* Found = Tasks.Find(Handle.Id);
+		if (Found != nullptr)
+		{
+			Task = *Found;
+			Tasks.Remove(Handle.Id);
+		}
+	}
+	Handle.Reset();
+
+	if (!Task.IsValid())
+	{
+		return;
+	}
+
+	// The ticker is left armed, a wake with nothing due only re-arms it for the remaining tasks
+	Task->bRemoved = true;
+
+	// A background run removing its own task can't wait for itself
+	const uint32 CurrentThreadId = FPlatformTLS::GetCurrentThreadId();
+	while (Task->bRunning && Task->RunningThreadId != CurrentThreadId)
+	{
+		FPlatformProcess::Sleep(0.0f);
+	}
+}
+
+bool FAccelBytePeriodicTaskScheduler::IsTaskScheduled(FAccelBytePeriodicTaskHandle const& Handle) const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Handle.IsValid() && Tasks.Contains(Handle.Id);
+}
+
+TArray<FAccelBytePeriodicTaskStats> FAccelBytePeriodicTaskScheduler::GetTaskStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<FAccelBytePeriodicTaskStats> Result;
+	Result.Reserve(Tasks.Num());
+	for (auto const& Pair : Tasks)
+	{
+		Result.Add(Pair.Value->Stats);
+	}
+	return Result;
+}
+
+int64 FAccelBytePeriodicTaskScheduler::GetWakeCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return WakeCount;
+}
+
+bool FAccelBytePeriodicTaskScheduler::Tick(float DeltaTime)
+{
+	LoadConfig();
+
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<FTaskRef> DueTasks;
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		// This ticker is removed by returning false, the next wake is armed after the due tasks ran
+		TickerHandle.Reset();
+		ArmedDueTime = 0.0;
+		WakeCount++;
+
+		for (auto const& Pair : Tasks)
+		{
+			FTaskRef const& Task = Pair.Value;
+			if (Task->DueTime > Now)
+			{
+				continue;
+			}
+
+			// Runs missed while the game thread stalled are not caught up, the task stays on its grid
+			const double Interval = Task->Stats.IntervalSeconds;
+			Task->GridTime += (FMath::FloorToDouble((Now - Task->GridTime) / Interval) + 1.0) * Interval;
+			Task->DueTime = AlignDueTime(Task->GridTime);
+			DueTasks.Add(Task);
+		}
+	}
+
+	// Tasks add and remove tasks, e.g. to change their interval, so they run outside of the lock
+	for (FTaskRef const& Task : DueTasks)
+	{
+		RunTask(Task, Now);
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		ArmTicker(FPlatformTime::Seconds());
+	}
+
+	return false;
+}
+
+void FAccelBytePeriodicTaskScheduler::RunTask(FTaskRef const& Task, double Now)
+{
+	// Removed by a task that ran before it in the same wake, its owner may be gone already
+	if (Task->bRemoved)
+	{
+		return;
+	}
+
+	const float DeltaTime = static_cast<float>(Now - Task->LastRunTime);
+	Task->LastRunTime = Now;
+
+	if (Task->Stats.Thread == EAccelBytePeriodicTaskThread::GameThread)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const bool bKeep = Task->Delegate.Execute(DeltaTime);
+		RecordRun(Task, StartCycles, bKeep);
+		return;
+	}
+
+	if (Task->bRunning)
+	{
+		FScopeLock ScopeLock(&Lock);
+		Task->Stats.SkippedCount++;
+		return;
+	}
+
+	Task->bRunning = true;
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, Task, DeltaTime]()
+		{
+			if (!Task->bRemoved)
+			{
+				Task->RunningThreadId = FPlatformTLS::GetCurrentThreadId();
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				const bool bKeep = Task->Delegate.Execute(DeltaTime);
+				RecordRun(Task, StartCycles, bKeep);
+				Task->RunningThreadId = 0;
+			}
+			Task->bRunning = false;
+		});
+}
+
+void FAccelBytePeriodicTaskScheduler::RecordRun(FTaskRef const& Task, uint64 StartCycles, bool bKeep)
+{
+	const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	FScopeLock ScopeLock(&Lock);
+
+	FAccelBytePeriodicTaskStats& Stats = Task->Stats;
+	Stats.RunCount++;
+	Stats.TotalSeconds += Seconds;
+	Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, Seconds);
+
+	if (!bKeep)
+	{
+		Task->bRemoved = true;
+		Tasks.Remove(Task->Id);
+	}
+}
+
+double FAccelBytePeriodicTaskScheduler::AlignDueTime(double GridTime) const
+{
+	return FMath::CeilToDouble(GridTime / AlignmentSeconds) * AlignmentSeconds;
+}
+
+void FAccelBytePeriodicTaskScheduler::LoadConfig()
+{
+	// Not done in the constructor nor when adding a task, tasks are added while the registry statics are constructed,
+	// before the config is loaded
+	if (bIsConfigLoaded)
+	{
+		return;
+	}
+	bIsConfigLoaded = true;
+
+	int32 AlignmentMilliseconds = static_cast<int32>(AlignmentSeconds * 1000.0);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.PeriodicTasks"), TEXT("AlignmentMilliseconds"), AlignmentMilliseconds);
+
+	FScopeLock ScopeLock(&Lock);
+	AlignmentSeconds = FMath::Max(1, AlignmentMilliseconds) / 1000.0;
+}
+
+void FAccelBytePeriodicTaskScheduler::ArmTicker(double Now)
+{
+	double NextDueTime = 0.0;
+	bool bHasTask = false;
+	for (auto const& Pair : Tasks)
+	{
+		if (!bHasTask || Pair.Value->DueTime < NextDueTime)
+		{
+			NextDueTime = Pair.Value->DueTime;
+			bHasTask = true;
+		}
+	}
+
+	if (!bHasTask)
+	{
+		// Nothing left to run, the ticker is added back with the next task
+		return;
+	}
+
+	if (TickerHandle.IsValid() && ArmedDueTime <= NextDueTime)
+	{
+		return;
+	}
+
+	StopTicker();
+	TickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAccelBytePeriodicTaskScheduler::Tick)
+		, static_cast<float>(FMath::Max(NextDueTime - Now, 0.0)));
+	ArmedDueTime = NextDueTime;
+}
+
+void FAccelBytePeriodicTaskScheduler::StopTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	FTickerAlias::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+}
+
+}
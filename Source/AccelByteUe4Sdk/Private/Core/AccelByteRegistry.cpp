@@ -75,6 +75,10 @@ using namespace AccelByte;
 
 #pragma region Core
 FHttpRetryScheduler FRegistry::HttpRetryScheduler;
+// Defined before the messaging system, which adds its poll task when constructed
+FAccelBytePeriodicTaskScheduler FRegistry::PeriodicTaskScheduler;
+// Defined before the credentials so it's destroyed after them
+FAccelByteTokenRefreshScheduler FRegistry::TokenRefreshScheduler;
 FAccelByteMessagingSystemPtr FRegistry::MessagingSystem = MakeShared<FAccelByteMessagingSystem, ESPMode::ThreadSafe>();
 Settings FRegistry::Settings;
 FCredentialsRef FRegistry::CredentialsRef { MakeShared<AccelByte::Credentials, ESPMode::ThreadSafe>(*MessagingSystem.Get()) };
@@ -86,6 +90,11 @@ FAccelByteTimeManager FRegistry::TimeManager{ FRegistry::HttpRetryScheduler };
 FAccelByteNetworkConditioner FRegistry::NetworkConditioner;
 FAccelByteNotificationSender FRegistry::NotificationSender{*MessagingSystem.Get()};
 FHttpClient FRegistry::HttpClient{ Credentials, Settings, HttpRetryScheduler };
+FAccelByteMetricsRegistry FRegistry::MetricsRegistry;
+FAccelByteWebSocketLoop FRegistry::WebSocketLoop;
+FAccelByteDeviceIdentity FRegistry::DeviceIdentity;
+FAccelByteConnectionWarmup FRegistry::ConnectionWarmup;
+FAccelByteOfflineWriteQueue FRegistry::OfflineWriteQueue{ FRegistry::Credentials, FRegistry::HttpClient };
 #pragma endregion
 
 #pragma region Game Client Access
@@ -5,8 +5,260 @@
 #include "Core/AccelByteSQLite3.h"
 
 #ifdef SQLITE3_ENABLED
+#include "sqlite3.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "HAL/Event.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteSQLite3, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteSQLite3);
+
 namespace AccelByte
 {
+	/**
+	 * @brief Owns the connection used by the batch API and runs the batches one after another on its own thread.
+	 * The connection is opened in WAL mode and the prepared statements are kept for the lifetime of the connection,
+	 * so a batch only binds and steps the statements inside a single transaction.
+	 */
+	class FAccelByteSQLite3BatchWorker : public FRunnable
+	{
+	public:
+		using FJob = TFunction<void(FAccelByteSQLite3BatchWorker&)>;
+		using FBindRow = TFunctionRef<bool(sqlite3_stmt*, int32)>;
+
+		explicit FAccelByteSQLite3BatchWorker(const FString& InDatabasePath)
+			: DatabasePath(InDatabasePath)
+		{
+			WorkEvent = FPlatformProcess::GetSynchEventFromPool(false);
+			Thread = FRunnableThread::Create(this, TEXT("AccelByteSQLite3Batch"), 0, TPri_BelowNormal);
+		}
+
+		virtual ~FAccelByteSQLite3BatchWorker() override
+		{
+			if (Thread != nullptr)
+			{
+				Thread->Kill(true);
+				delete Thread;
+				Thread = nullptr;
+			}
+			else
+			{
+				// No thread to run the jobs, so they are run here to keep the result of the pending batches
+				RunPendingJobs();
+				Close();
+			}
+			FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		}
+
+		void Enqueue(FJob&& Job)
+		{
+			Jobs.Enqueue(MoveTemp(Job));
+			if (Thread != nullptr)
+			{
+				WorkEvent->Trigger();
+			}
+			else
+			{
+				RunPendingJobs();
+			}
+		}
+
+		virtual uint32 Run() override
+		{
+			while (!bStopRequested)
+			{
+				WorkEvent->Wait();
+				RunPendingJobs();
+			}
+			RunPendingJobs();
+			Close();
+			return 0;
+		}
+
+		virtual void Stop() override
+		{
+			bStopRequested = true;
+			WorkEvent->Trigger();
+		}
+
+		/**
+		 * @brief Run the statement on every row inside one transaction, rolled back if a row fails.
+		 */
+		bool RunBatch(const FString& TableName, const FString& Sql, int32 RowCount, FBindRow BindRow)
+		{
+			if (!Open() || !EnsureKeyValueTable(TableName))
+			{
+				return false;
+			}
+
+			sqlite3_stmt* Statement = GetStatement(Sql);
+			if (Statement == nullptr || !Execute(TEXT("BEGIN IMMEDIATE;")))
+			{
+				return false;
+			}
+
+			bool bSuccess = true;
+			for (int32 Index = 0; Index < RowCount && bSuccess; Index++)
+			{
+				bSuccess = BindRow(Statement, Index) && sqlite3_step(Statement) == SQLITE_DONE;
+				sqlite3_reset(Statement);
+				sqlite3_clear_bindings(Statement);
+			}
+
+			if (!bSuccess)
+			{
+				UE_LOG(LogAccelByteSQLite3, Warning, TEXT("Batch on %s failed: %s"), *TableName, UTF8_TO_TCHAR(sqlite3_errmsg(Database)));
+				Execute(TEXT("ROLLBACK;"));
+				return false;
+			}
+
+			// A failed COMMIT, e.g. SQLITE_BUSY, leaves the transaction open and every later BEGIN would fail
+			if (!Execute(TEXT("COMMIT;")))
+			{
+				Execute(TEXT("ROLLBACK;"));
+				return false;
+			}
+			return true;
+		}
+
+		static bool BindText(sqlite3_stmt* Statement, int32 Index, const FString& Value)
+		{
+			FTCHARToUTF8 Converted(*Value);
+			return sqlite3_bind_text(Statement, Index, Converted.Get(), Converted.Length(), SQLITE_TRANSIENT) == SQLITE_OK;
+		}
+
+		static bool BindBlob(sqlite3_stmt* Statement, int32 Index, const TArray<uint8>& Value)
+		{
+			return sqlite3_bind_blob(Statement, Index, Value.GetData(), Value.Num(), SQLITE_TRANSIENT) == SQLITE_OK;
+		}
+
+	private:
+		void RunPendingJobs()
+		{
+			FJob Job;
+			while (Jobs.Dequeue(Job))
+			{
+				Job(*this);
+			}
+		}
+
+		bool Open()
+		{
+			if (Database != nullptr)
+			{
+				return true;
+			}
+
+			if (sqlite3_open_v2(TCHAR_TO_UTF8(*DatabasePath), &Database, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK)
+			{
+				UE_LOG(LogAccelByteSQLite3, Warning, TEXT("Failed to open %s"), *DatabasePath);
+				Close();
+				return false;
+			}
+
+			// WAL lets the readers of the other connections go on while a batch is written, NORMAL only syncs on checkpoints
+			sqlite3_busy_timeout(Database, 5000);
+			Execute(TEXT("PRAGMA journal_mode=WAL;"));
+			Execute(TEXT("PRAGMA synchronous=NORMAL;"));
+			return true;
+		}
+
+		void Close()
+		{
+			for (auto& Entry : Statements)
+			{
+				sqlite3_finalize(Entry.Value);
+			}
+			Statements.Empty();
+			KnownTables.Empty();
+
+			if (Database != nullptr)
+			{
+				sqlite3_close(Database);
+				Database = nullptr;
+			}
+		}
+
+		bool Execute(const FString& Sql)
+		{
+			char* ErrorMessage = nullptr;
+			if (sqlite3_exec(Database, TCHAR_TO_UTF8(*Sql), nullptr, nullptr, &ErrorMessage) != SQLITE_OK)
+			{
+				UE_LOG(LogAccelByteSQLite3, Warning, TEXT("%s failed: %s"), *Sql, UTF8_TO_TCHAR(ErrorMessage));
+				sqlite3_free(ErrorMessage);
+				return false;
+			}
+			return true;
+		}
+
+		bool EnsureKeyValueTable(const FString& TableName)
+		{
+			if (KnownTables.Contains(TableName))
+			{
+				return true;
+			}
+
+			// Same layout as CreateKeyValuePairTable
+			if (!Execute(FString::Printf(TEXT("CREATE TABLE IF NOT EXISTS \"%s\" ('Key' TEXT UNIQUE NOT NULL PRIMARY KEY, 'Value' BLOB);"), *TableName)))
+			{
+				return false;
+			}
+			KnownTables.Add(TableName);
+			return true;
+		}
+
+		sqlite3_stmt* GetStatement(const FString& Sql)
+		{
+			if (sqlite3_stmt** Cached = Statements.Find(Sql))
+			{
+				return *Cached;
+			}
+
+			sqlite3_stmt* Statement = nullptr;
+			if (sqlite3_prepare_v2(Database, TCHAR_TO_UTF8(*Sql), -1, &Statement, nullptr) != SQLITE_OK)
+			{
+				UE_LOG(LogAccelByteSQLite3, Warning, TEXT("Failed to prepare %s: %s"), *Sql, UTF8_TO_TCHAR(sqlite3_errmsg(Database)));
+				return nullptr;
+			}
+			Statements.Add(Sql, Statement);
+			return Statement;
+		}
+
+		const FString DatabasePath;
+		sqlite3* Database {nullptr};
+		TMap<FString, sqlite3_stmt*> Statements;
+		TSet<FString> KnownTables;
+
+		TQueue<FJob, EQueueMode::Mpsc> Jobs;
+		FEvent* WorkEvent {nullptr};
+		FRunnableThread* Thread {nullptr};
+		FThreadSafeBool bStopRequested {false};
+	};
+
+	namespace
+	{
+		FString UpsertItemSql(const FString& TableName)
+		{
+			return FString::Printf(TEXT("INSERT OR REPLACE INTO \"%s\" ('Key', 'Value') VALUES (?1, ?2);"), *TableName);
+		}
+
+		FString DeleteItemSql(const FString& TableName)
+		{
+			return FString::Printf(TEXT("DELETE FROM \"%s\" WHERE Key = ?1;"), *TableName);
+		}
+
+		void ExecuteBatchDone(const THandler<bool>& OnDone, bool bSuccess)
+		{
+			AsyncTask(ENamedThreads::GameThread, [OnDone, bSuccess]()
+				{
+					OnDone.ExecuteIfBound(bSuccess);
+				});
+		}
+	}
+
 	bool FAccelByteSQLite3::OpenConnection(const FString& DBFileName)
 	{
 		if (USQLiteDatabase::IsValidDatabase(DBFileName, true))
@@ -27,7 +279,48 @@ namespace AccelByte
 	FAccelByteSQLite3::FAccelByteSQLite3(const FString& InDatabaseName)
 		: DatabaseName{InDatabaseName}
 	{
-		OpenConnection(FString::Printf(TEXT("%s.db"), *DatabaseName));
+		const FString DBFileName = FString::Printf(TEXT("%s.db"), *DatabaseName);
+		OpenConnection(DBFileName);
+		// RegisterDatabase is called relative to the project content directory
+		BatchWorker = MakeShared<FAccelByteSQLite3BatchWorker, ESPMode::ThreadSafe>(FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir() / DBFileName));
+	}
+
+	void FAccelByteSQLite3::SaveItems(const TArray<TPair<FString, TArray<uint8>>>& Items, const THandler<bool>& OnDone, const FString& TableName)
+	{
+		BatchWorker->Enqueue([Items, OnDone, TableName](FAccelByteSQLite3BatchWorker& Worker)
+			{
+				const bool bSuccess = Worker.RunBatch(TableName, UpsertItemSql(TableName), Items.Num(), [&Items](sqlite3_stmt* Statement, int32 Index)
+					{
+						return FAccelByteSQLite3BatchWorker::BindText(Statement, 1, Items[Index].Key)
+							&& FAccelByteSQLite3BatchWorker::BindBlob(Statement, 2, Items[Index].Value);
+					});
+				ExecuteBatchDone(OnDone, bSuccess);
+			});
+	}
+
+	void FAccelByteSQLite3::SaveItems(const TArray<TPair<FString, FString>>& Items, const THandler<bool>& OnDone, const FString& TableName)
+	{
+		BatchWorker->Enqueue([Items, OnDone, TableName](FAccelByteSQLite3BatchWorker& Worker)
+			{
+				const bool bSuccess = Worker.RunBatch(TableName, UpsertItemSql(TableName), Items.Num(), [&Items](sqlite3_stmt* Statement, int32 Index)
+					{
+						return FAccelByteSQLite3BatchWorker::BindText(Statement, 1, Items[Index].Key)
+							&& FAccelByteSQLite3BatchWorker::BindText(Statement, 2, Items[Index].Value);
+					});
+				ExecuteBatchDone(OnDone, bSuccess);
+			});
+	}
+
+	void FAccelByteSQLite3::DeleteItems(const TArray<FString>& Keys, const THandler<bool>& OnDone, const FString& TableName)
+	{
+		BatchWorker->Enqueue([Keys, OnDone, TableName](FAccelByteSQLite3BatchWorker& Worker)
+			{
+				const bool bSuccess = Worker.RunBatch(TableName, DeleteItemSql(TableName), Keys.Num(), [&Keys](sqlite3_stmt* Statement, int32 Index)
+					{
+						return FAccelByteSQLite3BatchWorker::BindText(Statement, 1, Keys[Index]);
+					});
+				ExecuteBatchDone(OnDone, bSuccess);
+			});
 	}
 
 	void FAccelByteSQLite3::CreateTable(const FString& TableName, UScriptStruct* ScriptStruct, const THandler<bool>& Result)
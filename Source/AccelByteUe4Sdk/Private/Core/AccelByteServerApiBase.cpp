@@ -14,6 +14,7 @@ FServerApiBase::FServerApiBase( ServerCredentials const& InCredentialsRef
 	, ServerSettingsRef{InSettingsRef}
 	, HttpRef{InHttpRef}
 	, HttpClient(InCredentialsRef, InSettingsRef, InHttpRef)
+	, HttpClientHandle(MakeShareable(&HttpClient, [](FHttpClient*) {}))
 {
 }
 
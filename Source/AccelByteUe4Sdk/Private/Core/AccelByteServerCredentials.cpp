@@ -32,6 +32,7 @@ void ServerCredentials::ForgetAll()
 {
 	BaseCredentials::ForgetAll();
 	AccessToken = FString();
+	FRegistry::TokenRefreshScheduler.Unschedule(this);
 }
 
 void ServerCredentials::SetClientCredentials(const ESettingsEnvironment Environment)
@@ -89,16 +90,6 @@ void ServerCredentials::SetClientToken(const FString& InAccessToken, double Expi
 	Namespace = InNamespace;
 	BackoffCount = 0;
 	SessionState = ESessionState::Valid;
-
-	if (!PollRefreshTokenHandle.IsValid()) {
-		PollRefreshTokenHandle = FTickerAlias::GetCoreTicker().AddTicker(
-			FTickerDelegate::CreateLambda([this](float DeltaTime)
-				{
-					PollRefreshToken(FPlatformTime::Seconds());
-					return true;
-				}),
-			0.2f);
-	}
 }
 
 void ServerCredentials::Startup()
@@ -109,17 +100,9 @@ void ServerCredentials::Startup()
 
 void ServerCredentials::Shutdown()
 {
-	RemoveFromTicker(PollRefreshTokenHandle);
+	FRegistry::TokenRefreshScheduler.Unschedule(this);
 }
 
-void ServerCredentials::RemoveFromTicker(FDelegateHandleAlias& handle)
-{
-	if (handle.IsValid())
-	{
-		FTickerAlias::GetCoreTicker().RemoveTicker(handle);
-		handle.Reset();
-	}
-}
 void ServerCredentials::PollRefreshToken(double CurrentTime)
 {
 	switch (SessionState)
@@ -133,6 +116,7 @@ void ServerCredentials::PollRefreshToken(double CurrentTime)
 					, THandler<FOauth2Token>::CreateLambda(
 						[this, CurrentTime](const FOauth2Token& Result)
 						{
+							FRegistry::TokenRefreshScheduler.NotifyRefreshFinished(this);
 							SessionState = ESessionState::Valid;
 							SetClientToken(Result.Access_token, Result.Expires_in, Result.Namespace);
 							TokenRefreshedEvent.Broadcast(true);
@@ -140,6 +124,7 @@ void ServerCredentials::PollRefreshToken(double CurrentTime)
 					, FErrorHandler::CreateLambda(
 						[&](int32 Code, const FString& Message) 
 						{ 
+							FRegistry::TokenRefreshScheduler.NotifyRefreshFinished(this);
 							BackoffCount++;
 							if (BackoffCount < MaxBackoffCount)
 							{
@@ -181,6 +166,7 @@ void ServerCredentials::PollRefreshToken(double CurrentTime)
 void ServerCredentials::ScheduleRefreshToken(double NextRefreshTime)
 {
 	RefreshTime = FPlatformTime::Seconds() + NextRefreshTime;
+	FRegistry::TokenRefreshScheduler.Schedule(AsShared(), RefreshTime);
 }
 
 void ServerCredentials::SetMatchId(const FString& GivenMatchId)
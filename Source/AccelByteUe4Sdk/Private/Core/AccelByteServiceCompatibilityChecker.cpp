@@ -0,0 +1,278 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteServiceCompatibilityChecker.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
+#include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteUtilities.h"
+#include "Core/IAccelByteDataStorage.h"
+
+namespace AccelByte
+{
+
+FAccelByteServiceCompatibilityChecker::FAccelByteServiceCompatibilityChecker(FString const& InBaseUrl, IAccelByteDataStorage* InStorage)
+	: BaseUrl(InBaseUrl)
+	// Results of another environment must not be reported, the key is specific to the base URL
+	, CacheKey(FString::Printf(TEXT("ServiceCompatibilityCache_%s"), *FMD5::HashAnsiString(*InBaseUrl)))
+	, Storage(InStorage)
+{
+	int32 ConfigCacheTtlSeconds = static_cast<int32>(CacheTtlSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Compatibility"), TEXT("CacheTtlSeconds"), ConfigCacheTtlSeconds);
+	CacheTtlSeconds = FMath::Max(0, ConfigCacheTtlSeconds);
+}
+
+FAccelByteServiceCompatibilityChecker::~FAccelByteServiceCompatibilityChecker()
+{
+	Shutdown();
+}
+
+bool FAccelByteServiceCompatibilityChecker::Initialize(FString const& CompatibilityMapPath)
+{
+	// The map is stored as UTF-16 with BOM, LoadFileToString takes care of the conversion
+	FString CompatibilityMapJson;
+	if (!FFileHelper::LoadFileToString(CompatibilityMapJson, *CompatibilityMapPath))
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("[Compatibility] Failed to load %s"), *CompatibilityMapPath);
+		return false;
+	}
+
+	CompatibilityMap = MakeShared<FServiceCompatibilityMap>(FServiceCompatibilityMap::FromJson(CompatibilityMapJson));
+
+	LoadCache();
+
+	return true;
+}
+
+void FAccelByteServiceCompatibilityChecker::OnCacheLoaded(FString const& CacheJson)
+{
+	TSharedPtr<FJsonObject> CacheObject;
+	if (!CacheJson.IsEmpty() && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(CacheJson), CacheObject) && CacheObject.IsValid())
+	{
+		for (auto const& Entry : CacheObject->Values)
+		{
+			TSharedPtr<FJsonObject> const* EntryObject = nullptr;
+			if (!Entry.Value->TryGetObject(EntryObject))
+			{
+				continue;
+			}
+
+			FCachedResult CachedResult;
+			(*EntryObject)->TryGetStringField(TEXT("version"), CachedResult.Version);
+			(*EntryObject)->TryGetStringField(TEXT("etag"), CachedResult.ETag);
+			(*EntryObject)->TryGetNumberField(TEXT("checkedAt"), CachedResult.CheckedAt);
+			CachedResults.Emplace(Entry.Key, CachedResult);
+		}
+	}
+
+	const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+	StaleServices.Reset();
+	for (FString const& ServiceName : CompatibilityMap->GetServices())
+	{
+		if (ServiceName.IsEmpty())
+		{
+			continue;
+		}
+
+		FCachedResult const* CachedResult = CachedResults.Find(ServiceName);
+		if (CachedResult != nullptr)
+		{
+			Report(ServiceName, CachedResult->Version);
+		}
+
+		if (CachedResult == nullptr || Now - CachedResult->CheckedAt >= CacheTtlSeconds)
+		{
+			StaleServices.Add(ServiceName);
+		}
+	}
+
+	bIsCacheLoaded = true;
+	if (PendingRevalidateDelaySeconds >= 0.0f)
+	{
+		RevalidateInBackground(PendingRevalidateDelaySeconds);
+		PendingRevalidateDelaySeconds = -1.0f;
+	}
+}
+
+void FAccelByteServiceCompatibilityChecker::RevalidateInBackground(float DelaySeconds)
+{
+	if (!bIsCacheLoaded)
+	{
+		PendingRevalidateDelaySeconds = DelaySeconds;
+		return;
+	}
+
+	if (StaleServices.Num() == 0 || DelayHandle.IsValid() || PendingRequestCount > 0)
+	{
+		return;
+	}
+
+	TWeakPtr<FAccelByteServiceCompatibilityChecker, ESPMode::ThreadSafe> CheckerWPtr = AsShared();
+	DelayHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[CheckerWPtr](float DeltaTime)
+		{
+			const auto CheckerPtr = CheckerWPtr.Pin();
+			if (CheckerPtr.IsValid())
+			{
+				CheckerPtr->DelayHandle.Reset();
+				CheckerPtr->RevalidateStale();
+			}
+			return false;
+		}), DelaySeconds);
+}
+
+void FAccelByteServiceCompatibilityChecker::Shutdown()
+{
+	StaleServices.Reset();
+	PendingRevalidateDelaySeconds = -1.0f;
+	if (DelayHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(DelayHandle);
+		DelayHandle.Reset();
+	}
+}
+
+void FAccelByteServiceCompatibilityChecker::LoadCache()
+{
+	if (Storage == nullptr)
+	{
+		OnCacheLoaded(FString());
+		return;
+	}
+
+	TWeakPtr<FAccelByteServiceCompatibilityChecker, ESPMode::ThreadSafe> CheckerWPtr = AsShared();
+	Storage->GetItem(CacheKey
+		, THandler<TPair<FString, FString>>::CreateLambda([CheckerWPtr](TPair<FString, FString> const& Item)
+			{
+				const auto CheckerPtr = CheckerWPtr.Pin();
+				if (CheckerPtr.IsValid())
+				{
+					CheckerPtr->OnCacheLoaded(Item.Value);
+				}
+			})
+		, FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+}
+
+void FAccelByteServiceCompatibilityChecker::SaveCache()
+{
+	if (Storage == nullptr || !bCacheDirty)
+	{
+		return;
+	}
+
+	TSharedRef<FJsonObject> CacheObject = MakeShared<FJsonObject>();
+	for (auto const& Entry : CachedResults)
+	{
+		TSharedRef<FJsonObject> EntryObject = MakeShared<FJsonObject>();
+		EntryObject->SetStringField(TEXT("version"), Entry.Value.Version);
+		EntryObject->SetStringField(TEXT("etag"), Entry.Value.ETag);
+		EntryObject->SetNumberField(TEXT("checkedAt"), static_cast<double>(Entry.Value.CheckedAt));
+		CacheObject->SetObjectField(Entry.Key, EntryObject);
+	}
+
+	FString CacheJson;
+	FJsonSerializer::Serialize(CacheObject, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CacheJson));
+
+	Storage->SaveItem(CacheKey, CacheJson, THandler<bool>(), FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+	bCacheDirty = false;
+}
+
+void FAccelByteServiceCompatibilityChecker::Report(FString const& ServiceName, FString const& Version) const
+{
+	FResult const Result = CompatibilityMap->Check(ServiceName, Version, true);
+	if (Result.bIsError)
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("[Compatibility] %s"), *Result.Message);
+	}
+}
+
+void FAccelByteServiceCompatibilityChecker::RevalidateStale()
+{
+	// The services are independent, every version is requested at once and the responses are counted down on the game thread
+	TArray<FString> ServiceNames = MoveTemp(StaleServices);
+	StaleServices.Reset();
+	PendingRequestCount += ServiceNames.Num();
+	for (FString const& ServiceName : ServiceNames)
+	{
+		SendVersionRequest(ServiceName);
+	}
+}
+
+void FAccelByteServiceCompatibilityChecker::SendVersionRequest(FString const& ServiceName)
+{
+	FHttpRequestPtr const Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb(TEXT("GET"));
+	Request->SetURL(FString::Printf(TEXT("%s/version"), *(BaseUrl / ServiceName)));
+	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	if (FCachedResult const* CachedResult = CachedResults.Find(ServiceName))
+	{
+		if (!CachedResult->ETag.IsEmpty())
+		{
+			Request->SetHeader(TEXT("If-None-Match"), CachedResult->ETag);
+		}
+	}
+
+	TWeakPtr<FAccelByteServiceCompatibilityChecker, ESPMode::ThreadSafe> CheckerWPtr = AsShared();
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request
+		, FHttpRequestCompleteDelegate::CreateLambda(
+			[CheckerWPtr, ServiceName](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bFinished)
+			{
+				const auto CheckerPtr = CheckerWPtr.Pin();
+				if (CheckerPtr.IsValid())
+				{
+					CheckerPtr->OnVersionReceived(ServiceName, ResponsePtr, bFinished);
+				}
+			})
+		, FPlatformTime::Seconds());
+}
+
+void FAccelByteServiceCompatibilityChecker::OnVersionReceived(FString const& ServiceName, FHttpResponsePtr Response, bool bFinished)
+{
+	if (!bFinished || !Response.IsValid())
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("[Compatibility] Getting version info failed: %s"), *ServiceName);
+	}
+	else if (Response->GetResponseCode() == EHttpResponseCodes::NotModified)
+	{
+		FCachedResult& CachedResult = CachedResults.FindOrAdd(ServiceName);
+		CachedResult.CheckedAt = FDateTime::UtcNow().ToUnixTimestamp();
+		bCacheDirty = true;
+	}
+	else if (EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		FVersionInfo VersionInfo;
+		FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &VersionInfo, 0, 0);
+
+		FCachedResult& CachedResult = CachedResults.FindOrAdd(ServiceName);
+		const bool bVersionChanged = CachedResult.Version != VersionInfo.Version;
+		CachedResult.Version = VersionInfo.Version;
+		CachedResult.ETag = Response->GetHeader(TEXT("ETag"));
+		CachedResult.CheckedAt = FDateTime::UtcNow().ToUnixTimestamp();
+		bCacheDirty = true;
+
+		// Cached versions were already reported on startup
+		if (bVersionChanged)
+		{
+			Report(ServiceName, VersionInfo.Version);
+		}
+	}
+	else
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("[Compatibility] Getting version info failed: %s, code %d"), *ServiceName, Response->GetResponseCode());
+	}
+
+	PendingRequestCount--;
+	if (PendingRequestCount <= 0)
+	{
+		PendingRequestCount = 0;
+		SaveCache();
+	}
+}
+
+}
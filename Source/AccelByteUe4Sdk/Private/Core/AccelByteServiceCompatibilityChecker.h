@@ -0,0 +1,84 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Core/AccelByteDefines.h"
+#include "Core/Version.h"
+
+namespace AccelByte
+{
+class IAccelByteDataStorage;
+
+/**
+ * @brief Checks the backend service versions against the plugin CompatibilityMap.json.
+ * The map is parsed once, the last known version of every service is kept with its ETag in the local data storage,
+ * and only results older than the TTL are revalidated. Revalidation runs in the background after a delay, the version
+ * of every stale service is requested at once through the HTTP retry scheduler and the cache is saved when the last
+ * response arrives, so it stays out of the startup critical path.
+ * The cached results are kept per base URL, the versions of another environment are never reported.
+ */
+class FAccelByteServiceCompatibilityChecker
+	: public TSharedFromThis<FAccelByteServiceCompatibilityChecker, ESPMode::ThreadSafe>
+{
+public:
+	FAccelByteServiceCompatibilityChecker(FString const& InBaseUrl, IAccelByteDataStorage* InStorage);
+	~FAccelByteServiceCompatibilityChecker();
+
+	/**
+	 * @brief Load the compatibility map and the cached results, then report the cached results without any request.
+	 * The cached results are reported once the local data storage has answered, which may be after this returns.
+	 *
+	 * @param CompatibilityMapPath Path of CompatibilityMap.json.
+	 * @return false if the map can't be loaded.
+	 */
+	bool Initialize(FString const& CompatibilityMapPath);
+
+	/**
+	 * @brief Schedule the revalidation of the stale results, once the cached results are loaded.
+	 *
+	 * @param DelaySeconds Delay before the requests are sent.
+	 */
+	void RevalidateInBackground(float DelaySeconds);
+
+	/**
+	 * @brief Stop the pending revalidation.
+	 */
+	void Shutdown();
+
+private:
+	struct FCachedResult
+	{
+		FString Version;
+		FString ETag;
+		int64 CheckedAt {0};
+	};
+
+	void LoadCache();
+	void OnCacheLoaded(FString const& CacheJson);
+	void SaveCache();
+	void Report(FString const& ServiceName, FString const& Version) const;
+	void RevalidateStale();
+	void SendVersionRequest(FString const& ServiceName);
+	void OnVersionReceived(FString const& ServiceName, FHttpResponsePtr Response, bool bFinished);
+
+	FString const BaseUrl;
+	FString const CacheKey;
+	IAccelByteDataStorage* Storage;
+	TSharedPtr<FServiceCompatibilityMap> CompatibilityMap;
+	TMap<FString, FCachedResult> CachedResults;
+	TArray<FString> StaleServices;
+	int32 PendingRequestCount {0};
+	int64 CacheTtlSeconds {24 * 60 * 60};
+	bool bCacheDirty {false};
+	bool bIsCacheLoaded {false};
+	float PendingRevalidateDelaySeconds {-1.0f};
+	FDelegateHandleAlias DelayHandle;
+};
+
+typedef TSharedPtr<FAccelByteServiceCompatibilityChecker, ESPMode::ThreadSafe> FAccelByteServiceCompatibilityCheckerPtr;
+
+}
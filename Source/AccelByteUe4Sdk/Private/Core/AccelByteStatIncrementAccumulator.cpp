@@ -0,0 +1,409 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteStatIncrementAccumulator.h"
+#include "AccelByteUe4SdkModule.h"
+#include "JsonObjectConverter.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteUtilities.h"
+#include "Core/IAccelByteDataStorage.h"
+
+namespace AccelByte
+{
+
+FAccelByteStatIncrementAccumulator::FAccelByteStatIncrementAccumulator(FString const& InStorageKey, FFlushRequest InFlushRequest)
+	: StorageKey(InStorageKey)
+	, FlushRequest(MoveTemp(InFlushRequest))
+{
+	int32 ConfigFlushIntervalSeconds = static_cast<int32>(FlushIntervalSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Statistic"), TEXT("IncrementFlushIntervalSeconds"), ConfigFlushIntervalSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Statistic"), TEXT("IncrementFlushThreshold"), FlushThreshold);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Statistic"), TEXT("IncrementPersistDelaySeconds"), PersistDelaySeconds);
+	FlushIntervalSeconds = FMath::Max(1, ConfigFlushIntervalSeconds);
+	FlushThreshold = FMath::Max(1, FlushThreshold);
+	PersistDelaySeconds = FMath::Max(0.0f, PersistDelaySeconds);
+}
+
+FAccelByteStatIncrementAccumulator::~FAccelByteStatIncrementAccumulator()
+{
+	Shutdown();
+}
+
+void FAccelByteStatIncrementAccumulator::Startup()
+{
+	TWeakPtr<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe> AccumulatorWPtr = AsShared();
+
+	IAccelByteDataStorage* Storage = IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage();
+	if (Storage != nullptr)
+	{
+		Storage->GetItem(StorageKey
+			, THandler<TPair<FString, FString>>::CreateLambda([AccumulatorWPtr](TPair<FString, FString> const& Item)
+				{
+					const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+					if (AccumulatorPtr.IsValid())
+					{
+						AccumulatorPtr->OnPersistedLoaded(Item.Value);
+					}
+				})
+			, FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+	}
+	else
+	{
+		OnPersistedLoaded(FString());
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[AccumulatorWPtr](float DeltaTime)
+			{
+				const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+				return AccumulatorPtr.IsValid() && AccumulatorPtr->Tick(DeltaTime);
+			}), FlushIntervalSeconds);
+	}
+}
+
+void FAccelByteStatIncrementAccumulator::Shutdown()
+{
+	if (!UObjectInitialized())
+	{
+		return;
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	bool bWasPersistScheduled = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bWasPersistScheduled = bIsPersistScheduled;
+		bIsPersistScheduled = false;
+	}
+	if (PersistTickerHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(PersistTickerHandle);
+		PersistTickerHandle.Reset();
+	}
+	if (bWasPersistScheduled)
+	{
+		Persist();
+	}
+}
+
+void FAccelByteStatIncrementAccumulator::Add(FString const& UserId, FString const& StatCode, float Inc)
+{
+	if (UserId.IsEmpty() || StatCode.IsEmpty())
+	{
+		return;
+	}
+
+	bool bThresholdReached = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FAccelByteModelsBulkUserStatItemInc Increment;
+		Increment.userId = UserId;
+		Increment.statCode = StatCode;
+		Increment.inc = Inc;
+		AddLocked(Increment);
+		bThresholdReached = PendingIncrements.Num() >= FlushThreshold;
+	}
+
+	SchedulePersist();
+
+	if (bThresholdReached)
+	{
+		SendPending();
+	}
+}
+
+void FAccelByteStatIncrementAccumulator::Flush(THandler<bool> const& OnDone)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		FlushWaiters.Add(OnDone);
+	}
+	SendPending();
+}
+
+int32 FAccelByteStatIncrementAccumulator::GetPendingCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PendingIncrements.Num();
+}
+
+FString FAccelByteStatIncrementAccumulator::MakeEntryKey(FString const& UserId, FString const& StatCode)
+{
+	return UserId + TEXT("/") + StatCode;
+}
+
+bool FAccelByteStatIncrementAccumulator::IsRetriable(int32 ErrorCode)
+{
+	// The backend rejected the content, sending the same increments again would fail the same way
+	return ErrorCode != static_cast<int32>(ErrorCodes::StatusBadRequest)
+		&& ErrorCode != static_cast<int32>(ErrorCodes::StatusNotFound)
+		&& ErrorCode != static_cast<int32>(ErrorCodes::StatusUnprocessableEntity);
+}
+
+void FAccelByteStatIncrementAccumulator::AddLocked(FAccelByteModelsBulkUserStatItemInc const& Increment)
+{
+	FAccelByteModelsBulkUserStatItemInc& Pending = PendingIncrements.FindOrAdd(MakeEntryKey(Increment.userId, Increment.statCode));
+	Pending.userId = Increment.userId;
+	Pending.statCode = Increment.statCode;
+	Pending.inc += Increment.inc;
+}
+
+void FAccelByteStatIncrementAccumulator::SendPending()
+{
+	TArray<FAccelByteModelsBulkUserStatItemInc> Increments;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bIsSending)
+		{
+			bSendAgain = true;
+			return;
+		}
+		if (PendingIncrements.Num() == 0)
+		{
+			ScopeLock.Unlock();
+			CompleteFlush(true);
+			return;
+		}
+
+		PendingIncrements.GenerateValueArray(Increments);
+		PendingIncrements.Empty();
+		InFlightIncrements = Increments;
+		bIsSending = true;
+		bSendAgain = false;
+	}
+
+	FReport::Log(FString(__FUNCTION__));
+
+	TWeakPtr<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe> AccumulatorWPtr = AsShared();
+	FlushRequest(Increments
+		, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>>::CreateLambda(
+			[AccumulatorWPtr](TArray<FAccelByteModelsBulkStatItemOperationResult> const& Results)
+			{
+				const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+				if (AccumulatorPtr.IsValid())
+				{
+					AccumulatorPtr->OnSent(Results);
+				}
+			})
+		, FErrorHandler::CreateLambda(
+			[AccumulatorWPtr](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+				if (AccumulatorPtr.IsValid())
+				{
+					AccumulatorPtr->OnSendFailed(ErrorCode, ErrorMessage);
+				}
+			}));
+}
+
+void FAccelByteStatIncrementAccumulator::OnSent(TArray<FAccelByteModelsBulkStatItemOperationResult> const& Results)
+{
+	for (FAccelByteModelsBulkStatItemOperationResult const& Result : Results)
+	{
+		if (!Result.Success)
+		{
+			UE_LOG(LogAccelByte, Warning, TEXT("Stat item increment rejected, user %s stat code %s"), *Result.UserId, *Result.StatCode);
+		}
+	}
+
+	bool bShouldSendAgain = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		InFlightIncrements.Empty();
+		bIsSending = false;
+		bShouldSendAgain = bSendAgain && PendingIncrements.Num() > 0;
+	}
+
+	Persist();
+
+	if (bShouldSendAgain)
+	{
+		SendPending();
+	}
+	else
+	{
+		CompleteFlush(true);
+	}
+}
+
+void FAccelByteStatIncrementAccumulator::OnSendFailed(int32 ErrorCode, FString const& ErrorMessage)
+{
+	const bool bRetriable = IsRetriable(ErrorCode);
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bRetriable)
+		{
+			// Increments queued meanwhile are merged with the ones that failed, sent together on the next flush
+			for (FAccelByteModelsBulkUserStatItemInc const& Increment : InFlightIncrements)
+			{
+				AddLocked(Increment);
+			}
+		}
+		InFlightIncrements.Empty();
+		bIsSending = false;
+		bSendAgain = false;
+	}
+
+	if (bRetriable)
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Sending stat item increments failed, retrying on the next flush. Error %d: %s"), ErrorCode, *ErrorMessage);
+	}
+	else
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Stat item increments rejected, dropping them. Error %d: %s"), ErrorCode, *ErrorMessage);
+	}
+
+	Persist();
+	CompleteFlush(false);
+}
+
+void FAccelByteStatIncrementAccumulator::CompleteFlush(bool bSucceeded)
+{
+	TArray<THandler<bool>> Waiters;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Waiters = MoveTemp(FlushWaiters);
+		FlushWaiters.Reset();
+	}
+
+	for (THandler<bool> const& Waiter : Waiters)
+	{
+		Waiter.ExecuteIfBound(bSucceeded);
+	}
+}
+
+void FAccelByteStatIncrementAccumulator::OnPersistedLoaded(FString const& PersistedJson)
+{
+	TArray<TSharedPtr<FJsonValue>> PersistedArray;
+	if (!PersistedJson.IsEmpty() && !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(PersistedJson), PersistedArray))
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Persisted stat item increments of %s can't be parsed, dropping them"), *StorageKey);
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bIsLoaded)
+		{
+			return;
+		}
+
+		// Increments queued while the storage was read are kept, the persisted ones are merged into them
+		for (TSharedPtr<FJsonValue> const& Value : PersistedArray)
+		{
+			TSharedPtr<FJsonObject> const* Object = nullptr;
+			FAccelByteModelsBulkUserStatItemInc Increment;
+			if (Value.IsValid() && Value->TryGetObject(Object)
+				&& FJsonObjectConverter::JsonObjectToUStruct(Object->ToSharedRef(), &Increment, 0, 0))
+			{
+				AddLocked(Increment);
+			}
+		}
+		bIsLoaded = true;
+	}
+
+	Persist();
+
+	// The storage may answer on any thread, and on login the credentials are only set once the broadcast returns
+	TWeakPtr<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe> AccumulatorWPtr = AsShared();
+	AsyncTask(ENamedThreads::GameThread, [AccumulatorWPtr]()
+		{
+			const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+			if (AccumulatorPtr.IsValid() && AccumulatorPtr->GetPendingCount() > 0)
+			{
+				AccumulatorPtr->SendPending();
+			}
+		});
+}
+
+void FAccelByteStatIncrementAccumulator::SchedulePersist()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (bIsPersistScheduled)
+		{
+			return;
+		}
+		bIsPersistScheduled = true;
+	}
+
+	TWeakPtr<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe> AccumulatorWPtr = AsShared();
+	AsyncTask(ENamedThreads::GameThread, [AccumulatorWPtr]()
+		{
+			const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+			if (!AccumulatorPtr.IsValid())
+			{
+				return;
+			}
+
+			AccumulatorPtr->PersistTickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+				[AccumulatorWPtr](float DeltaTime)
+				{
+					const auto AccumulatorPtr = AccumulatorWPtr.Pin();
+					if (AccumulatorPtr.IsValid())
+					{
+						AccumulatorPtr->PersistTickerHandle.Reset();
+						{
+							FScopeLock ScopeLock(&AccumulatorPtr->Lock);
+							AccumulatorPtr->bIsPersistScheduled = false;
+						}
+						AccumulatorPtr->Persist();
+					}
+					return false;
+				}), AccumulatorPtr->PersistDelaySeconds);
+		});
+}
+
+void FAccelByteStatIncrementAccumulator::Persist()
+{
+	IAccelByteDataStorage* Storage = IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage();
+	if (Storage == nullptr)
+	{
+		return;
+	}
+
+	// In flight increments are persisted too, they are only gone once the backend confirmed them
+	TArray<TSharedPtr<FJsonValue>> PersistedArray;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bIsLoaded)
+		{
+			// Written by OnPersistedLoaded once the previous increments are merged
+			return;
+		}
+
+		for (auto const& Entry : PendingIncrements)
+		{
+			PersistedArray.Add(MakeShared<FJsonValueObject>(FJsonObjectConverter::UStructToJsonObject(Entry.Value)));
+		}
+		for (FAccelByteModelsBulkUserStatItemInc const& Increment : InFlightIncrements)
+		{
+			PersistedArray.Add(MakeShared<FJsonValueObject>(FJsonObjectConverter::UStructToJsonObject(Increment)));
+		}
+	}
+
+	FString PersistedJson;
+	FJsonSerializer::Serialize(PersistedArray, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&PersistedJson));
+
+	Storage->SaveItem(StorageKey, PersistedJson, THandler<bool>(), FAccelByteUtilities::GetCacheFilenameGeneralPurpose());
+}
+
+bool FAccelByteStatIncrementAccumulator::Tick(float DeltaTime)
+{
+	if (GetPendingCount() > 0)
+	{
+		SendPending();
+	}
+	return true;
+}
+
+}
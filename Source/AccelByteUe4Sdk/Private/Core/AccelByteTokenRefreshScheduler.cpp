@@ -0,0 +1,160 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteTokenRefreshScheduler.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+FAccelByteTokenRefreshScheduler::FAccelByteTokenRefreshScheduler()
+{
+}
+
+FAccelByteTokenRefreshScheduler::~FAccelByteTokenRefreshScheduler()
+{
+	// Same as FAccelByteWebSocketLoop, the scheduler is a static that may be destroyed after the engine is gone
+	if (UObjectInitialized())
+	{
+		FScopeLock ScopeLock(&Lock);
+		StopTicker();
+	}
+}
+
+void FAccelByteTokenRefreshScheduler::Schedule(FBaseCredentialsRef const& Credentials, double RefreshTime)
+{
+	LoadConfig();
+
+	const double Now = FPlatformTime::Seconds();
+	const double Remaining = RefreshTime - Now;
+
+	// Refreshes needed right away, e.g. after a rejected bearer token, are not delayed
+	double Jitter = 0.0;
+	if (Remaining > 1.0 && MaxJitterSeconds > 0.0)
+	{
+		Jitter = FMath::FRandRange(0.0, FMath::Min(MaxJitterSeconds, Remaining * 0.1));
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	BaseCredentials const* Key = &Credentials.Get();
+	const uint64 Generation = NextGeneration++;
+	Generations.Add(Key, Generation);
+	Heap.HeapPush(FEntry{ RefreshTime + Jitter, Generation, Credentials, Key });
+
+	StartTicker();
+}
+
+void FAccelByteTokenRefreshScheduler::Unschedule(BaseCredentials const* Credentials)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	// The heap entry stays until it's due, without its generation it's skipped
+	Generations.Remove(Credentials);
+	InFlight.Remove(Credentials);
+}
+
+void FAccelByteTokenRefreshScheduler::NotifyRefreshFinished(BaseCredentials const* Credentials)
+{
+	FScopeLock ScopeLock(&Lock);
+	InFlight.Remove(Credentials);
+}
+
+int32 FAccelByteTokenRefreshScheduler::GetScheduledCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Generations.Num();
+}
+
+bool FAccelByteTokenRefreshScheduler::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<TSharedPtr<BaseCredentials, ESPMode::ThreadSafe>> DueCredentials;
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (Heap.Num() == 0)
+		{
+			// Nothing left to refresh, the ticker is added back on the next schedule
+			TickerHandle.Reset();
+			return false;
+		}
+
+		while (Heap.Num() > 0 && Heap.HeapTop().DueTime <= Now && InFlight.Num() < MaxConcurrentRefreshes)
+		{
+			FEntry Entry;
+			Heap.HeapPop(Entry);
+
+			uint64 const* Generation = Generations.Find(Entry.Key);
+			if (Generation == nullptr || *Generation != Entry.Generation)
+			{
+				continue;
+			}
+			Generations.Remove(Entry.Key);
+
+			auto CredentialsPtr = Entry.Credentials.Pin();
+			if (!CredentialsPtr.IsValid())
+			{
+				continue;
+			}
+
+			InFlight.Add(Entry.Key);
+			DueCredentials.Add(CredentialsPtr);
+		}
+	}
+
+	// Credentials schedule their next refresh from PollRefreshToken and its callbacks, so it's done outside of the lock
+	for (auto const& CredentialsPtr : DueCredentials)
+	{
+		CredentialsPtr->PollRefreshToken(Now);
+
+		if (CredentialsPtr->GetSessionState() != BaseCredentials::ESessionState::Refreshing)
+		{
+			// No request was sent, or it already completed
+			NotifyRefreshFinished(CredentialsPtr.Get());
+		}
+	}
+
+	return true;
+}
+
+void FAccelByteTokenRefreshScheduler::LoadConfig()
+{
+	// Not done in the constructor, the config is not loaded yet when the registry statics are constructed
+	if (bIsConfigLoaded)
+	{
+		return;
+	}
+	bIsConfigLoaded = true;
+
+	int32 ConfigMaxJitterSeconds = static_cast<int32>(MaxJitterSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Credentials"), TEXT("TokenRefreshMaxJitterSeconds"), ConfigMaxJitterSeconds);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Credentials"), TEXT("MaxConcurrentTokenRefreshes"), MaxConcurrentRefreshes);
+	MaxJitterSeconds = FMath::Max(0, ConfigMaxJitterSeconds);
+	MaxConcurrentRefreshes = FMath::Max(1, MaxConcurrentRefreshes);
+}
+
+void FAccelByteTokenRefreshScheduler::StartTicker()
+{
+	if (TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	TickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAccelByteTokenRefreshScheduler::Tick), 0.2f);
+}
+
+void FAccelByteTokenRefreshScheduler::StopTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	FTickerAlias::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+}
+
+}
@@ -691,27 +691,60 @@ EAccelByteDevModeDeviceIdMethod FAccelByteUtilities::GetCurrentDeviceIdOverrideM
 }
 
 FString FAccelByteUtilities::GetDeviceId(bool bIsDeviceIdRequireEncode)
+{
+	return FRegistry::DeviceIdentity.GetDeviceId(bIsDeviceIdRequireEncode);
+}
+
+void FAccelByteUtilities::ResetDeviceId()
+{
+	FRegistry::DeviceIdentity.InvalidateDeviceId();
+
+	IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->DeleteItem(AccelByteStoredKeyDeviceId()
+		, FVoidHandler::CreateLambda([]()
+			{
+				// A DeviceID computed while the item was being deleted may still be the old one
+				FRegistry::DeviceIdentity.InvalidateDeviceId();
+			})
+		, GetCacheFilenameGeneralPurpose());
+}
+
+FString FAccelByteUtilities::ComputeDeviceId()
 {
 	FString Output = FString();
 
 	FString PlatformDeviceId = FPlatformMisc::GetDeviceId();
 	if (PlatformDeviceId.IsEmpty())
 	{
-		bool bIsCached = false;
+		// The state is shared with the handler, an asynchronous storage may answer after this function has returned
+		struct FStoredDeviceId
+		{
+			FString Value;
+			bool bIsAnswered {false};
+		};
+		TSharedRef<FStoredDeviceId, ESPMode::ThreadSafe> StoredDeviceId = MakeShared<FStoredDeviceId, ESPMode::ThreadSafe>();
 		IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->GetItem(AccelByteStoredKeyDeviceId()
 			, THandler<TPair<FString, FString>>::CreateLambda(
-				[&Output, &bIsCached](TPair<FString, FString> SavedDeviceId)
+				[StoredDeviceId](TPair<FString, FString> SavedDeviceId)
 				{
+					StoredDeviceId->bIsAnswered = true;
 					if (SavedDeviceId.Key.IsEmpty() || SavedDeviceId.Value.IsEmpty())
 					{
 						return;
 					}
-					Output = SavedDeviceId.Value;
-					bIsCached = true;
-
+					StoredDeviceId->Value = SavedDeviceId.Value;
 				})
 			, GetCacheFilenameGeneralPurpose());
-		if (!bIsCached)
+		if (!StoredDeviceId->bIsAnswered)
+		{
+			// The storage file isn't loaded yet, a DeviceID may be stored in it and must not be overwritten
+			UE_LOG(LogAccelByte, Warning, TEXT("Stored DeviceID is not loaded yet, using a temporary DeviceID."));
+			Output = FGuid::NewGuid().ToString();
+		}
+		else if (!StoredDeviceId->Value.IsEmpty())
+		{
+			Output = StoredDeviceId->Value;
+		}
+		else
 		{
 			FString PlainMacAddress = GetMacAddress(false);
 			if (PlainMacAddress.IsEmpty())
@@ -739,11 +772,6 @@ FString FAccelByteUtilities::GetDeviceId(bool bIsDeviceIdRequireEncode)
 	{
 		Output = GetDevModeDeviceId(Output);
 	}
-
-	if (bIsDeviceIdRequireEncode || !bIsClientDevMode)
-	{
-		Output = EncodeHMACBase64(Output, FRegistry::Settings.PublisherNamespace);
-	}
 	return Output;
 }
 
@@ -866,9 +894,7 @@ FString FAccelByteUtilities::GetMacAddress(bool bEncoded)
 
 FString FAccelByteUtilities::GetPlatformName()
 {
-	FString PlatformName = TEXT("");
-	PlatformName = UGameplayStatics::GetPlatformName();
-	return PlatformName;
+	return FRegistry::DeviceIdentity.GetPlatformName();
 }
 
 FString FAccelByteUtilities::XOR(FString const& Input
@@ -895,9 +921,7 @@ FString FAccelByteUtilities::XOR(FString const& Input
 
 FString FAccelByteUtilities::GetAuthTrustId()
 { 
-	FString AuthTrustId{};
-	FPlatformMisc::GetStoredValue(AccelByteStored(), AccelByteStoredSectionIAM(), AccelByteStoredKeyAuthTrustId(), AuthTrustId);
-	return AuthTrustId;
+	return FRegistry::DeviceIdentity.GetAuthTrustId();
 }
 
 bool FAccelByteUtilities::GetValueFromCommandLineSwitch(FString const& Key
@@ -1067,7 +1091,7 @@ bool FAccelByteUtilities::LoadABConfigFallback(const FString& Section, const FSt
 
 void FAccelByteUtilities::SetAuthTrustId(FString const& AuthTrustId)
 { 
-	FPlatformMisc::SetStoredValue(AccelByteStored(), AccelByteStoredSectionIAM(), AccelByteStoredKeyAuthTrustId(), AuthTrustId);
+	FRegistry::DeviceIdentity.SetAuthTrustId(AuthTrustId);
 }
 
 const FString AuthorizationCodeArgument = TEXT("--AB_AUTH_CODE=");
@@ -1098,13 +1122,7 @@ bool FAccelByteUtilities::IsUsingExchangeCode()
 
 FString FAccelByteUtilities::GetFlightId()
 {
-	static FString FlightId{};
-
-	if (FlightId.IsEmpty())
-	{
-		FlightId = FGuid::NewGuid().ToString().ToLower();
-	}
-	return FlightId;
+	return FRegistry::DeviceIdentity.GetFlightId();
 }
 
 void FAccelByteNetUtilities::GetPublicIP(THandler<FAccelByteModelsPubIp> const& OnSuccess
@@ -6,12 +6,15 @@
 #include "WebSocketsModule.h"
 #include "Core/IWebSocketFactory.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteMetricsRegistry.h"
+#include "Core/AccelByteWebSocketLoop.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteServerCredentials.h"
 #include "Core/AccelByteCredentials.h"
 #include "Core/AccelByteUtilities.h"
 #include "Core/AccelByteWebSocketErrorTypes.h"
 #include "Logging/AccelByteServiceLogger.h"
+#include "Async/Async.h"
 
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWebsocket, Log, All);
@@ -19,6 +22,8 @@ DEFINE_LOG_CATEGORY(LogAccelByteWebsocket);
 
 namespace AccelByte
 {	
+const FString AccelByteWebSocket::ReceiveToDispatchLatencyName = TEXT("WebSocket.ReceiveToDispatch");
+
 AccelByteWebSocket::AccelByteWebSocket(
 	const Credentials& Credentials,
 	float PingDelay,
@@ -33,8 +38,6 @@ AccelByteWebSocket::AccelByteWebSocket(
 	, WsState(EWebSocketState::Closed)
 	, WsEvents(EWebSocketEvent::None)
 {
-	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::Tick);
-	TickerDelegateHandle.Reset();
 }
 
 AccelByteWebSocket::AccelByteWebSocket(
@@ -51,8 +54,6 @@ AccelByteWebSocket::AccelByteWebSocket(
 	, WsState(EWebSocketState::Closed)
 	, WsEvents(EWebSocketEvent::None)
 {
-	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::Tick);
-	TickerDelegateHandle.Reset();
 }
 
 AccelByteWebSocket::~AccelByteWebSocket()
@@ -99,6 +100,7 @@ void AccelByteWebSocket::SetupWebSocket()
 	{
 		Headers.Add("Authorization", "Bearer " + ServerCreds->GetClientAccessToken());
 	}
+
 	WebSocket = WebSocketFactory->CreateWebSocket(Url, Protocol, Headers);
 
 	WebSocket->OnMessage().AddRaw(this, &AccelByteWebSocket::OnMessageReceived);
@@ -107,6 +109,17 @@ void AccelByteWebSocket::SetupWebSocket()
 	WebSocket->OnClosed().AddRaw(this, &AccelByteWebSocket::OnClosed);
 }
 
+void AccelByteWebSocket::LoadConfig()
+{
+	int32 ConfigMaxOutboundQueueSize = MaxOutboundQueueSize;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.WebSocket"), TEXT("MaxOutboundQueueSize"), ConfigMaxOutboundQueueSize);
+	SetMaxOutboundQueueSize(ConfigMaxOutboundQueueSize);
+
+	bool bConfigEventDrivenDispatch = bEventDrivenDispatch;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.WebSocket"), TEXT("bEventDrivenDispatch"), bConfigEventDrivenDispatch);
+	SetEventDrivenDispatch(bConfigEventDrivenDispatch);
+}
+
 void AccelByteWebSocket::UpdateUpgradeHeaders(const FString& Key, const FString& Value)
 {
 	UpgradeHeaders.Emplace(Key, Value);
@@ -152,6 +165,9 @@ TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe> AccelByteWebSocket::Create(
 	Ws->UpgradeHeaders = UpgradeHeaders;
 	Ws->WebSocketFactory = WebSocketFactory;
 
+	Ws->SelfWPtr = Ws;
+	Ws->LoadConfig();
+
 	Ws->SetupWebSocket();
 
 	return Ws;	
@@ -177,6 +193,9 @@ TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe> AccelByteWebSocket::Create(
 	Ws->UpgradeHeaders = UpgradeHeaders;
 	Ws->WebSocketFactory = WebSocketFactory;
 
+	Ws->SelfWPtr = Ws;
+	Ws->LoadConfig();
+
 	Ws->SetupWebSocket();
 
 	return Ws;
@@ -203,9 +222,8 @@ void AccelByteWebSocket::Connect()
 
 	bConnectedBroadcasted = false;
 
-	TeardownTicker();
-
-	TickerDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(TickerDelegate, TickPeriod);
+	// Housekeeping is serviced by the loop shared by every websocket in the process
+	FRegistry::WebSocketLoop.Register(AsShared());
 
 	FString HeaderString;
 
@@ -229,6 +247,10 @@ void AccelByteWebSocket::Disconnect(bool ForceCleanup)
 	}
 	else
 	{
+		// Write whatever is still pending before closing, the rest can't be sent anymore
+		FlushOutboundQueue();
+		ClearOutboundQueue();
+
 		bConnectedBroadcasted = false;
 
 		if (WebSocket.IsValid())
@@ -253,8 +275,178 @@ void AccelByteWebSocket::SendPing() const
 
 void AccelByteWebSocket::Send(const FString& Message) const
 {
+	Send(Message, EWebSocketMessagePriority::Critical);
+}
+
+bool AccelByteWebSocket::Send(const FString& Message
+	, EWebSocketMessagePriority Priority
+	, const FString& CoalesceKey
+	, FString* OutSupersededMessage) const
+{
+	if (Priority >= EWebSocketMessagePriority::Count)
+	{
+		Priority = EWebSocketMessagePriority::Normal;
+	}
+
+	if (OutSupersededMessage != nullptr)
+	{
+		OutSupersededMessage->Reset();
+	}
+
+	FScopeLock Lock(&OutboundLock);
+
+	// Nothing will ever flush the buffer of a closed socket
+	if (!IsConnectedOrReconnecting())
+	{
+		UE_LOG(LogAccelByteWebsocket, Verbose, TEXT("Websocket is closed, dropping message"));
+		++OutboundStats.DroppedCount;
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("OutboundDropped"));
+		return false;
+	}
+
+	TArray<FOutboundMessage>& Queue = OutboundQueues[static_cast<uint8>(Priority)];
+	if (!CoalesceKey.IsEmpty())
+	{
+		FOutboundMessage* Superseded = Queue.FindByPredicate([&CoalesceKey](FOutboundMessage const& Item)
+			{
+				return Item.CoalesceKey.Equals(CoalesceKey);
+			});
+		if (Superseded != nullptr)
+		{
+			if (OutSupersededMessage != nullptr)
+			{
+				*OutSupersededMessage = Superseded->Payload;
+			}
+			Superseded->Payload = Message;
+			++OutboundStats.CoalescedCount;
+			FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("OutboundCoalesced"));
+			return true;
+		}
+	}
+
+	if (GetOutboundQueueDepth() >= MaxOutboundQueueSize && !DropLowestPriorityMessage(Priority))
+	{
+		UE_LOG(LogAccelByteWebsocket, Warning, TEXT("Outbound queue is full (%d), dropping message"), MaxOutboundQueueSize);
+		++OutboundStats.DroppedCount;
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("OutboundDropped"));
+		return false;
+	}
+
+	Queue.Add(FOutboundMessage{ Message, CoalesceKey, !IsConnected() });
+
+	// Critical messages don't wait for the tick, flushing the whole queue keeps the send order intact
+	if (Priority == EWebSocketMessagePriority::Critical)
+	{
+		FlushOutboundQueue();
+	}
+
+	return true;
+}
+
+bool AccelByteWebSocket::IsConnectedOrReconnecting() const
+{
+	return IsConnected()
+		|| WsState == EWebSocketState::Connecting
+		|| WsState == EWebSocketState::WaitingReconnect
+		|| WsState == EWebSocketState::Reconnecting;
+}
+
+FAccelByteWebSocketOutboundStats AccelByteWebSocket::GetOutboundStats() const
+{
+	FScopeLock Lock(&OutboundLock);
+	FAccelByteWebSocketOutboundStats Stats = OutboundStats;
+	Stats.QueueDepth = GetOutboundQueueDepth();
+	return Stats;
+}
+
+void AccelByteWebSocket::SetMaxOutboundQueueSize(int32 InMaxOutboundQueueSize)
+{
+	FScopeLock Lock(&OutboundLock);
+	MaxOutboundQueueSize = FMath::Max(1, InMaxOutboundQueueSize);
+}
+
+void AccelByteWebSocket::SetEventDrivenDispatch(bool bInEventDrivenDispatch)
+{
+	bEventDrivenDispatch = bInEventDrivenDispatch;
+}
+
+int32 AccelByteWebSocket::GetOutboundQueueDepth() const
+{
+	int32 Depth = 0;
+	for (TArray<FOutboundMessage> const& Queue : OutboundQueues)
+	{
+		Depth += Queue.Num();
+	}
+	return Depth;
+}
+
+bool AccelByteWebSocket::DropLowestPriorityMessage(EWebSocketMessagePriority IncomingPriority) const
+{
+	// Only make room by dropping messages that are not more important than the incoming one
+	for (int32 Index = static_cast<int32>(EWebSocketMessagePriority::Count) - 1; Index >= static_cast<int32>(IncomingPriority); Index--)
+	{
+		if (OutboundQueues[Index].Num() > 0)
+		{
+			OutboundQueues[Index].RemoveAt(0);
+			++OutboundStats.DroppedCount;
+			FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("OutboundDropped"));
+			return true;
+		}
+	}
+	return false;
+}
+
+void AccelByteWebSocket::FlushOutboundQueue() const
+{
+	FScopeLock Lock(&OutboundLock);
+
+	if (!IsConnected())
+	{
+		return;
+	}
+
+	for (TArray<FOutboundMessage>& Queue : OutboundQueues)
+	{
+		for (FOutboundMessage const& Message : Queue)
+		{
+			if (Message.bQueuedWhileDisconnected)
+			{
+				++OutboundStats.ReplayedCount;
+			}
+			WriteMessage(Message.Payload);
+		}
+		Queue.Reset();
+	}
+}
+
+void AccelByteWebSocket::ClearOutboundQueue()
+{
+	FScopeLock Lock(&OutboundLock);
+
+	const int32 Depth = GetOutboundQueueDepth();
+	if (Depth > 0)
+	{
+		UE_LOG(LogAccelByteWebsocket, Log, TEXT("Dropping %d outbound message(s) that can't be sent"), Depth);
+		OutboundStats.DroppedCount += Depth;
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("OutboundDropped"), Depth);
+	}
+
+	for (TArray<FOutboundMessage>& Queue : OutboundQueues)
+	{
+		Queue.Reset();
+	}
+}
+
+void AccelByteWebSocket::WriteMessage(const FString& Message) const
+{
+	if (!WebSocket.IsValid())
+	{
+		return;
+	}
+
 	ACCELBYTE_SERVICE_LOGGING_WEBSOCKET_REQUEST(Message);
 	WebSocket->Send(Message);
+	++OutboundStats.SentCount;
 }
 
 void AccelByteWebSocket::OnConnectionConnected()
@@ -263,6 +455,7 @@ void AccelByteWebSocket::OnConnectionConnected()
 	
 	WsEvents |= EWebSocketEvent::Connected;
 	bConnectTriggered = true;
+	ScheduleDispatch();
 }
 
 void AccelByteWebSocket::OnConnectionError(const FString& Error)
@@ -272,6 +465,7 @@ void AccelByteWebSocket::OnConnectionError(const FString& Error)
 	WsEvents |= EWebSocketEvent::ConnectionError;
 	bWasWsConnectionError = true;
 	OnConnectionErrorQueue.Enqueue(Error);
+	ScheduleDispatch();
 }
 
 void AccelByteWebSocket::OnClosed(int32 StatusCode, const FString& Reason, bool WasClean)
@@ -289,13 +483,46 @@ void AccelByteWebSocket::OnClosed(int32 StatusCode, const FString& Reason, bool
 	}
 		
 	OnConnectionClosedQueue.Enqueue(FConnectionClosedParams({StatusCode, Reason, WasClean}));
+	ScheduleDispatch();
 }
 
 void AccelByteWebSocket::OnMessageReceived(const FString& Message)
 {
 	ACCELBYTE_SERVICE_LOGGING_WEBSOCKET_RESPONSE(Message);
 	FReport::Log(FString(__FUNCTION__));	
-	OnMessageQueue.Enqueue(Message);
+	OnMessageQueue.Enqueue(FReceivedMessage{ Message, FPlatformTime::Seconds() });
+	ScheduleDispatch();
+}
+
+void AccelByteWebSocket::ScheduleDispatch()
+{
+	if (!bEventDrivenDispatch || bDispatchScheduled.AtomicSet(true))
+	{
+		return;
+	}
+
+	// Events raised while the socket is being destroyed are dropped when the task fails to pin it
+	TWeakPtr<AccelByteWebSocket, ESPMode::ThreadSafe> WebSocketWPtr = SelfWPtr;
+	AsyncTask(ENamedThreads::GameThread, [WebSocketWPtr]()
+		{
+			const auto WebSocketPtr = WebSocketWPtr.Pin();
+			if (WebSocketPtr.IsValid())
+			{
+				WebSocketPtr->DispatchPendingMessages();
+			}
+		});
+}
+
+void AccelByteWebSocket::DispatchPendingMessages()
+{
+	bDispatchScheduled = false;
+
+	// Same order as Tick, the state machine handles the connect and close events before they and the messages are broadcast
+	StateTick(0.0f);
+	MessageTick(0.0f);
+
+	// A (re)connection may have just been broadcast, send the replay buffer without waiting for the housekeeping tick
+	FlushOutboundQueue();
 }
 
 void AccelByteWebSocket::Reconnect()
@@ -307,6 +534,7 @@ bool AccelByteWebSocket::Tick(float DeltaTime)
 {
 	StateTick(DeltaTime);
 	MessageTick(DeltaTime);
+	FlushOutboundQueue();
 
 	if(bDisconnectOnNextTick)
 	{
@@ -367,6 +595,7 @@ bool AccelByteWebSocket::StateTick(float DeltaTime)
 		}
 		break;
 	case EWebSocketState::WaitingReconnect:
+		FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("ConnectionLost"));
 		TimeSinceLastReconnect = FPlatformTime::Seconds();
 		TimeSinceConnectionLost = FPlatformTime::Seconds();
 		BackoffDelay = InitialBackoffDelay;
@@ -377,6 +606,7 @@ bool AccelByteWebSocket::StateTick(float DeltaTime)
 	case EWebSocketState::Reconnecting:
 		if (WebSocket->IsConnected() || (WsEvents & EWebSocketEvent::Connected) != EWebSocketEvent::None)
 		{
+			FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("Reconnected"));
 			TimeSinceLastPing = FPlatformTime::Seconds();
 			WsState = EWebSocketState::Connected;
 		}
@@ -393,6 +623,8 @@ bool AccelByteWebSocket::StateTick(float DeltaTime)
 			const FString Reason(TEXT("Reconnection total timeout limit reached"));
 			const bool WasClean = false;
 			OnConnectionClosedQueue.Enqueue(FConnectionClosedParams({StatusCode, Reason, WasClean}));
+			FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("ReconnectTimeout"));
+			ClearOutboundQueue();
 
 			WsState = EWebSocketState::Closed;
 		}
@@ -410,6 +642,7 @@ bool AccelByteWebSocket::StateTick(float DeltaTime)
 				SetupWebSocket();
 			}
 			UE_LOG(LogAccelByteWebsocket, Log, TEXT("Connecting from Reconnecting state"));
+			FRegistry::MetricsRegistry.IncrementCounter(FAccelByteMetricsRegistry::SubsystemWebSocket, TEXT("ReconnectAttempt"));
 			Connect();
 			TimeSinceLastReconnect = FPlatformTime::Seconds();
 		}
@@ -446,10 +679,11 @@ bool AccelByteWebSocket::MessageTick(float DeltaTime)
 
 	while(!OnMessageQueue.IsEmpty())
 	{
-		FString Msg;
+		FReceivedMessage Msg;
 		OnMessageQueue.Dequeue(Msg);
 
-		MessageReceiveDelegate.Broadcast(Msg);
+		FRegistry::MetricsRegistry.RecordLatency(ReceiveToDispatchLatencyName, (FPlatformTime::Seconds() - Msg.ReceivedAt) * 1000.0);
+		MessageReceiveDelegate.Broadcast(Msg.Payload);
 	}
 
 	while(!OnConnectionClosedQueue.IsEmpty())
@@ -471,11 +705,7 @@ bool AccelByteWebSocket::MessageTick(float DeltaTime)
 
 void AccelByteWebSocket::TeardownTicker()
 {
-	if (TickerDelegateHandle.IsValid())
-	{
-		FTickerAlias::GetCoreTicker().RemoveTicker(TickerDelegateHandle);
-		TickerDelegateHandle.Reset();
-	}
+	FRegistry::WebSocketLoop.Unregister(this);
 }
 
 void AccelByteWebSocket::TeardownWebsocket()
@@ -0,0 +1,144 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteWebSocketLoop.h"
+#include "Core/AccelByteWebSocket.h"
+
+namespace AccelByte
+{
+
+FAccelByteWebSocketLoop::FAccelByteWebSocketLoop(float InTickPeriod, int32 InSlotCount)
+	: TickPeriod(InTickPeriod)
+{
+	Slots.SetNum(FMath::Max(1, InSlotCount));
+}
+
+FAccelByteWebSocketLoop::~FAccelByteWebSocketLoop()
+{
+	/*
+	 * Same as AccelByteWebSocket, only touch the core ticker while the UObject subsystem is still alive,
+	 * the loop is a static that may be destroyed after the engine is gone.
+	 */
+	if (UObjectInitialized())
+	{
+		FScopeLock ScopeLock(&Lock);
+		StopTicker();
+	}
+}
+
+void FAccelByteWebSocketLoop::Register(TSharedRef<AccelByteWebSocket, ESPMode::ThreadSafe> const& WebSocket)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	AccelByteWebSocket const* Key = &WebSocket.Get();
+	if (int32 const* SlotIndex = SlotIndexByKey.Find(Key))
+	{
+		// An expired socket not yet removed may share the address of the new one, point its entry to the new socket
+		FEntry* Entry = Slots[*SlotIndex].FindByPredicate([Key](FEntry const& Item) { return Item.Key == Key; });
+		if (Entry != nullptr && !Entry->WebSocket.IsValid())
+		{
+			Entry->WebSocket = WebSocket;
+		}
+		return;
+	}
+
+	Slots[NextRegisterSlot].Add(FEntry{ WebSocket, Key });
+	SlotIndexByKey.Add(Key, NextRegisterSlot);
+	NextRegisterSlot = (NextRegisterSlot + 1) % Slots.Num();
+
+	StartTicker();
+}
+
+void FAccelByteWebSocketLoop::Unregister(AccelByteWebSocket const* WebSocket)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	int32 SlotIndex = INDEX_NONE;
+	if (SlotIndexByKey.RemoveAndCopyValue(WebSocket, SlotIndex))
+	{
+		Slots[SlotIndex].RemoveAllSwap([WebSocket](FEntry const& Entry) { return Entry.Key == WebSocket; });
+	}
+}
+
+bool FAccelByteWebSocketLoop::IsRegistered(AccelByteWebSocket const* WebSocket) const
+{
+	FScopeLock ScopeLock(&Lock);
+
+	return SlotIndexByKey.Contains(WebSocket);
+}
+
+int32 FAccelByteWebSocketLoop::GetRegisteredCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return SlotIndexByKey.Num();
+}
+
+bool FAccelByteWebSocketLoop::Tick(float DeltaTime)
+{
+	TArray<TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe>> DueWebSockets;
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		if (SlotIndexByKey.Num() <= 0)
+		{
+			// Nothing left to service, the ticker is added back on the next registration
+			TickerHandle.Reset();
+			return false;
+		}
+
+		TArray<FEntry>& Slot = Slots[CurrentSlot];
+		Slot.RemoveAllSwap([this](FEntry const& Entry)
+			{
+				if (Entry.WebSocket.IsValid())
+				{
+					return false;
+				}
+				SlotIndexByKey.Remove(Entry.Key);
+				return true;
+			});
+
+		DueWebSockets.Reserve(Slot.Num());
+		for (FEntry const& Entry : Slot)
+		{
+			DueWebSockets.Add(Entry.WebSocket.Pin());
+		}
+
+		CurrentSlot = (CurrentSlot + 1) % Slots.Num();
+	}
+
+	// Sockets may register or unregister themselves while being ticked, so it's done outside of the lock
+	for (auto const& WebSocket : DueWebSockets)
+	{
+		if (WebSocket.IsValid() && IsRegistered(WebSocket.Get()))
+		{
+			WebSocket->Tick(TickPeriod);
+		}
+	}
+
+	return true;
+}
+
+void FAccelByteWebSocketLoop::StartTicker()
+{
+	if (TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	const float LoopPeriod = TickPeriod / Slots.Num();
+	TickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAccelByteWebSocketLoop::Tick), LoopPeriod);
+}
+
+void FAccelByteWebSocketLoop::StopTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		return;
+	}
+
+	FTickerAlias::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+}
+
+}
@@ -54,7 +54,7 @@ FAccelByteTaskWPtr ServerDSM::RegisterServerToDSM(int32 Port
 	const TDelegate<void(const FJsonObject&)> OnSuccessHttpClient = THandler<FJsonObject>::CreateLambda(
 		[OnSuccess, this](FJsonObject const& JSONObject)
 		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(AutoShutdownDelegateHandle);
+			FRegistry::PeriodicTaskScheduler.RemoveTask(AutoShutdownDelegateHandle);
 
 			FString JSONString;
 			const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSONString);
@@ -68,7 +68,7 @@ FAccelByteTaskWPtr ServerDSM::RegisterServerToDSM(int32 Port
 			}
 			if (CountdownTimeStart != -1)
 			{
-				AutoShutdownDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(AutoShutdownDelegate, ShutdownTickSeconds);
+				AutoShutdownDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("ServerDSM.ShutdownTick"), AutoShutdownDelegate, ShutdownTickSeconds);
 			}
 			SetServerType(EServerType::CLOUDSERVER);
 
@@ -112,7 +112,7 @@ FAccelByteTaskWPtr ServerDSM::RegisterServerToDSM(int32 Port
 	const TDelegate<void(const FJsonObject&)> OnSuccessHttpClient = THandler<FJsonObject>::CreateLambda(
 		[OnSuccess, this](FJsonObject const& JSONObject)
 		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(AutoShutdownDelegateHandle);
+			FRegistry::PeriodicTaskScheduler.RemoveTask(AutoShutdownDelegateHandle);
 
 			FString JSONString;
 			const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSONString);
@@ -126,7 +126,7 @@ FAccelByteTaskWPtr ServerDSM::RegisterServerToDSM(int32 Port
 			}
 			if (CountdownTimeStart != -1)
 			{
-				AutoShutdownDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(AutoShutdownDelegate, ShutdownTickSeconds);
+				AutoShutdownDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("ServerDSM.ShutdownTick"), AutoShutdownDelegate, ShutdownTickSeconds);
 			}
 			SetServerType(EServerType::CLOUDSERVER);
 
@@ -159,7 +159,7 @@ FAccelByteTaskWPtr ServerDSM::SendShutdownToDSM(bool KillMe
 	};
 
 	FReport::Log(TEXT("Starting DSM Shutdown Request..."));
-	FTickerAlias::GetCoreTicker().RemoveTicker(AutoShutdownDelegateHandle);
+	FRegistry::PeriodicTaskScheduler.RemoveTask(AutoShutdownDelegateHandle);
 	ServerType = EServerType::NONE;
 	RegisteredServerInfo = FAccelByteModelsServerInfo();
 
@@ -198,7 +198,7 @@ FAccelByteTaskWPtr ServerDSM::RegisterLocalServerToDSM(FString const& IPAddress
 	const TDelegate<void(const FJsonObject&)> OnSuccessHttpClient = THandler<FJsonObject>::CreateLambda(
 		[OnSuccess, this](FJsonObject const& JSONObject)
 		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(AutoShutdownDelegateHandle);
+			FRegistry::PeriodicTaskScheduler.RemoveTask(AutoShutdownDelegateHandle);
 
 			FString JSONString;
 			const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JSONString);
@@ -211,7 +211,7 @@ FAccelByteTaskWPtr ServerDSM::RegisterLocalServerToDSM(FString const& IPAddress
 			}
 			if (CountdownTimeStart != -1)
 			{
-				AutoShutdownDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(AutoShutdownDelegate, ShutdownTickSeconds);
+				AutoShutdownDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("ServerDSM.ShutdownTick"), AutoShutdownDelegate, ShutdownTickSeconds);
 			}
 			SetServerType(EServerType::LOCALSERVER);
 
@@ -261,7 +261,7 @@ FAccelByteTaskWPtr ServerDSM::DeregisterLocalServerFromDSM(FString const& Server
 	};
 
 	FReport::Log(TEXT("Starting DSM Deregister Request..."));
-	FTickerAlias::GetCoreTicker().RemoveTicker(AutoShutdownDelegateHandle);
+	FRegistry::PeriodicTaskScheduler.RemoveTask(AutoShutdownDelegateHandle);
 	ServerType = EServerType::NONE;
 
 	RegisteredServerInfo = FAccelByteModelsServerInfo();
@@ -494,12 +494,12 @@ void ServerDSM::StartHeartbeat(uint32 IntervalSeconds)
 {
 	HeartbeatTickSeconds = IntervalSeconds;
 	HeartbeatDelegate = FTickerDelegate::CreateRaw(this, &ServerDSM::PeriodicHeartbeat);
-	HeartbeatDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(HeartbeatDelegate, HeartbeatTickSeconds);
+	HeartbeatDelegateHandle = FRegistry::PeriodicTaskScheduler.AddTask(TEXT("ServerDSM.PeriodicHeartbeat"), HeartbeatDelegate, HeartbeatTickSeconds);
 }
 
 void ServerDSM::StopHeartbeat()
 {
-	FTickerAlias::GetCoreTicker().RemoveTicker(HeartbeatDelegateHandle);
+	FRegistry::PeriodicTaskScheduler.RemoveTask(HeartbeatDelegateHandle);
 }
 
 int32 ServerDSM::GetPlayerNum()
@@ -540,7 +540,12 @@ ServerDSM::ServerDSM(ServerCredentials const& InCredentialsRef
 	AutoShutdownDelegate = FTickerDelegate::CreateRaw(this, &ServerDSM::ShutdownTick);
 }
 
-ServerDSM::~ServerDSM() {}
+ServerDSM::~ServerDSM()
+{
+	// The tasks are bound to this instance
+	FRegistry::PeriodicTaskScheduler.RemoveTask(AutoShutdownDelegateHandle);
+	FRegistry::PeriodicTaskScheduler.RemoveTask(HeartbeatDelegateHandle);
+}
 
 } // Namespace GameServerApi
 } // Namespace AccelByte
@@ -5,6 +5,7 @@
 #include "GameServerApi/AccelByteServerMetricExporterApi.h"
 #include "Core/AccelByteCredentials.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteMetricsRegistry.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteServerCredentials.h"
 #include "Core/StatsD/AccelByteStatsDMetricBuilder.h"
@@ -161,8 +162,57 @@ namespace AccelByte
 			EnqueueMetric("FrameStartDelayMax", StatsDMetricCollector->GetFrameStartDelayMax());
 		}
 
+		void ServerMetricExporter::SetSdkHealthMetricsEnabled(bool Enable)
+		{
+			bSdkHealthMetricsEnabled = Enable;
+		}
+
+		void ServerMetricExporter::CollectSdkHealthMetrics()
+		{
+			const FAccelByteHealthSnapshot Snapshot = FRegistry::MetricsRegistry.GetHealthSnapshot();
+
+			for (FAccelByteLatencySummary const& Summary : Snapshot.Endpoints)
+			{
+				// StatsD keys can't contain whitespace nor path separators
+				FString Endpoint = Summary.Endpoint;
+				Endpoint.ReplaceCharInline(TEXT(' '), TEXT('_'));
+				Endpoint.ReplaceCharInline(TEXT('/'), TEXT('.'));
+				Endpoint.ReplaceInline(TEXT("{"), TEXT(""));
+				Endpoint.ReplaceInline(TEXT("}"), TEXT(""));
+
+				const FString Prefix = FString::Printf(TEXT("AccelByteSdk.Http.%s"), *Endpoint);
+				EnqueueMetric(Prefix + TEXT(".Count"), static_cast<int32>(Summary.Count));
+				EnqueueMetric(Prefix + TEXT(".ErrorCount"), static_cast<int32>(Summary.ErrorCount));
+				EnqueueMetric(Prefix + TEXT(".P50Ms"), Summary.P50Ms);
+				EnqueueMetric(Prefix + TEXT(".P99Ms"), Summary.P99Ms);
+				EnqueueMetric(Prefix + TEXT(".MaxMs"), Summary.MaxMs);
+			}
+
+			for (FAccelByteLatencySummary const& Summary : Snapshot.Latencies)
+			{
+				const FString Prefix = FString::Printf(TEXT("AccelByteSdk.Latency.%s"), *Summary.Endpoint);
+				EnqueueMetric(Prefix + TEXT(".P50Ms"), Summary.P50Ms);
+				EnqueueMetric(Prefix + TEXT(".P99Ms"), Summary.P99Ms);
+			}
+
+			for (auto const& Subsystem : Snapshot.Counters)
+			{
+				for (auto const& Counter : Subsystem.Value)
+				{
+					EnqueueMetric(FString::Printf(TEXT("AccelByteSdk.%s.%s"), *Subsystem.Key, *Counter.Key), static_cast<int32>(Counter.Value));
+				}
+			}
+
+			EnqueueMetric(TEXT("AccelByteSdk.HttpCache.HitRatio"), Snapshot.HttpCacheHitRatio);
+		}
+
 		bool ServerMetricExporter::ExportMetrics(float DeltaTime)
 		{
+			if (bSdkHealthMetricsEnabled)
+			{
+				CollectSdkHealthMetrics();
+			}
+
 			if (!MultiMetricPacket.IsEmpty())
 			{
 				MetricQueue.Enqueue(MakeShared<FString>(MultiMetricPacket));
@@ -79,6 +79,19 @@ FAccelByteTaskWPtr ServerOauth2::GetJwks(THandler<FJwkSet> const& OnSuccess
 	return HttpClient.Request(TEXT("GET"), Url, FString(), Headers, OnSuccess, OnError);
 }
 
+FAccelByteJwtVerifierRef ServerOauth2::GetJwtVerifier()
+{
+	if (!JwtVerifier.IsValid())
+	{
+		JwtVerifier = MakeShared<FAccelByteJwtVerifier, ESPMode::ThreadSafe>(
+			[this](THandler<FJwkSet> const& OnSuccess, FErrorHandler const& OnError)
+			{
+				GetJwks(OnSuccess, OnError);
+			});
+	}
+	return JwtVerifier.ToSharedRef();
+}
+
 void ServerOauth2::ForgetAllCredentials()
 {
 	FReport::Log(FString(__FUNCTION__));
@@ -102,7 +115,13 @@ ServerOauth2::ServerOauth2(ServerCredentials& InCredentialsRef
 {}
 
 ServerOauth2::~ServerOauth2()
-{}
+{
+	// The verifier may outlive this API through its shared reference, it must stop calling GetJwks
+	if (JwtVerifier.IsValid())
+	{
+		JwtVerifier->Shutdown();
+	}
+}
 
 } // Namespace GameServerApi
 } // Namespace AccelByte
@@ -14,6 +14,26 @@ namespace AccelByte
 namespace GameServerApi
 {
 
+namespace
+{
+	FString SerializeUserStatItemIncrements(TArray<FAccelByteModelsBulkUserStatItemInc> const& Data)
+	{
+		FString Contents = "[";
+		FString Content;
+		for (int i = 0; i < Data.Num(); i++)
+		{
+			FJsonObjectConverter::UStructToJsonObjectString(Data[i], Content);
+			Contents += Content;
+			if (i < Data.Num() - 1)
+			{
+				Contents += ",";
+			}
+		}
+		Contents += "]";
+		return Contents;
+	}
+}
+
 ServerStatistic::ServerStatistic(ServerCredentials const& InCredentialsRef
 	, ServerSettings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
@@ -21,7 +41,12 @@ ServerStatistic::ServerStatistic(ServerCredentials const& InCredentialsRef
 {}
 
 ServerStatistic::~ServerStatistic()
-{}
+{
+	if (IncrementAccumulator.IsValid())
+	{
+		IncrementAccumulator->Shutdown();
+	}
+}
 
 FString ServerStatistic::ConvertUserStatisticSortByToString(const EAccelByteStatisticSortBy& SortBy)
 {
@@ -156,24 +181,65 @@ FAccelByteTaskWPtr ServerStatistic::IncrementManyUsersStatItems(TArray<FAccelByt
 	const FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/statitems/value/bulk")
 		, *ServerSettingsRef.StatisticServerUrl
 		, *ServerCredentialsRef->GetClientNamespace());
-
-	FString Contents = "[";
-	FString Content;
-	for (int i = 0; i < Data.Num(); i++)
-	{
-		FJsonObjectConverter::UStructToJsonObjectString(Data[i], Content);
-		Contents += Content;
-		if (i < Data.Num() - 1)
-		{
-			Contents += ",";
-		}
-	}
-	Contents += "]";
 	
 	TMap<FString, FString> Headers;
 	Headers.Add(GHeaderABLogSquelch, TEXT("true"));
 
-	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, Contents, Headers, OnSuccess, OnError);
+	return HttpClient.ApiRequest(TEXT("PUT"), Url, {}, SerializeUserStatItemIncrements(Data), Headers, OnSuccess, OnError);
+}
+
+void ServerStatistic::QueueIncrementManyUsersStatItems(TArray<FAccelByteModelsBulkUserStatItemInc> const& Data)
+{
+	FAccelByteStatIncrementAccumulatorPtr Accumulator = GetIncrementAccumulator();
+	for (FAccelByteModelsBulkUserStatItemInc const& Item : Data)
+	{
+		Accumulator->Add(Item.userId, Item.statCode, Item.inc);
+	}
+}
+
+void ServerStatistic::FlushQueuedStatItemIncrements(THandler<bool> const& OnDone)
+{
+	GetIncrementAccumulator()->Flush(OnDone);
+}
+
+void ServerStatistic::StartupQueuedStatItemIncrements()
+{
+	GetIncrementAccumulator();
+}
+
+FAccelByteStatIncrementAccumulatorPtr ServerStatistic::GetIncrementAccumulator()
+{
+	if (!IncrementAccumulator.IsValid())
+	{
+		// The accumulator can outlive this object, its flush request only holds weak references
+		TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+		TWeakPtr<ServerCredentials const, ESPMode::ThreadSafe> ServerCredentialsWPtr = ServerCredentialsRef;
+		const FString StatisticServerUrl = ServerSettingsRef.StatisticServerUrl;
+		IncrementAccumulator = MakeShared<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe>(TEXT("StatIncrements/Server")
+			, [HttpClientWPtr, ServerCredentialsWPtr, StatisticServerUrl](TArray<FAccelByteModelsBulkUserStatItemInc> const& Increments
+				, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> const& OnSuccess
+				, FErrorHandler const& OnError) -> FAccelByteTaskWPtr
+			{
+				const auto HttpClientPtr = HttpClientWPtr.Pin();
+				const auto ServerCredentialsPtr = ServerCredentialsWPtr.Pin();
+				if (!HttpClientPtr.IsValid() || !ServerCredentialsPtr.IsValid())
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+					return nullptr;
+				}
+
+				const FString Url = FString::Printf(TEXT("%s/v1/admin/namespaces/%s/statitems/value/bulk")
+					, *StatisticServerUrl
+					, *ServerCredentialsPtr->GetClientNamespace());
+
+				TMap<FString, FString> Headers;
+				Headers.Add(GHeaderABLogSquelch, TEXT("true"));
+
+				return HttpClientPtr->ApiRequest(TEXT("PUT"), Url, {}, SerializeUserStatItemIncrements(Increments), Headers, OnSuccess, OnError);
+			});
+		IncrementAccumulator->Startup();
+	}
+	return IncrementAccumulator;
 }
 
 FAccelByteTaskWPtr ServerStatistic::IncrementUserStatItems(FString const& UserId
@@ -167,37 +167,55 @@ FAccelByteTaskWPtr ServerUser::ListUserByUserId(FListUserDataRequest const& Requ
 
 FAccelByteTaskWPtr ServerUser::BulkGetUserInfo(TArray<FString> const& UserIds
 	, THandler<FListBulkUserInfo> const& OnSuccess
-	, FErrorHandler const& OnError)
+	, FErrorHandler const& OnError
+	, FAccelByteBulkFailuresHandler const& OnPartialFailure)
 {
 	FReport::Log(FString(__FUNCTION__));
 
-	TArray<FString> CopyUserIds = UserIds;
-	if (CopyUserIds.Num() <= 0)
+	if (UserIds.Num() <= 0)
 	{
 		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("UserIds cannot be empty!"));
 		return nullptr;
 	}
-	if (CopyUserIds.Num() > 100)
-	{
-		UE_LOG(LogAccelByte, Warning, TEXT("The requested UserIds information list exceed max size 100. UserIds index 0-99 will be sent, and the rest will be truncated."));
-		CopyUserIds.SetNum(100, true);
-	}
-
-	const FListBulkUserInfoRequest UserList{ CopyUserIds };
 
 	const FString Url = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/bulk/basic")
 		, *ServerSettingsRef.IamServerUrl
 		, *ServerCredentialsRef->GetClientNamespace());
 
-	FString Content;
-	FJsonObjectConverter::UStructToJsonObjectString(UserList, Content);
-
-	TMap<FString, FString> Headers = {
-		{TEXT("Content-Type"), TEXT("application/json")},
-		{TEXT("Accept"), TEXT("application/json")}
-	};
-
-	return HttpClient.Request(TEXT("POST"), Url, Content, Headers, OnSuccess, OnError);
+	TWeakPtr<FHttpClient, ESPMode::ThreadSafe> HttpClientWPtr = HttpClientHandle;
+	return TAccelByteBulkFanOut<FListBulkUserInfo>::Run(UserIds
+		, MaximumQueryLimit
+		, [HttpClientWPtr, Url](TArray<FString> const& ChunkUserIds
+			, THandler<FListBulkUserInfo> const& OnChunkSuccess
+			, FErrorHandler const& OnChunkError)
+			{
+				const auto HttpClientPtr = HttpClientWPtr.Pin();
+				if (!HttpClientPtr.IsValid())
+				{
+					OnChunkError.ExecuteIfBound(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("The API object was destroyed"));
+					return FAccelByteTaskPtr();
+				}
+
+				const FListBulkUserInfoRequest UserList{ ChunkUserIds };
+
+				FString Content;
+				FJsonObjectConverter::UStructToJsonObjectString(UserList, Content);
+
+				TMap<FString, FString> Headers = {
+					{TEXT("Content-Type"), TEXT("application/json")},
+					{TEXT("Accept"), TEXT("application/json")}
+				};
+
+				return HttpClientPtr->Request(TEXT("POST"), Url, Content, Headers, OnChunkSuccess, OnChunkError);
+			}
+		, [](FListBulkUserInfo& Merged, FListBulkUserInfo const& Chunk)
+			{
+				Merged.Data.Append(Chunk.Data);
+			}
+		, [OnSuccess, OnError, OnPartialFailure](FListBulkUserInfo& Merged, TArray<FAccelByteBulkFailure> const& Failures, bool bAnySucceeded)
+			{
+				ReportBulkResult(Merged, Failures, bAnySucceeded, OnSuccess, OnError, OnPartialFailure);
+			});
 }
 	
 } // Namespace GameServerApi
@@ -7,6 +7,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteOfflineWriteQueue.h"
 #include "Models/AccelByteAchievementModels.h"
 
 namespace AccelByte
@@ -144,6 +145,15 @@ public:
 		, FVoidHandler const& OnSuccess
 		, FErrorHandler const& OnError);
 
+	/**
+	 * @brief Operation of UnlockAchievement for FAccelByteOfflineWriteQueue, unlocking twice is harmless.
+	 *
+	 * @param AchievementCode The achievement code which will be unlock.
+	 *
+	 * @return The operation, rejected by Enqueue when the achievement code is empty.
+	 */
+	FAccelByteOfflineOperation MakeUnlockAchievementOperation(FString const& AchievementCode) const;
+
 	/**
 	 * @brief Get the progress list of global achievements. Include achieved and in-progress.
 	 *
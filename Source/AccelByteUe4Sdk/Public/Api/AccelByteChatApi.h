@@ -222,6 +222,11 @@ public:
 	 */
 	bool IsConnected() const;
 
+	/**
+	 * @brief Get the outbound queue statistics of the Chat websocket, e.g. queue depth and dropped messages.
+	 */
+	FAccelByteWebSocketOutboundStats GetOutboundStats() const;
+
 	/**
 	 * @brief Send and empty string through the web socket connection
 	 */
@@ -7,6 +7,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteOfflineWriteQueue.h"
 #include "Models/AccelByteCloudSaveModels.h"
 
 namespace AccelByte
@@ -63,6 +64,37 @@ public:
 		, FVoidHandler const& OnSuccess
 		, FErrorHandler const& OnError);
 
+	/**
+	 * @brief Save a user-level record. If the record doesn't exist, it will create and save the record, if already exists, it will append to the existing one.
+	 *
+	 * @param Key Key of record.
+	 * @param RecordRequest The request of the record with JSON formatted.
+	 * @param IsPublic Save the record as a public/private record.
+	 * @param OnSuccess This will be called when the operation succeeded. The result is the record after the append.
+	 * @param OnError This will be called when the operation failed.
+	 * 
+	 * @return AccelByteTask object to track and cancel the ongoing API operation.
+	 */
+	FAccelByteTaskWPtr SaveUserRecord(FString const& Key
+		, FJsonObject RecordRequest
+		, bool IsPublic
+		, THandler<FAccelByteModelsUserRecord> const& OnSuccess
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Operation of SaveUserRecord for FAccelByteOfflineWriteQueue. Saving the same fields twice is harmless, the
+	 * saves of a record are not coalesced since each can append different fields.
+	 *
+	 * @param Key Key of record.
+	 * @param RecordRequest The request of the record with JSON formatted.
+	 * @param IsPublic Save the record as a public/private record.
+	 *
+	 * @return The operation, rejected by Enqueue when the key is empty.
+	 */
+	FAccelByteOfflineOperation MakeSaveUserRecordOperation(FString const& Key
+		, FJsonObject RecordRequest
+		, bool IsPublic) const;
+
 	/**
 	 * @brief Get a record (arbitrary JSON data) by its key in user-level.
 	 *
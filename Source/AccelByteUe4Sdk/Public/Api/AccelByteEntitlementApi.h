@@ -6,6 +6,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePageIterator.h"
 #include "Models/AccelByteEcommerceModels.h"
 
 namespace AccelByte
@@ -21,9 +22,17 @@ namespace Api
 class ACCELBYTEUE4SDK_API Entitlement : public FApiBase
 {
 public:
+	DECLARE_MULTICAST_DELEGATE(FOnEntitlementsChanged);
+
 	Entitlement(Credentials const& InCredentialsRef, Settings const& InSettingsRef, FHttpRetryScheduler& InHttpRef);
 	~Entitlement();
 
+	/**
+	 * @brief Called when a call that consumes, sells or syncs entitlements of the user succeeds, before its OnSuccess,
+	 * e.g. to invalidate the ownership cached by FAccelByteOwnershipCache.
+	 */
+	FOnEntitlementsChanged& OnEntitlementsChanged() { return *EntitlementsChanged; }
+
 public:
 
 	/**
@@ -96,6 +105,27 @@ public:
 		, EAccelByteAppType AppType = EAccelByteAppType::NONE
 		, TArray<FString> const& Features = {});
 
+	/**
+	 * @brief Iterate every user's Entitlement, the next pages are fetched while the current one is consumed.
+	 *
+	 * @param EntitlementName The name of the entitlement (optional).
+	 * @param ItemIds Item's id (optional).
+	 * @param PageSize Number of entitlements per page. Default value : 100
+	 * @param Options Item cap and number of pages requested ahead.
+	 * @param EntitlementClass Class of the entitlement (optional).
+	 * @param AppType This is the type of application that entitled (optional).
+	 * @param Features The feature array.
+	 *
+	 * @return The page iterator, see TAccelBytePageIterator.
+	 */
+	TSharedRef<TAccelBytePageIterator<FAccelByteModelsEntitlementPagingSlicedResult>, ESPMode::ThreadSafe> IterateUserEntitlements(FString const& EntitlementName
+		, TArray<FString> const& ItemIds
+		, int32 PageSize = 100
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions()
+		, EAccelByteEntitlementClass EntitlementClass = EAccelByteEntitlementClass::NONE
+		, EAccelByteAppType AppType = EAccelByteAppType::NONE
+		, TArray<FString> const& Features = {});
+
 	/**
 	 * @brief Get user's Entitlement by the EntitlementId.
 	 *
@@ -565,6 +595,26 @@ private:
 	Entitlement() = delete;
 	Entitlement(Entitlement const&) = delete;
 	Entitlement(Entitlement&&) = delete;
+
+	template<typename T>
+	THandler<T> NotifyEntitlementsChanged(THandler<T> const& OnSuccess) const
+	{
+		TWeakPtr<FOnEntitlementsChanged, ESPMode::ThreadSafe> EntitlementsChangedWPtr = EntitlementsChanged;
+		return THandler<T>::CreateLambda([EntitlementsChangedWPtr, OnSuccess](T const& Result)
+			{
+				auto EntitlementsChangedPtr = EntitlementsChangedWPtr.Pin();
+				if (EntitlementsChangedPtr.IsValid())
+				{
+					EntitlementsChangedPtr->Broadcast();
+				}
+				OnSuccess.ExecuteIfBound(Result);
+			});
+	}
+
+	FVoidHandler NotifyEntitlementsChanged(FVoidHandler const& OnSuccess) const;
+
+	/** Shared with the request callbacks, which can outlive the API object. */
+	TSharedRef<FOnEntitlementsChanged, ESPMode::ThreadSafe> EntitlementsChanged;
 };
 
 } // Namespace Api
@@ -21,9 +21,17 @@ namespace Api
 class ACCELBYTEUE4SDK_API Fulfillment : public FApiBase
 {
 public:
+	DECLARE_MULTICAST_DELEGATE(FOnEntitlementsChanged);
+
 	Fulfillment(Credentials const& InCredentialsRef, Settings const& InSettingsRef, FHttpRetryScheduler& InHttpRef);
 	~Fulfillment();
 
+	/**
+	 * @brief Called when a code is redeemed, before the OnSuccess of RedeemCode, e.g. to invalidate the ownership cached
+	 * by FAccelByteOwnershipCache.
+	 */
+	FOnEntitlementsChanged& OnEntitlementsChanged() { return *EntitlementsChanged; }
+
 	/**
 	 * @brief Redeem Campaign Code to Receive In Game Item.
 	 *
@@ -45,6 +53,9 @@ private:
 	Fulfillment() = delete;
 	Fulfillment(Fulfillment const&) = delete;
 	Fulfillment(Fulfillment&&) = delete;
+
+	/** Shared with the request callbacks, which can outlive the API object. */
+	TSharedRef<FOnEntitlementsChanged, ESPMode::ThreadSafe> EntitlementsChanged;
 };
 
 } // Namespace Api
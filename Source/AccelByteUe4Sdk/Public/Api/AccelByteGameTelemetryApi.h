@@ -10,6 +10,8 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteOfflineWriteQueue.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
 #include "Core/AccelByteDefines.h"
 #include "Models/AccelByteGameTelemetryModels.h"
 
@@ -64,6 +66,16 @@ public:
 		, FVoidHandler const& OnSuccess
 		, FErrorHandler const& OnError);
 
+	/**
+	 * @brief Operation sending the events for FAccelByteOfflineWriteQueue, delivered at least once: a replay after a
+	 * lost response sends the events again. Enqueue it instead of calling Send, see EAccelByteOfflineReplaySafety.
+	 *
+	 * @param TelemetryBodies Telemetry requests with arbitrary payload.
+	 *
+	 * @return The operation, rejected by Enqueue when there is no event.
+	 */
+	FAccelByteOfflineOperation MakeSendEventsOperation(TArray<FAccelByteModelsTelemetryBody> const& TelemetryBodies) const;
+
 	/**
 	 * @brief Flush pending telemetry events
 	 */
@@ -85,6 +97,8 @@ public:
 	bool IsCacheUpdated() { return bCacheUpdated; }
 
 private:
+	static FString SerializeEvents(TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> const& Events);
+
 	void SendProtectedEvents(TArray<TSharedPtr<FAccelByteModelsTelemetryBody>> const& Events
 		, FVoidHandler const& OnSuccess
 		, FErrorHandler const& OnError);
@@ -131,7 +145,7 @@ private:
 	bool bTelemetryJobStarted = false;
 	FTimespan const MINIMUM_INTERVAL_TELEMETRY = FTimespan(0, 0, 5);
 	FTickerDelegate GameTelemetryTickDelegate;
-	FDelegateHandleAlias GameTelemetryTickDelegateHandle;
+	FAccelBytePeriodicTaskHandle GameTelemetryTickDelegateHandle;
 	FDelegateHandle GameTelemetryLoginSuccess;
 	FDelegateHandle GameTelemetryLogoutSuccess;
 
@@ -6,6 +6,7 @@
 
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
+#include "Core/AccelBytePageIterator.h"
 #include "Models/AccelByteGroupModels.h"
 
 namespace AccelByte
@@ -51,6 +52,17 @@ public:
 	FAccelByteTaskWPtr GetGroupList(FAccelByteModelsGetGroupListRequest const& RequestContent
 		, THandler<FAccelByteModelsGetGroupListResponse> const& OnSuccess
 		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Iterate every group matching the request, the next pages are fetched while the current one is consumed.
+	 *
+	 * @param RequestContent Group name and region to look for, Limit is the page size and Offset the first group.
+	 * @param Options Item cap and number of pages requested ahead.
+	 *
+	 * @return The page iterator, see TAccelBytePageIterator.
+	 */
+	TSharedRef<TAccelBytePageIterator<FAccelByteModelsGetGroupListResponse>, ESPMode::ThreadSafe> IterateGroupList(FAccelByteModelsGetGroupListRequest const& RequestContent
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions());
 	
 	/**
 	 * @brief Creates a new group.
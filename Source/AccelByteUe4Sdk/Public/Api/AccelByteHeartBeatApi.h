@@ -8,6 +8,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
 #include "Core/AccelByteDefines.h"
 
 namespace AccelByte
@@ -64,7 +65,7 @@ private:
 	FTimespan const HeartBeatInterval = FTimespan(0, 0, 60);
 
 	FTickerDelegate HeartBeatTickDelegate;
-	FDelegateHandleAlias HeartBeatTickDelegateHandle;
+	FAccelBytePeriodicTaskHandle HeartBeatTickDelegateHandle;
 	FHeartBeatResponse HeartBeatResponseDelegate;
 	FErrorHandler OnHeartBeatError;
 
@@ -8,6 +8,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePageIterator.h"
 #include "Models/AccelByteInventoryModels.h"
 
 namespace AccelByte
@@ -128,6 +129,25 @@ public:
 		, FString const& SourceItemId = TEXT("")
 		, FString const& Tags = TEXT(""));
 
+	/**
+	 * @brief Iterate every item of a specific user inventory, the next pages are fetched while the current one is consumed.
+	 *
+	 * @param InventoryId The id of user's inventory.
+	 * @param SortBy The sorting criteria for the list of inventory types. Value: createdAt, updatedAt, quantity. default = createdAt:desc.
+	 * @param PageSize Number of items per page. Default value : 100
+	 * @param Options Item cap and number of pages requested ahead.
+	 * @param SourceItemId The id of source item.
+	 * @param Tags The Tags of user's item.
+	 *
+	 * @return The page iterator, see TAccelBytePageIterator.
+	 */
+	TSharedRef<TAccelBytePageIterator<FAccelByteModelsUserItemsPagingResponse>, ESPMode::ThreadSafe> IterateUserInventoryAllItems(FString const& InventoryId
+		, EAccelByteUserItemsSortBy SortBy = EAccelByteUserItemsSortBy::CREATED_AT_DESC
+		, int32 PageSize = 100
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions()
+		, FString const& SourceItemId = TEXT("")
+		, FString const& Tags = TEXT(""));
+
 	/**
 	 * @brief Get a specific item from specific user inventory.
 	 *
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/AccelByteApiBase.h"
+#include "Core/AccelByteBulkFanOut.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteDefines.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
@@ -645,6 +646,11 @@ public:
 	 * @return true if it's connected, false otherwise.
 	 */
 	bool IsConnected() const;
+
+	/**
+	 * @brief Get the outbound queue statistics of the Lobby websocket, e.g. queue depth and dropped messages.
+	 */
+	FAccelByteWebSocketOutboundStats GetOutboundStats() const;
 	
 	/**
 	 * @brief Send ping
@@ -2621,10 +2627,12 @@ public:
 
 	/**
 	 * @brief Bulk Get User(s) Presence, can get specific user's presence status not limited to friend.
+	 * UserIds beyond the URL limit are split into multiple requests sent concurrently, see TAccelByteBulkFanOut.
 	 *
 	 * @param UserIds the list of UserId you want to request.
-	 * @param OnSuccess This will be called when the operation succeeded. The result is a FAccelByteModelsBulkUserStatusNotif.
-	 * @param OnError This will be called when the operation failed.
+	 * @param OnSuccess This will be called when the operation succeeded. The result is a FAccelByteModelsBulkUserStatusNotif,
+	 *		the UserIds of the requests that failed are listed in NotProcessed.
+	 * @param OnError This will be called when every request failed.
 	 * @param CountOnly Will only return the status count, without the user's data when set to true.
 	 * 
 	 * @return AccelByteTask object to track and cancel the ongoing API operation.
@@ -2814,7 +2822,10 @@ private:
 
     FString SendRawRequest(FString const& MessageType
     	, FString const& MessageIDPrefix
-    	, FString const& CustomPayload = TEXT(""));
+    	, FString const& CustomPayload = TEXT("")
+    	, EWebSocketMessagePriority Priority = EWebSocketMessagePriority::Critical
+    	, FString const& CoalesceKey = TEXT("")
+    	, FString* OutSupersededMessageId = nullptr);
 	
     FString GenerateMessageID(FString const& Prefix = TEXT("")) const;
 	
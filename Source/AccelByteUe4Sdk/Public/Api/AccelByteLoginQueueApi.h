@@ -9,6 +9,7 @@
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteApiBase.h"
+#include "Core/AccelByteLoginQueuePoller.h"
 #include "Models/AccelByteUserModels.h"
 
 namespace AccelByte
@@ -59,7 +60,33 @@ public:
 		, FErrorHandler const& OnError
 		, FString const& Namespace = TEXT(""));
 
+	/**
+	 * @brief Poll a Login Ticket until it reaches the front of the queue, spacing the polls out as described in
+	 * FAccelByteLoginQueuePoller. Cancelling the poller stops the polling, the ticket itself stays in the queue until
+	 * CancelTicket is called.
+	 *
+	 * @param TicketInfo Login Ticket returned by the login.
+	 * @param OnTicketUpdated This will be called on every successful poll.
+	 * @param OnReady This will be called once the ticket can be claimed with User::ClaimAccessToken.
+	 * @param OnError This will be called when the operation failed.
+	 * @param Namespace Namespace of the game
+	 *
+	 * @return Poller to cancel the polling, it must not outlive this API.
+	 */
+	FAccelByteLoginQueuePollerPtr PollTicket(FAccelByteModelsLoginQueueTicketInfo const& TicketInfo
+		, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnTicketUpdated
+		, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnReady
+		, FErrorHandler const& OnError
+		, FString const& Namespace = TEXT(""));
+
 private:
+	/**
+	 * @brief Same as RefreshTicket, with the Retry-After of the response.
+	 */
+	FAccelByteTaskWPtr RefreshTicketWithHints(FString const& Ticket
+		, FString const& Namespace
+		, THandler<FAccelByteLoginQueueRefreshResult> const& OnDone);
+
 	LoginQueue() = delete;
 	LoginQueue(LoginQueue const&) = delete;
 	LoginQueue(LoginQueue&&) = delete;
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
 #include "Models/AccelBytePresenceBroadcastEventModels.h"
 
 namespace AccelByte
@@ -133,7 +134,7 @@ private:
 	FTimespan BroadcastInterval = FTimespan(0, 10, 0);
 	const FTimespan MinimumBroadcastInterval = FTimespan(0, 0, 5);
 	FTickerDelegate PresenceBroadcastEventHeartbeatTickDelegate;
-	FDelegateHandleAlias PresenceBroadcastEventHeartbeatTickDelegateHandle;
+	FAccelBytePeriodicTaskHandle PresenceBroadcastEventHeartbeatTickDelegateHandle;
 
 	FVoidHandler OnSendPresenceHeartbeatSuccess;
 	FErrorHandler OnSendPresenceHeartbeatError;
@@ -8,6 +8,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePageIterator.h"
 #include "Models/AccelByteSessionModels.h"
 #include "Core/AccelByteUtilities.h"
 
@@ -75,6 +76,19 @@ public:
 		, int32 Offset = 0
 		, int32 Limit = 20);
 
+	/**
+	 * @brief Iterate every game session matching the query, the next pages are fetched while the current one is consumed.
+	 *
+	 * @param QueryObject Query object containing the parameters to query on, copied when the iterator is created.
+	 * @param PageSize Number of game sessions per page. Default value : 20
+	 * @param Options Item cap and number of pages requested ahead.
+	 *
+	 * @return The page iterator, see TAccelBytePageIterator.
+	 */
+	TSharedRef<TAccelBytePageIterator<FAccelByteModelsV2PaginatedGameSessionQueryResult>, ESPMode::ThreadSafe> IterateGameSessions(FAccelByteModelsV2GameSessionQuery const& QueryObject
+		, int32 PageSize = 20
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions());
+
 	/**
 	 * @brief Update a game session by ID.
 	 *
@@ -8,6 +8,9 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteOfflineWriteQueue.h"
+#include "Core/AccelBytePageIterator.h"
+#include "Core/AccelByteStatIncrementAccumulator.h"
 #include "Models/AccelByteStatisticModels.h"
 
 namespace AccelByte
@@ -24,7 +27,7 @@ namespace Api
 class ACCELBYTEUE4SDK_API Statistic : public FApiBase
 {
 public:
-	Statistic(Credentials const& InCredentialsRef, Settings const& InSettingsRef, FHttpRetryScheduler& InHttpRef);
+	Statistic(Credentials& InCredentialsRef, Settings const& InSettingsRef, FHttpRetryScheduler& InHttpRef);
 	~Statistic();
 
 	/**
@@ -79,6 +82,23 @@ public:
 		, int32 Offset = 0
 		, EAccelByteStatisticSortBy SortBy = EAccelByteStatisticSortBy::UPDATED_AT_ASC );
 
+	/**
+	 * @brief Iterate every stat item of this user, the next pages are fetched while the current one is consumed.
+	 *
+	 * @param StatCodes Specify statCodes for stat items to get, empty for every stat item.
+	 * @param Tags Specify tags for for stat items to get, empty for every stat item.
+	 * @param PageSize Number of stat items per page. Default value : 100
+	 * @param Options Item cap and number of pages requested ahead.
+	 * @param SortBy The container to store sortby.
+	 *
+	 * @return The page iterator, see TAccelBytePageIterator.
+	 */
+	TSharedRef<TAccelBytePageIterator<FAccelByteModelsUserStatItemPagingSlicedResult>, ESPMode::ThreadSafe> IterateUserStatItems(TArray<FString> const& StatCodes
+		, TArray<FString> const& Tags
+		, int32 PageSize = 100
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions()
+		, EAccelByteStatisticSortBy SortBy = EAccelByteStatisticSortBy::UPDATED_AT_ASC);
+
 	/**
 	 * @brief Get user's specified stat items and specifying statCodes and tags to get from. Returned stat items will only contain
 	 * stat items specified by statCodes and tags (inclusive)
@@ -114,6 +134,22 @@ public:
 	FAccelByteTaskWPtr IncrementUserStatItems(TArray<FAccelByteModelsBulkStatItemInc> const& Data
 		, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> const& OnSuccess
 		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Queue increments of this user stat items instead of sending them right away.
+	 * Increments of the same stat code are merged and sent in bulk on an interval, see FAccelByteStatIncrementAccumulator.
+	 * Increments left by a previous run are reloaded and sent when the same user logs in.
+	 *
+	 * @param Data array consist of increased value and stat code.
+	 */
+	void QueueIncrementUserStatItems(TArray<FAccelByteModelsBulkStatItemInc> const& Data);
+
+	/**
+	 * @brief Send the queued increments now, e.g. at match end.
+	 *
+	 * @param OnDone This will be called once the queued increments are sent, with false if the request failed.
+	 */
+	void FlushQueuedStatItemIncrements(THandler<bool> const& OnDone = THandler<bool>());
  
 	/**
 	 * @brief Public list all statItems of user.
@@ -167,6 +203,21 @@ public:
 		, THandler<FAccelByteModelsUpdateUserStatItemValueResponse> const& OnSuccess
 		, FErrorHandler const& OnError);
 
+	/**
+	 * @brief Operation of UpdateUserStatItemsValue for FAccelByteOfflineWriteQueue. Only the OVERRIDE, MIN and MAX
+	 * strategies are replay safe, overrides of the same stat item are coalesced to the latest one. An INCREMENT would be
+	 * applied twice by a replay, use QueueIncrementUserStatItems instead.
+	 *
+	 * @param StatCode StatCode.
+	 * @param AdditionalKey This is the AdditionalKey that will be stored in the slot.
+	 * @param UpdateUserStatItem This is the UpdateUserStatItem that will be stored in the slot.
+	 *
+	 * @return The operation, rejected by Enqueue for an INCREMENT or an empty stat code.
+	 */
+	FAccelByteOfflineOperation MakeUpdateUserStatItemsValueOperation(FString const& StatCode
+		, FString const& AdditionalKey
+		, FAccelByteModelsPublicUpdateUserStatItem const& UpdateUserStatItem) const;
+
 	/**
 	 * @brief Public bulk fetch multiple user's statitem value for a given namespace and statCode.
 	 *
@@ -339,6 +390,16 @@ private:
 	Statistic(Statistic&&) = delete;
 	
 	static FString ConvertUserStatisticSortByToString(EAccelByteStatisticSortBy SortBy);
+
+	void OnLoginSuccess(FOauth2Token const& Response);
+	FAccelByteStatIncrementAccumulatorPtr GetIncrementAccumulator(FString const& UserId);
+
+	TSharedRef<Credentials, ESPMode::ThreadSafe> CredentialsRef;
+	FDelegateHandle IncrementLoginSuccess;
+
+	/** Created for the user on login, so the increments persisted by a previous run are sent. */
+	FAccelByteStatIncrementAccumulatorPtr IncrementAccumulator;
+	FString IncrementAccumulatorUserId;
 };
 } // Namespace Api
 } // Namespace AccelByte
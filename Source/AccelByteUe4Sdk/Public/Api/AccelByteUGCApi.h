@@ -9,6 +9,7 @@
 
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePageIterator.h"
 #include "Models/AccelByteUGCModels.h"
 
 namespace AccelByte
@@ -603,6 +604,19 @@ public:
 		, int32 Limit = 1000
 		, int32 Offset = 0);
 
+	/**
+	 * @brief Iterate every user's generated content, the next pages are fetched while the current one is consumed.
+	 *
+	 * @param UserId User Id
+	 * @param PageSize Number of content per page. Default value : 100
+	 * @param Options Item cap and number of pages requested ahead.
+	 *
+	 * @return The page iterator, see TAccelBytePageIterator.
+	 */
+	TSharedRef<TAccelBytePageIterator<FAccelByteModelsUGCContentPageResponse>, ESPMode::ThreadSafe> IterateUserContent(FString const& UserId
+		, int32 PageSize = 100
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions());
+
 	/**
 	* @brief Get user's generated contents. Can be used without logged in.
 	*
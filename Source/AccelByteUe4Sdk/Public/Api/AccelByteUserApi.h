@@ -9,6 +9,7 @@
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteApiBase.h"
+#include "Core/AccelByteBulkFanOut.h"
 #include "Models/AccelByteUserModels.h"
 
 namespace AccelByte
@@ -1273,16 +1274,19 @@ public:
 
 	/**
 	 * @brief This function will get user(s) information like user's DisplayName.
+	 * UserIds beyond the endpoint limit are split into multiple requests sent concurrently, see TAccelByteBulkFanOut.
 	 *
 	 * @param UserIds List UserId(s) to get.
 	 * @param OnSuccess This will be called when the operation succeeded. The result is FListBulkUserInfo.
-	 * @param OnError This will be called when the operation failed.
+	 * @param OnError This will be called when every request failed.
+	 * @param OnPartialFailure optional. This will be called before OnSuccess with the UserIds of the requests that failed.
 	 * 
 	 * @return AccelByteTask object to track and cancel the ongoing API operation.
 	 */
 	FAccelByteTaskWPtr BulkGetUserInfo(TArray<FString> const& UserIds
 		, THandler<FListBulkUserInfo> const& OnSuccess
-		, FErrorHandler const& OnError);
+		, FErrorHandler const& OnError
+		, FAccelByteBulkFailuresHandler const& OnPartialFailure = FAccelByteBulkFailuresHandler());
 
 	/**
 	 * @brief This function will get user input validation
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/AccelByteApiBase.h"
+#include "Core/AccelByteBulkFanOut.h"
 #include "UObject/NoExportTypes.h"
 #include "Models/AccelByteUserProfileModels.h"
 #include "Core/AccelByteError.h"
@@ -70,16 +71,19 @@ public:
 
 	/**
 	 * @brief Bulk get multiple user public profile information.
+	 * UserIds beyond the URL limit are split into multiple requests sent concurrently, see TAccelByteBulkFanOut.
 	 *
 	 * @param UserIds Multiple user ids.
 	 * @param OnSuccess This will be called when the operation succeeded.
-	 * @param OnError This will be called when the operation failed.
+	 * @param OnError This will be called when every request failed.
+	 * @param OnPartialFailure optional. This will be called before OnSuccess with the UserIds of the requests that failed.
 	 * 
 	 * @return AccelByteTask object to track and cancel the ongoing API operation.
 	 */
 	FAccelByteTaskWPtr BulkGetPublicUserProfileInfos(TArray<FString> const& UserIds
 		, THandler<TArray<FAccelByteModelsPublicUserProfileInfo>> const& OnSuccess
-		, FErrorHandler const& OnError);
+		, FErrorHandler const& OnError
+		, FAccelByteBulkFailuresHandler const& OnPartialFailure = FAccelByteBulkFailuresHandler());
 
 	/**
 	 * @brief Bulk get multiple user public profile information.
@@ -36,6 +36,12 @@ protected:
 	Settings const& SettingsRef;
 	FHttpRetryScheduler& HttpRef;
 	FHttpClient HttpClient;
+
+	/**
+	 * @brief Non owning handle of HttpClient that expires when the API object is destroyed. Callbacks that send
+	 * requests after the call returned capture a weak pointer to it instead of this.
+	 */
+	TSharedRef<FHttpClient, ESPMode::ThreadSafe> HttpClientHandle;
 };
 
 }
@@ -53,6 +53,8 @@
 #include "Api/AccelByteGameStandardEventApi.h"
 #include "Api/AccelByteLoginQueueApi.h"
 #include "Core/AccelByteMessagingSystem.h"
+#include "Core/AccelByteEntityCache.h"
+#include "Core/AccelByteOwnershipCache.h"
 #include "Api/AccelByteChallengeApi.h"
 
 namespace AccelByte
@@ -137,6 +139,11 @@ public:
 	Api::GameStandardEvent GameStandardEvent{ *CredentialsRef, FRegistry::Settings, *HttpRef };
 #pragma endregion
 
+#pragma region Cache
+	FAccelByteEntityCache EntityCache{ Lobby, User, UserProfile, *MessagingSystem.Get() };
+	FAccelByteOwnershipCache OwnershipCache{ *CredentialsRef, Entitlement, Fulfillment, Lobby };
+#pragma endregion
+
 	template<typename T, typename... U>
 	T GetApi(U&&... Args)
 	{
@@ -86,7 +86,6 @@ protected:
 	const int32 MaxBackoffCount = 10;
 	const double BackoffRatio = 0.5;
 
-	FDelegateHandleAlias PollRefreshTokenHandle;
 	FTokenRefreshedEvent TokenRefreshedEvent;
 };
 
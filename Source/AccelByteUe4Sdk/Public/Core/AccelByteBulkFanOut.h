@@ -0,0 +1,348 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+#include "Core/AccelByteUtilities.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Ids of a chunk that failed during a bulk request, along with the error returned for that chunk.
+ */
+struct FAccelByteBulkFailure
+{
+	TArray<FString> Ids;
+	int32 ErrorCode {0};
+	FString ErrorMessage;
+};
+
+using FAccelByteBulkFailuresHandler = THandler<TArray<FAccelByteBulkFailure>>;
+
+/**
+ * @brief Split an id list into chunks that fit the endpoint limit and send them concurrently.
+ * At most MaxInFlight chunks are in flight at the same time, the next chunk is sent as soon as one is done. The results
+ * of the successful chunks are merged into a single result, the failed chunks are reported with their ids so the
+ * caller can surface a partial failure instead of losing the whole request.
+ *
+ * The default in-flight budget is [AccelByte.Http] BulkMaxInFlightRequests (default 4) in DefaultEngine.ini.
+ * The fan-out is itself an FAccelByteTask, cancelling it cancels the chunks in flight and drops the remaining ones.
+ * A chunk whose request is over, or was never created, without any of its handlers being called is reported as failed
+ * with ErrorCodes::RequestCancelled, so the fan-out always completes.
+ */
+template<typename TResult>
+class TAccelByteBulkFanOut
+	: public FAccelByteTask
+	, public TSharedFromThis<TAccelByteBulkFanOut<TResult>, ESPMode::ThreadSafe>
+{
+public:
+	/** Send the request of one chunk, returns the task of the request. */
+	using FChunkRequest = TFunction<FAccelByteTaskWPtr(TArray<FString> const& /*ChunkIds*/, THandler<TResult> const& /*OnSuccess*/, FErrorHandler const& /*OnError*/)>;
+	/** Merge the result of one chunk into the final result. */
+	using FMergeResult = TFunction<void(TResult& /*Merged*/, TResult const& /*Chunk*/)>;
+	/** Called once every chunk is done, Failures is empty if every chunk succeeded. */
+	using FOnComplete = TFunction<void(TResult& /*Merged*/, TArray<FAccelByteBulkFailure> const& /*Failures*/, bool /*bAnySucceeded*/)>;
+
+	/**
+	 * @brief Start the bulk request.
+	 *
+	 * @param Ids Every id to request, duplicated ids are only requested once.
+	 * @param ChunkSize Maximum number of ids the endpoint accepts in one request.
+	 * @param ChunkRequest Send the request of one chunk.
+	 * @param MergeResult Merge the result of one chunk into the final result.
+	 * @param OnComplete Called once every chunk is done.
+	 * @param MaxInFlight Maximum number of chunks in flight, 0 to use the configured budget.
+	 *
+	 * @return The fan-out task, which can be used to cancel the whole bulk request.
+	 */
+	static FAccelByteTaskWPtr Run(TArray<FString> const& Ids
+		, int32 ChunkSize
+		, FChunkRequest ChunkRequest
+		, FMergeResult MergeResult
+		, FOnComplete OnComplete
+		, int32 MaxInFlight = 0)
+	{
+		TSharedRef<TAccelByteBulkFanOut, ESPMode::ThreadSafe> FanOut = MakeShared<TAccelByteBulkFanOut, ESPMode::ThreadSafe>(
+			MoveTemp(ChunkRequest), MoveTemp(MergeResult), MoveTemp(OnComplete), MaxInFlight > 0 ? MaxInFlight : GetConfiguredMaxInFlight());
+
+		TArray<FString> UniqueIds;
+		UniqueIds.Reserve(Ids.Num());
+		TSet<FString> SeenIds;
+		SeenIds.Reserve(Ids.Num());
+		for (FString const& Id : Ids)
+		{
+			bool bIsAlreadySeen = false;
+			SeenIds.Add(Id, &bIsAlreadySeen);
+			if (!bIsAlreadySeen)
+			{
+				UniqueIds.Add(Id);
+			}
+		}
+
+		const int32 SafeChunkSize = FMath::Max(1, ChunkSize);
+		for (int32 Start = 0; Start < UniqueIds.Num(); Start += SafeChunkSize)
+		{
+			const int32 Count = FMath::Min(SafeChunkSize, UniqueIds.Num() - Start);
+			FanOut->PendingChunks.Emplace(UniqueIds.GetData() + Start, Count);
+		}
+		FanOut->RemainingChunks = FanOut->PendingChunks.Num();
+
+		if (FanOut->RemainingChunks == 0)
+		{
+			FanOut->TaskState = EAccelByteTaskState::Completed;
+			FanOut->Finish();
+			if (FanOut->OnComplete)
+			{
+				FanOut->OnComplete(FanOut->MergedResult, FanOut->Failures, true);
+			}
+			return FanOut;
+		}
+
+		FanOut->SendPendingChunks();
+		FanOut->StartWatchdog();
+		return FanOut;
+	}
+
+	TAccelByteBulkFanOut(FChunkRequest&& InChunkRequest, FMergeResult&& InMergeResult, FOnComplete&& InOnComplete, int32 InMaxInFlight)
+		: ChunkRequest(MoveTemp(InChunkRequest))
+		, MergeResult(MoveTemp(InMergeResult))
+		, OnComplete(MoveTemp(InOnComplete))
+		, MaxInFlight(FMath::Max(1, InMaxInFlight))
+	{
+		TaskState = EAccelByteTaskState::Running;
+	}
+
+	virtual bool Cancel() override
+	{
+		TArray<FAccelByteTaskWPtr> TasksToCancel;
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (bIsCancelled || RemainingChunks == 0)
+			{
+				return false;
+			}
+			bIsCancelled = true;
+			PendingChunks.Empty();
+			TaskState = EAccelByteTaskState::Cancelled;
+			for (auto const& Chunk : InFlightChunks)
+			{
+				TasksToCancel.Add(Chunk.Value.Task);
+			}
+			InFlightChunks.Empty();
+		}
+
+		for (FAccelByteTaskWPtr const& TaskWPtr : TasksToCancel)
+		{
+			FAccelByteTaskPtr TaskPtr = TaskWPtr.Pin();
+			if (TaskPtr.IsValid())
+			{
+				TaskPtr->Cancel();
+			}
+		}
+		return FAccelByteTask::Cancel();
+	}
+
+private:
+	struct FInFlightChunk
+	{
+		TArray<FString> Ids;
+		FAccelByteTaskWPtr Task;
+
+		/** Consecutive watchdog checks that found the request over while no handler was called yet. */
+		int32 UnansweredCheckCount {0};
+	};
+
+	/** Period of the check of the chunks in flight, a chunk is failed after it was found unanswered twice in a row. */
+	static constexpr float WatchdogPeriodSeconds = 1.0f;
+	static constexpr int32 MaxUnansweredCheckCount = 2;
+
+	static int32 GetConfiguredMaxInFlight()
+	{
+		int32 ConfiguredMaxInFlight = 4;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("AccelByte.Http"), TEXT("BulkMaxInFlightRequests"), ConfiguredMaxInFlight);
+		return ConfiguredMaxInFlight;
+	}
+
+	void SendPendingChunks()
+	{
+		while (true)
+		{
+			int32 ChunkIndex = INDEX_NONE;
+			TArray<FString> ChunkIds;
+			{
+				FScopeLock ScopeLock(&Lock);
+				if (bIsCancelled || PendingChunks.Num() == 0 || InFlightChunks.Num() >= MaxInFlight)
+				{
+					return;
+				}
+				ChunkIds = PendingChunks[0];
+				PendingChunks.RemoveAt(0);
+				ChunkIndex = NextChunkIndex++;
+				InFlightChunks.Add(ChunkIndex, FInFlightChunk{ ChunkIds });
+			}
+
+			// The chunk callbacks keep the fan-out alive until every chunk is done
+			TSharedRef<TAccelByteBulkFanOut, ESPMode::ThreadSafe> FanOut = this->AsShared();
+			FAccelByteTaskWPtr ChunkTask = ChunkRequest(ChunkIds
+				, THandler<TResult>::CreateLambda([FanOut, ChunkIndex](TResult const& Result)
+					{
+						FanOut->OnChunkDone(ChunkIndex, &Result, nullptr);
+					})
+				, FErrorHandler::CreateLambda([FanOut, ChunkIndex, ChunkIds](int32 ErrorCode, FString const& ErrorMessage)
+					{
+						FAccelByteBulkFailure Failure{ ChunkIds, ErrorCode, ErrorMessage };
+						FanOut->OnChunkDone(ChunkIndex, nullptr, &Failure);
+					}));
+
+			FScopeLock ScopeLock(&Lock);
+			if (FInFlightChunk* Chunk = InFlightChunks.Find(ChunkIndex))
+			{
+				Chunk->Task = ChunkTask;
+			}
+		}
+	}
+
+	void StartWatchdog()
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (bIsCancelled || RemainingChunks == 0)
+			{
+				return;
+			}
+		}
+
+		// Holds the fan-out until it is done, the chunk callbacks may be destroyed without being called
+		TSharedRef<TAccelByteBulkFanOut, ESPMode::ThreadSafe> FanOut = this->AsShared();
+		FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[FanOut](float DeltaTime)
+			{
+				return FanOut->FailUnansweredChunks();
+			}), WatchdogPeriodSeconds);
+	}
+
+	/** @return false once the fan-out is done and the watchdog can stop. */
+	bool FailUnansweredChunks()
+	{
+		TArray<TPair<int32, FAccelByteBulkFailure>> UnansweredChunks;
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (bIsCancelled || RemainingChunks == 0)
+			{
+				return false;
+			}
+
+			for (auto& Chunk : InFlightChunks)
+			{
+				FAccelByteTaskPtr const TaskPtr = Chunk.Value.Task.Pin();
+				const bool bIsRequestOver = !TaskPtr.IsValid()
+					|| TaskPtr->State() == EAccelByteTaskState::Completed
+					|| TaskPtr->State() == EAccelByteTaskState::Failed
+					|| TaskPtr->State() == EAccelByteTaskState::Cancelled;
+				Chunk.Value.UnansweredCheckCount = bIsRequestOver ? Chunk.Value.UnansweredCheckCount + 1 : 0;
+				if (Chunk.Value.UnansweredCheckCount >= MaxUnansweredCheckCount)
+				{
+					UnansweredChunks.Emplace(Chunk.Key, FAccelByteBulkFailure{ Chunk.Value.Ids
+						, static_cast<int32>(ErrorCodes::RequestCancelled)
+						, TEXT("The request of the chunk ended without a response") });
+				}
+			}
+		}
+
+		for (auto const& UnansweredChunk : UnansweredChunks)
+		{
+			OnChunkDone(UnansweredChunk.Key, nullptr, &UnansweredChunk.Value);
+		}
+		return true;
+	}
+
+	void OnChunkDone(int32 ChunkIndex, TResult const* Result, FAccelByteBulkFailure const* Failure)
+	{
+		bool bIsDone = false;
+		{
+			FScopeLock ScopeLock(&Lock);
+			// A chunk already failed by the watchdog may still get a late response, it's ignored
+			if (bIsCancelled || InFlightChunks.Remove(ChunkIndex) == 0)
+			{
+				return;
+			}
+
+			if (Result != nullptr)
+			{
+				MergeResult(MergedResult, *Result);
+				bAnySucceeded = true;
+			}
+			if (Failure != nullptr)
+			{
+				Failures.Add(*Failure);
+			}
+
+			RemainingChunks--;
+			bIsDone = RemainingChunks == 0;
+		}
+
+		if (!bIsDone)
+		{
+			SendPendingChunks();
+			return;
+		}
+
+		TaskState = Failures.Num() == 0 ? EAccelByteTaskState::Completed : EAccelByteTaskState::Failed;
+		Finish();
+		if (OnComplete)
+		{
+			OnComplete(MergedResult, Failures, bAnySucceeded);
+		}
+	}
+
+	FChunkRequest ChunkRequest;
+	FMergeResult MergeResult;
+	FOnComplete OnComplete;
+	const int32 MaxInFlight;
+
+	FCriticalSection Lock;
+	TArray<TArray<FString>> PendingChunks;
+	TMap<int32, FInFlightChunk> InFlightChunks;
+	int32 NextChunkIndex {0};
+	int32 RemainingChunks {0};
+	bool bIsCancelled {false};
+	bool bAnySucceeded {false};
+	TResult MergedResult {};
+	TArray<FAccelByteBulkFailure> Failures;
+};
+
+/**
+ * @brief Report the outcome of a bulk request the same way a single request would.
+ * OnError gets the error of the first failed chunk when no chunk succeeded, otherwise OnPartialFailure gets the failed
+ * chunks (if any) and OnSuccess gets the merged result of the successful ones.
+ */
+template<typename TResult>
+void ReportBulkResult(TResult const& Merged
+	, TArray<FAccelByteBulkFailure> const& Failures
+	, bool bAnySucceeded
+	, THandler<TResult> const& OnSuccess
+	, FErrorHandler const& OnError
+	, FAccelByteBulkFailuresHandler const& OnPartialFailure)
+{
+	if (!bAnySucceeded && Failures.Num() > 0)
+	{
+		OnError.ExecuteIfBound(Failures[0].ErrorCode, Failures[0].ErrorMessage);
+		return;
+	}
+
+	if (Failures.Num() > 0)
+	{
+		OnPartialFailure.ExecuteIfBound(Failures);
+	}
+	OnSuccess.ExecuteIfBound(Merged);
+}
+
+}
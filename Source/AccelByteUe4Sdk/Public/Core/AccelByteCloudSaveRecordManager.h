@@ -0,0 +1,223 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+
+namespace AccelByte
+{
+namespace Api
+{
+	class CloudSave;
+}
+namespace GameServerApi
+{
+	class ServerCloudSave;
+}
+
+/**
+ * @brief A record value and the time it was last updated, as known by the backend.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteCloudSaveRecordSnapshot
+{
+	TSharedPtr<FJsonObject> Value;
+
+	/** Zero when the endpoint doesn't return it. */
+	FDateTime UpdatedAt{0};
+};
+
+/**
+ * @brief Upload volume of a record manager, to compare against saving every record in full.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteCloudSaveUploadStats
+{
+	/** Number of SaveRecord calls. */
+	int32 SaveCount{0};
+
+	/** Number of write requests actually sent, after coalescing. */
+	int32 WriteCount{0};
+
+	/** Number of writes sent as a delta of the changed fields. */
+	int32 DeltaWriteCount{0};
+
+	/** Number of writes that found the record changed by someone else and fell back to a full replace. */
+	int32 ConflictCount{0};
+
+	/** Bytes uploaded if every SaveRecord call had replaced the full record. */
+	int64 FullRecordBytes{0};
+
+	/** Bytes actually uploaded. */
+	int64 UploadedBytes{0};
+};
+
+class FAccelByteCloudSaveRecordManager;
+typedef TSharedPtr<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe> FAccelByteCloudSaveRecordManagerPtr;
+
+/**
+ * @brief Opt-in writer of cloud save records that uploads only what changed.
+ * The manager keeps a shadow copy of each record as last known by the backend. Saving a record computes its JSON
+ * merge patch (RFC 7396) against the shadow and sends the changed top level fields with the append endpoint, which
+ * merges them into the stored record. Removed top level fields can't be expressed as an append, those records are
+ * replaced in full.
+ *
+ * Saves of the same key within [AccelByte.CloudSave] RecordSaveCoalesceMilliseconds (default 500) are coalesced
+ * into a single write of the latest value.
+ *
+ * The shadow's updatedAt is used for optimistic concurrency: when the append response shows the record was changed by
+ * someone else, or a concurrent replace is rejected, the record is fetched again and replaced in full with the saved
+ * value. Server records have no concurrent replace endpoint, their replace is unconditional.
+ *
+ * The manager must not outlive the API it writes with.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteCloudSaveRecordManager
+	: public TSharedFromThis<FAccelByteCloudSaveRecordManager, ESPMode::ThreadSafe>
+{
+public:
+	/**
+	 * @brief Endpoints of one kind of record.
+	 */
+	struct FBackend
+	{
+		TFunction<FAccelByteTaskWPtr(FString const& /*Key*/
+			, THandler<FAccelByteCloudSaveRecordSnapshot> const& /*OnSuccess*/
+			, FErrorHandler const& /*OnError*/)> GetRecord;
+
+		/** Append the top level fields to the record, the snapshot value is invalid when the endpoint doesn't return the record. */
+		TFunction<FAccelByteTaskWPtr(FString const& /*Key*/
+			, FJsonObject const& /*Fields*/
+			, THandler<FAccelByteCloudSaveRecordSnapshot> const& /*OnSuccess*/
+			, FErrorHandler const& /*OnError*/)> AppendRecord;
+
+		/** Replace the whole record, called back with the new updatedAt or zero when the endpoint doesn't return it. */
+		TFunction<FAccelByteTaskWPtr(FString const& /*Key*/
+			, FDateTime const& /*UpdatedAt*/
+			, FJsonObject const& /*Value*/
+			, THandler<FDateTime> const& /*OnSuccess*/
+			, FErrorHandler const& /*OnError*/)> ReplaceRecord;
+
+		/** Whether ReplaceRecord is rejected with ConflictErrorCode when the record changed after UpdatedAt. */
+		bool bReplaceChecksUpdatedAt{false};
+
+		int32 NotFoundErrorCode{0};
+		int32 ConflictErrorCode{0};
+	};
+
+	/**
+	 * @brief Create a manager of the logged in user records.
+	 */
+	static FAccelByteCloudSaveRecordManagerPtr CreateForUserRecords(Api::CloudSave& CloudSave);
+
+	/**
+	 * @brief Create a manager of the namespace game records, written by the game server.
+	 */
+	static FAccelByteCloudSaveRecordManagerPtr CreateForGameRecords(GameServerApi::ServerCloudSave& ServerCloudSave);
+
+	/**
+	 * @brief Create a manager of a user records, written by the game server.
+	 */
+	static FAccelByteCloudSaveRecordManagerPtr CreateForUserRecords(GameServerApi::ServerCloudSave& ServerCloudSave, FString const& UserId);
+
+	explicit FAccelByteCloudSaveRecordManager(FBackend InBackend);
+	~FAccelByteCloudSaveRecordManager();
+
+	/**
+	 * @brief Start writing the coalesced saves, called by the Create functions.
+	 */
+	void Startup();
+
+	/**
+	 * @brief Stop writing, saves that are not written yet are dropped.
+	 */
+	void Shutdown();
+
+	/**
+	 * @brief Get a record from the backend and keep it as the shadow of the next save.
+	 *
+	 * @param Key Key of record.
+	 * @param OnSuccess This will be called when the operation succeeded.
+	 * @param OnError This will be called when the operation failed.
+	 */
+	void LoadRecord(FString const& Key
+		, THandler<FAccelByteCloudSaveRecordSnapshot> const& OnSuccess
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Save the whole value of a record, only the difference with the last known value is uploaded.
+	 *
+	 * @param Key Key of record.
+	 * @param Value The full value of the record.
+	 * @param OnSuccess This will be called once the value, or a later save of the same key, is written.
+	 * @param OnError This will be called when the write failed.
+	 */
+	void SaveRecord(FString const& Key
+		, FJsonObject const& Value
+		, FVoidHandler const& OnSuccess
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Write every coalesced save now, e.g. before the game exits.
+	 */
+	void Flush();
+
+	/**
+	 * @brief Drop the shadow of a record, the next save fetches the record first.
+	 */
+	void ForgetRecord(FString const& Key);
+
+	FAccelByteCloudSaveUploadStats GetUploadStats() const;
+
+	/**
+	 * @brief Compute the JSON merge patch (RFC 7396) that turns Source into Target.
+	 */
+	static TSharedRef<FJsonObject> CreateMergePatch(FJsonObject const& Source, FJsonObject const& Target);
+
+private:
+	struct FRecordState
+	{
+		/** Value last known by the backend, invalid until fetched or written. */
+		TSharedPtr<FJsonObject> Shadow;
+		FDateTime ShadowUpdatedAt{0};
+
+		/** Latest saved value waiting for the coalescing delay. */
+		TSharedPtr<FJsonObject> Pending;
+		double PendingDueTime{0.0};
+		TArray<FVoidHandler> PendingOnSuccess;
+		TArray<FErrorHandler> PendingOnError;
+
+		/** Value of the write in progress. */
+		TSharedPtr<FJsonObject> Writing;
+		TArray<FVoidHandler> WritingOnSuccess;
+		TArray<FErrorHandler> WritingOnError;
+	};
+
+	bool Tick(float DeltaTime);
+	void StartWrite(FString const& Key);
+	void WriteDelta(FString const& Key);
+	void WriteFull(FString const& Key, FDateTime const& UpdatedAt, bool bRetryOnConflict);
+	void RefetchAndWriteFull(FString const& Key);
+	void FinishWrite(FString const& Key, bool bSucceeded, int32 ErrorCode = 0, FString const& ErrorMessage = TEXT(""));
+	void SetShadow(FString const& Key, TSharedPtr<FJsonObject> const& Value, FDateTime const& UpdatedAt);
+
+	static TSharedPtr<FJsonObject> CloneJsonObject(FJsonObject const& Object);
+	static TSharedPtr<FJsonValue> CloneJsonValue(TSharedPtr<FJsonValue> const& Value);
+	static bool JsonObjectsEqual(FJsonObject const& Lhs, FJsonObject const& Rhs);
+	static bool JsonValuesEqual(TSharedPtr<FJsonValue> const& Lhs, TSharedPtr<FJsonValue> const& Rhs);
+	static int32 GetSerializedSize(TSharedPtr<FJsonObject> const& Object);
+
+	FBackend const Backend;
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FRecordState> Records;
+	FAccelByteCloudSaveUploadStats UploadStats;
+
+	double CoalesceSeconds{0.5};
+	FDelegateHandleAlias TickerHandle;
+};
+
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
+
+namespace AccelByte
+{
+
+class Settings;
+class ServerSettings;
+
+/**
+ * @brief Warmup result of a host.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteHostWarmupStats
+{
+	/** Scheme, host and port, e.g. "https://demo.accelbyte.io". */
+	FString Host;
+
+	bool bIsResolved {false};
+	double DnsSeconds {0.0};
+
+	/** Whether the host answered the warmup request, whatever the status code. */
+	bool bIsConnected {false};
+
+	/** First warmup request after the DNS lookup, the TCP and TLS handshakes and one round trip. */
+	double ConnectSeconds {0.0};
+
+	/** Latest keep alive request, one round trip over the pooled connection. */
+	double KeepAliveSeconds {0.0};
+
+	int32 RequestCount {0};
+};
+
+/**
+ * @brief Opt-in warmup of the connections to the configured service hosts, so the first login doesn't pay for the DNS
+ * lookup and the TCP and TLS handshakes.
+ *
+ * Enabled with [AccelByte.Http] bEnableConnectionWarmup (default false), the module then warms the hosts of the
+ * settings on the first frame and again when the environment changes. Every distinct host is resolved on a background
+ * thread, then gets a HEAD request sent straight to the HTTP module, bypassing the retry scheduler, so the platform
+ * HTTP pool keeps an open connection to it. A HEAD request is sent again to every connected host every
+ * ConnectionKeepAliveSeconds (default 30, 0 to disable) so the pooled connections don't idle out.
+ *
+ * WebSocket hosts, e.g. the lobby, are only resolved, their connections are not shared with the HTTP pool.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteConnectionWarmup
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnWarmupComplete, TArray<FAccelByteHostWarmupStats> const& /*Stats*/);
+
+	void LoadConfig();
+
+	bool IsEnabled() const { return bIsEnabled; }
+
+	/**
+	 * @brief Resolve and connect to the hosts of the URLs not warmed yet.
+	 * Hosts warmed by a previous call and missing from the URLs are forgotten, e.g. after an environment change.
+	 */
+	void Warmup(TArray<FString> const& Urls);
+
+	/**
+	 * @brief Stop the keep alive and cancel the warmup requests in flight.
+	 */
+	void Shutdown();
+
+	TArray<FAccelByteHostWarmupStats> GetStats() const;
+
+	/**
+	 * @brief Called on the game thread once every host of a Warmup call was resolved and answered or failed.
+	 */
+	FOnWarmupComplete& OnWarmupComplete() { return WarmupComplete; }
+
+	static TArray<FString> GetServiceUrls(Settings const& InSettings);
+	static TArray<FString> GetServiceUrls(ServerSettings const& InSettings);
+
+	/**
+	 * @brief Scheme, host and port of a URL, WebSocket schemes are mapped to their HTTP counterpart.
+	 */
+	static FString GetHostUrl(FString const& Url);
+
+	static FString GetHostName(FString const& HostUrl);
+
+private:
+	void Resolve(FString const& HostUrl, bool bIsHttpHost);
+	void SendWarmupRequest(FString const& HostUrl, bool bIsKeepAlive);
+	void OnHostDone();
+	bool KeepAlive(float DeltaTime);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FAccelByteHostWarmupStats> Stats;
+	TMap<FString, FHttpRequestPtr> InFlightRequests;
+	int32 PendingHostCount {0};
+	bool bIsShuttingDown {false};
+	FAccelBytePeriodicTaskHandle KeepAliveHandle;
+	FOnWarmupComplete WarmupComplete;
+
+	bool bIsEnabled {false};
+	float KeepAliveIntervalSeconds {30.0f};
+};
+
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Core/AccelByteDataStorageBinaryFile.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief DataStorageBinaryFile that keeps the files in memory and reads and writes them on a dedicated I/O thread.
+ * The first access to a file queues its load on the I/O thread, the operations on the file wait in memory until it's
+ * loaded and their handlers are then called on the game thread. Once loaded, reads never touch the disk and handlers
+ * are called right away. Writes update the in-memory mirror, the file is marked dirty and written later by the I/O
+ * thread, so a burst of writes to the same file ends up as a single file write. A write reported as successful is
+ * therefore not on disk yet, call Flush to wait until every pending write is.
+ *
+ * Disabled by default, it's enabled with [AccelByte.DataStorage] bEnableAsyncIO=true in DefaultEngine.ini.
+ * The delay used to coalesce the writes is [AccelByte.DataStorage] WriteCoalesceDelayMs (default 50).
+ */
+class ACCELBYTEUE4SDK_API DataStorageAsyncBinaryFile : public DataStorageBinaryFile, public FRunnable
+{
+public:
+#if PLATFORM_WINDOWS
+	DataStorageAsyncBinaryFile(FString DirectoryPath = FPaths::ProjectContentDir());
+#else
+	DataStorageAsyncBinaryFile(FString DirectoryPath = TEXT(""));
+#endif
+	virtual ~DataStorageAsyncBinaryFile() override;
+
+	void Reset(const THandler<bool>& Result, const FString& FileName = TEXT("DefaultFileName")) override;
+
+	void DeleteItem(const FString& Key, const FVoidHandler OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void SaveItemOverwiteEntireFile(const FString& Key, const FString& Item, const THandler<bool>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void SaveItem(const FString& Key, const TArray<uint8>& Item, const THandler<bool>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void SaveItem(const FString& Key, const FString& Item, const THandler<bool>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void SaveItem(const FString& Key, const FJsonObjectWrapper& Item, const THandler<bool>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void GetItem(const FString& Key, const THandler<TPair<FString, TArray<uint8>>>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void GetItem(const FString& Key, const THandler<TPair<FString, FString>>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	void GetItem(const FString& Key, const THandler<TPair<FString, FJsonObjectWrapper>>& OnDone, const FString& Filename = TEXT("DefaultFileName")) override;
+
+	/**
+	 * @brief Block until every write accepted so far is written to disk.
+	 *
+	 * @return false if one of the files failed to be written, it will be retried on the next flush.
+	 */
+	bool Flush() override;
+
+	/**
+	 * @brief Queue the load of a file on the I/O thread ahead of its first access, e.g. the cache files of the SDK at
+	 * startup, so its operations don't wait for it.
+	 */
+	void Preload(const FString& FileName);
+
+	/**
+	 * @brief Number of files waiting to be written by the I/O thread.
+	 */
+	int32 GetQueueDepth() const;
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable Interface
+
+protected:
+	bool IsFileExist(const FString& FileName) override;
+
+private:
+	/** Calls the handler of an operation, outside of the lock. */
+	using FCompletion = TFunction<void()>;
+
+	struct FFileMirror;
+
+	/** Runs under the lock once the file is loaded. */
+	using FMirrorOperation = TFunction<FCompletion(FFileMirror&)>;
+
+	struct FFileMirror
+	{
+		/** Invalid until the file is loaded by the I/O thread. */
+		TSharedPtr<FABBinaryFileStructure> Structure;
+
+		/** Operations received before the file was loaded, in order. */
+		TArray<FMirrorOperation> PendingOperations;
+		bool bIsLoadQueued {false};
+		double DirtySince {0.0};
+		bool bDirty {false};
+		bool bWritten {false};
+	};
+
+	/**
+	 * @brief Run the operation now when the file is loaded, otherwise queue it until the I/O thread loads the file.
+	 */
+	void Execute(const FString& FileName, FMirrorOperation&& Operation);
+
+	static FBinaryContentIndependentSegment const* FindSegment(FFileMirror const& Mirror, const FString& Key);
+
+	/**
+	 * @brief Load the files requested since the last call and run their pending operations.
+	 *
+	 * @return The completions of the operations.
+	 */
+	TArray<FCompletion> LoadPendingFiles();
+
+	/**
+	 * @brief Load the requested files on the I/O thread, the handlers are called on the game thread.
+	 */
+	void LoadPendingFilesOnIOThread();
+
+	void MarkDirty(FFileMirror& Mirror);
+	bool IsFlushRequested() const;
+	bool WritePendingFiles();
+
+	mutable FCriticalSection MirrorLock;
+	TMap<FString, FFileMirror> Mirrors;
+	TArray<FString> FilesToLoad;
+	int32 QueueDepth {0};
+	int64 RequestedFlushCount {0};
+	int64 CompletedFlushCount {0};
+	bool bLastFlushSucceeded {true};
+
+	double WriteCoalesceDelaySeconds {0.05};
+	FRunnableThread* Thread {nullptr};
+	FEvent* WorkEvent {nullptr};
+	FEvent* FlushedEvent {nullptr};
+	FThreadSafeBool bStopRequested {false};
+};
+
+}
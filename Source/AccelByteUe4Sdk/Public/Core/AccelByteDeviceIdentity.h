@@ -0,0 +1,81 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief In-memory cache of the identifiers sent along with the login and telemetry requests.
+ * Getting the DeviceID may read and parse the general purpose cache file, query the MAC address, read the development
+ * overrides from the ini and the command line, then encode the result with HMAC. Every identifier is computed once and
+ * kept until one of the Invalidate functions is called, the encoded DeviceID is also recomputed when the publisher
+ * namespace used as HMAC key changes. Every identifier but the flight id is invalidated when the user credentials are
+ * forgotten on logout, the DeviceID also by FAccelByteUtilities::ResetDeviceId.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteDeviceIdentity
+{
+public:
+	/**
+	 * @brief Compute every identifier on the game thread after the current frame, so the first login doesn't pay for it.
+	 */
+	void Prefetch();
+
+	/**
+	 * @brief Get the DeviceID, see FAccelByteUtilities::GetDeviceId.
+	 *
+	 * @param bEncoded Whether the HMAC encoded DeviceID is needed, only a client in development mode can get the plain one.
+	 */
+	FString GetDeviceId(bool bEncoded = true);
+
+	FString GetAuthTrustId();
+
+	/**
+	 * @brief Update the cached AuthTrustId and store it with FPlatformMisc::SetStoredValue.
+	 */
+	void SetAuthTrustId(FString const& AuthTrustId);
+
+	FString GetPlatformName();
+
+	FString GetFlightId();
+
+	/**
+	 * @brief Forget the DeviceID, e.g. after the stored DeviceID or the development overrides are changed, see
+	 * FAccelByteUtilities::ResetDeviceId.
+	 */
+	void InvalidateDeviceId();
+
+	/**
+	 * @brief Forget the AuthTrustId, it is read again from the platform storage on the next call.
+	 */
+	void InvalidateAuthTrustId();
+
+	/**
+	 * @brief Forget every identifier except the flight id, which stays the same for the whole process.
+	 */
+	void Invalidate();
+
+private:
+	FCriticalSection DeviceIdLock;
+	bool bDeviceIdCached {false};
+	bool bIsClientDevMode {false};
+	FString PlainDeviceId;
+	FString EncodedDeviceId;
+	FString EncodedDeviceIdKey;
+
+	FCriticalSection AuthTrustIdLock;
+	bool bAuthTrustIdCached {false};
+	FString AuthTrustId;
+
+	// Process wide identifiers, kept apart so they never wait for the DeviceID storage access
+	FCriticalSection ProcessLock;
+	FString PlatformName;
+	FString FlightId;
+};
+
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteMessagingSystem.h"
+#include "Core/AccelByteTask.h"
+#include "Models/AccelByteLobbyModels.h"
+#include "Models/AccelByteUserModels.h"
+#include "Models/AccelByteUserProfileModels.h"
+
+namespace AccelByte
+{
+namespace Api
+{
+	class Lobby;
+	class User;
+	class UserProfile;
+}
+
+/**
+ * @brief Client side cache of user presences, public profiles and basic user info, owned by FApiClient.
+ * Presences are kept up to date by the lobby presence notifications, so a friends list only has to fetch the users it
+ * has never seen or whose entry went stale. Every lookup sends at most one bulk request per entity type for the ids
+ * that are missing or older than the TTL, cached entries are returned without any request.
+ *
+ * TTLs are read from [AccelByte.EntityCache] in DefaultEngine.ini: PresenceTtlSeconds (default 60),
+ * PublicProfileTtlSeconds (default 600) and UserInfoTtlSeconds (default 600).
+ */
+class ACCELBYTEUE4SDK_API FAccelByteEntityCache
+{
+public:
+	FAccelByteEntityCache(Api::Lobby& InLobby
+		, Api::User& InUser
+		, Api::UserProfile& InUserProfile
+		, FAccelByteMessagingSystem& InMessagingSystem);
+	~FAccelByteEntityCache();
+
+	/**
+	 * @brief Get the presence of the users, only the missing or stale ones are requested.
+	 *
+	 * @param UserIds Users to get.
+	 * @param OnSuccess Called with the presences in the order of UserIds, users unknown to the backend are omitted.
+	 * @param OnError Called when the presences can't be requested.
+	 * @param bForceRefresh Request every user even if it's cached.
+	 *
+	 * @return AccelByteTask object of the bulk request, invalid when every user is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetUserPresences(TArray<FString> const& UserIds
+		, THandler<TArray<FAccelByteModelsUserStatusNotif>> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the public profile of the users, only the missing or stale ones are requested.
+	 *
+	 * @param UserIds Users to get.
+	 * @param OnSuccess Called with the profiles in the order of UserIds, users without profile are omitted.
+	 * @param OnError Called when the profiles can't be requested.
+	 * @param bForceRefresh Request every user even if it's cached.
+	 *
+	 * @return AccelByteTask object of the bulk request, invalid when every user is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetPublicUserProfiles(TArray<FString> const& UserIds
+		, THandler<TArray<FAccelByteModelsPublicUserProfileInfo>> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the basic info (display name, avatar) of the users, only the missing or stale ones are requested.
+	 *
+	 * @param UserIds Users to get.
+	 * @param OnSuccess Called with the user info in the order of UserIds, users unknown to the backend are omitted.
+	 * @param OnError Called when the user info can't be requested.
+	 * @param bForceRefresh Request every user even if it's cached.
+	 *
+	 * @return AccelByteTask object of the bulk request, invalid when every user is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetUsersInfo(TArray<FString> const& UserIds
+		, THandler<TArray<FBaseUserInfo>> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the cached presence of a user without any request, stale entries are still returned.
+	 *
+	 * @return false if the user is not cached.
+	 */
+	bool TryGetCachedUserPresence(FString const& UserId, FAccelByteModelsUserStatusNotif& OutPresence) const;
+
+	/**
+	 * @brief Remove every cached entry of a user.
+	 */
+	void Invalidate(FString const& UserId);
+
+	/**
+	 * @brief Remove every cached entry, e.g. on logout.
+	 */
+	void Clear();
+
+private:
+	template<typename TEntity>
+	struct TEntityStore
+	{
+		struct FEntry
+		{
+			TEntity Entity;
+			double ExpiresAt {0.0};
+		};
+
+		TMap<FString, FEntry> Entries;
+		double TtlSeconds {0.0};
+	};
+
+	/** Shared with the request callbacks, which can outlive the cache. */
+	struct FState
+	{
+		mutable FCriticalSection Lock;
+		TEntityStore<FAccelByteModelsUserStatusNotif> Presences;
+		TEntityStore<FAccelByteModelsPublicUserProfileInfo> PublicProfiles;
+		TEntityStore<FBaseUserInfo> UsersInfo;
+	};
+
+	void OnUserPresenceUpdated(FString const& Payload);
+	void OnFriendRemoved(FString const& Payload);
+
+	template<typename TEntity>
+	static TArray<FString> CollectMissing(TEntityStore<TEntity> const& Store, TArray<FString> const& UserIds, bool bForceRefresh, double Now);
+
+	template<typename TEntity>
+	static TArray<TEntity> CollectCached(TEntityStore<TEntity> const& Store, TArray<FString> const& UserIds);
+
+	template<typename TEntity>
+	static void StoreEntity(TEntityStore<TEntity>& Store, FString const& UserId, TEntity const& Entity, double Now);
+
+	Api::Lobby& Lobby;
+	Api::User& User;
+	Api::UserProfile& UserProfile;
+	FAccelByteMessagingSystemWPtr MessagingSystemWPtr;
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+
+	FDelegateHandle UserPresenceUpdatedDelegateHandle;
+	FDelegateHandle FriendRemovedDelegateHandle;
+};
+
+}
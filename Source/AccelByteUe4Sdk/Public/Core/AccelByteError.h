@@ -384,6 +384,8 @@ namespace AccelByte
 		NetworkError = 14005,
 		IsNotLoggedIn = 14006,
 		LoginQueueCanceled = 14007,
+		ServiceCircuitOpen = 14008,
+		RequestCancelled = 14009,
 		WebSocketConnectFailed = 14201,
 		CachedTokenNotFound = 14301,
 		UnableToSerializeCachedToken = 14302,
@@ -551,6 +553,12 @@ namespace AccelByte
 					return;
 				}
 
+				if (FAccelByteHttpCircuitBreaker::IsRejected(Request))
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::ServiceCircuitOpen), "Request not sent, circuit open.");
+					return;
+				}
+
 				if (!bFinished)
 				{
 					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), "Request not sent.");
@@ -592,6 +600,12 @@ namespace AccelByte
 					return;
 				}
 
+				if (FAccelByteHttpCircuitBreaker::IsRejected(Request))
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::ServiceCircuitOpen), "Request not sent, circuit open.", FJsonObject{});
+					return;
+				}
+
 				if (!bFinished)
 				{
 					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), "Request not sent.", FJsonObject{});
@@ -635,6 +649,12 @@ namespace AccelByte
 					return;
 				}
 
+				if (FAccelByteHttpCircuitBreaker::IsRejected(Request))
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::ServiceCircuitOpen), TEXT("Request not sent, circuit open."), ErrorOauthInfo);
+					return;
+				}
+
 				if (!bFinished)
 				{
 	                OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), TEXT("Request not sent."), ErrorOauthInfo);
@@ -678,6 +698,12 @@ namespace AccelByte
 				return;
 			}
 
+			if (FAccelByteHttpCircuitBreaker::IsRejected(Request))
+			{
+				OnError.ExecuteIfBound({ TEXT("ServiceCircuitOpen"), TEXT("Request not sent, circuit open.") });
+				return;
+			}
+
 			if (!bFinished)
 			{
 				OnError.ExecuteIfBound({ TEXT("NetworkError"), TEXT("Request not sent.") });
@@ -718,6 +744,12 @@ namespace AccelByte
 					return;
 				}
 
+				if (FAccelByteHttpCircuitBreaker::IsRejected(Request))
+				{
+					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::ServiceCircuitOpen), TEXT("Request not sent, circuit open."), ErrorCreateMatchmakingV2Info);
+					return;
+				}
+
 				if (!bFinished)
 				{
 					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), TEXT("Request not sent."), ErrorCreateMatchmakingV2Info);
@@ -0,0 +1,398 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/IntegerSequence.h"
+#include "Templates/Tuple.h"
+
+#include "Core/AccelByteError.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Outcome of an API call, either its value or its error.
+ */
+template<typename T>
+struct TAccelByteResult
+{
+	T Value {};
+	int32 ErrorCode {0};
+	FString ErrorMessage;
+	bool bIsSuccess {false};
+
+	bool IsSuccess() const { return bIsSuccess; }
+
+	static TAccelByteResult Success(T InValue)
+	{
+		TAccelByteResult Result;
+		Result.Value = MoveTemp(InValue);
+		Result.bIsSuccess = true;
+		return Result;
+	}
+
+	static TAccelByteResult Failure(int32 InErrorCode, FString const& InErrorMessage)
+	{
+		TAccelByteResult Result;
+		Result.ErrorCode = InErrorCode;
+		Result.ErrorMessage = InErrorMessage;
+		return Result;
+	}
+};
+
+/**
+ * @brief Outcome of an API call without a value, i.e. taking an FVoidHandler.
+ */
+template<>
+struct TAccelByteResult<void>
+{
+	int32 ErrorCode {0};
+	FString ErrorMessage;
+	bool bIsSuccess {false};
+
+	bool IsSuccess() const { return bIsSuccess; }
+
+	static TAccelByteResult Success()
+	{
+		TAccelByteResult Result;
+		Result.bIsSuccess = true;
+		return Result;
+	}
+
+	static TAccelByteResult Failure(int32 InErrorCode, FString const& InErrorMessage)
+	{
+		TAccelByteResult Result;
+		Result.ErrorCode = InErrorCode;
+		Result.ErrorMessage = InErrorMessage;
+		return Result;
+	}
+};
+
+/**
+ * @brief Thread a continuation runs on.
+ */
+enum class EAccelByteFutureThread : uint8
+{
+	/** Thread that completed the previous future, the game thread for the HTTP calls. */
+	Inline,
+
+	GameThread,
+
+	/** Any task graph background thread, e.g. to process a large result without a hitch. */
+	Background
+};
+
+/**
+ * @brief Promise of a TAccelByteResult fulfilled by a handler pair.
+ * Only the first result counts, and the promise fails with ErrorCodes::RequestCancelled when the handlers are destroyed
+ * without being called, e.g. the request was cancelled through its token, so a future never stays pending forever.
+ */
+template<typename TResult>
+class TAccelByteResultPromise
+{
+public:
+	~TAccelByteResultPromise()
+	{
+		SetValue(TResult::Failure(static_cast<int32>(ErrorCodes::RequestCancelled), TEXT("Request cancelled before it produced a result.")));
+	}
+
+	TFuture<TResult> GetFuture() { return Promise.GetFuture(); }
+
+	void SetValue(TResult&& Result)
+	{
+		if (!bIsSet.AtomicSet(true))
+		{
+			Promise.SetValue(MoveTemp(Result));
+		}
+	}
+
+private:
+	TPromise<TResult> Promise;
+	FThreadSafeBool bIsSet {false};
+};
+
+/**
+ * @brief How the result of a continuation fulfills the future returned by FAccelByteFutures::Then.
+ * A continuation returning a value fulfills it with that value, one returning a future fulfills it once that future is
+ * fulfilled, so asynchronous steps can be chained.
+ */
+template<typename TReturn>
+struct TAccelByteFutureContinuation
+{
+	using FResult = TReturn;
+
+	template<typename TBody>
+	static void Run(TSharedRef<TPromise<FResult>, ESPMode::ThreadSafe> const& Promise, TBody& Body)
+	{
+		Promise->SetValue(Body());
+	}
+};
+
+template<>
+struct TAccelByteFutureContinuation<void>
+{
+	using FResult = void;
+
+	template<typename TBody>
+	static void Run(TSharedRef<TPromise<FResult>, ESPMode::ThreadSafe> const& Promise, TBody& Body)
+	{
+		Body();
+		Promise->SetValue();
+	}
+};
+
+template<typename TInner>
+struct TAccelByteFutureContinuation<TFuture<TInner>>
+{
+	using FResult = TInner;
+
+	template<typename TBody>
+	static void Run(TSharedRef<TPromise<FResult>, ESPMode::ThreadSafe> const& Promise, TBody& Body)
+	{
+		TFuture<TInner> Inner = Body();
+		Inner.Then([Promise](TFuture<TInner> Completed)
+			{
+				Promise->SetValue(Completed.Get());
+			});
+	}
+};
+
+/**
+ * @brief Future based calls on top of the THandler / FErrorHandler APIs, to run calls in parallel and join them.
+ *
+ * Any API call taking a handler pair becomes a future with FromHandlers, e.g. fetching the profile and the
+ * entitlements of a player in parallel once logged in:
+ *
+ *	auto Profile = FAccelByteFutures::FromHandlers<FAccelByteModelsUserProfileInfo>([&](auto const& OnSuccess, auto const& OnError)
+ *		{ ApiClient->UserProfile.GetUserProfile(OnSuccess, OnError); });
+ *	auto Entitlements = FAccelByteFutures::FromHandlers<FAccelByteModelsEntitlementPagingSlicedResult>(...);
+ *	FAccelByteFutures::Then(FAccelByteFutures::WhenAll(MoveTemp(Profile), MoveTemp(Entitlements))
+ *		, [](auto const& Results) { ... Results.template Get<0>() ... }
+ *		, EAccelByteFutureThread::GameThread);
+ *
+ * Futures never fail on their own, errors are carried in TAccelByteResult so a join always completes.
+ */
+class FAccelByteFutures
+{
+public:
+	/**
+	 * @brief Call an API taking an OnSuccess THandler<T> and an FErrorHandler and get its result as a future.
+	 *
+	 * @param Call Called right away with the handler pair to pass to the API.
+	 */
+	template<typename T, typename TCall>
+	static TFuture<TAccelByteResult<T>> FromHandlers(TCall&& Call)
+	{
+		using FResult = TAccelByteResult<T>;
+		TSharedRef<TAccelByteResultPromise<FResult>, ESPMode::ThreadSafe> Promise = MakeShared<TAccelByteResultPromise<FResult>, ESPMode::ThreadSafe>();
+		TFuture<FResult> Future = Promise->GetFuture();
+		Call(THandler<T>::CreateLambda([Promise](T const& Value)
+				{
+					Promise->SetValue(FResult::Success(Value));
+				})
+			, FErrorHandler::CreateLambda([Promise](int32 ErrorCode, FString const& ErrorMessage)
+				{
+					Promise->SetValue(FResult::Failure(ErrorCode, ErrorMessage));
+				}));
+		return Future;
+	}
+
+	/**
+	 * @brief Call an API taking an FVoidHandler and an FErrorHandler and get its outcome as a future.
+	 */
+	template<typename TCall>
+	static TFuture<TAccelByteResult<void>> FromVoidHandlers(TCall&& Call)
+	{
+		using FResult = TAccelByteResult<void>;
+		TSharedRef<TAccelByteResultPromise<FResult>, ESPMode::ThreadSafe> Promise = MakeShared<TAccelByteResultPromise<FResult>, ESPMode::ThreadSafe>();
+		TFuture<FResult> Future = Promise->GetFuture();
+		Call(FVoidHandler::CreateLambda([Promise]()
+				{
+					Promise->SetValue(FResult::Success());
+				})
+			, FErrorHandler::CreateLambda([Promise](int32 ErrorCode, FString const& ErrorMessage)
+				{
+					Promise->SetValue(FResult::Failure(ErrorCode, ErrorMessage));
+				}));
+		return Future;
+	}
+
+	/**
+	 * @brief Run a continuation on the value of a future, on the given thread.
+	 *
+	 * @param Continuation Takes the value, returns a value, nothing, or a future to chain another asynchronous step.
+	 *
+	 * @return Future of the value returned by the continuation.
+	 */
+	template<typename T, typename TFunc>
+	static auto Then(TFuture<T>&& Future
+		, TFunc&& Continuation
+		, EAccelByteFutureThread Thread = EAccelByteFutureThread::GameThread)
+		-> TFuture<typename TAccelByteFutureContinuation<typename TDecay<decltype(Continuation(DeclVal<T const&>()))>::Type>::FResult>
+	{
+		using FContinuation = TAccelByteFutureContinuation<typename TDecay<decltype(Continuation(DeclVal<T const&>()))>::Type>;
+		using FResult = typename FContinuation::FResult;
+
+		TSharedRef<TPromise<FResult>, ESPMode::ThreadSafe> Promise = MakeShared<TPromise<FResult>, ESPMode::ThreadSafe>();
+		TFuture<FResult> Result = Promise->GetFuture();
+		Future.Then([Promise, Continuation = Forward<TFunc>(Continuation), Thread](TFuture<T> Completed) mutable
+			{
+				RunOn(Thread, [Promise, Continuation = MoveTemp(Continuation), Completed = MoveTemp(Completed)]() mutable
+					{
+						auto Body = [&Continuation, &Completed]() { return Continuation(Completed.Get()); };
+						FContinuation::Run(Promise, Body);
+					});
+			});
+		return Result;
+	}
+
+	/**
+	 * @brief Join futures of different types, fulfilled with every value once they are all fulfilled.
+	 */
+	template<typename... Ts>
+	static TFuture<TTuple<Ts...>> WhenAll(TFuture<Ts>&&... Futures)
+	{
+		static_assert(sizeof...(Ts) > 0, "WhenAll needs at least one future");
+
+		TSharedRef<TWhenAllState<Ts...>, ESPMode::ThreadSafe> State = MakeShared<TWhenAllState<Ts...>, ESPMode::ThreadSafe>();
+		TFuture<TTuple<Ts...>> Result = State->Promise.GetFuture();
+		AttachAll(State, TMakeIntegerSequence<uint32, sizeof...(Ts)>(), MoveTemp(Futures)...);
+		return Result;
+	}
+
+	/**
+	 * @brief Join futures of the same type, fulfilled with every value in order once they are all fulfilled.
+	 */
+	template<typename T>
+	static TFuture<TArray<T>> WhenAll(TArray<TFuture<T>>&& Futures)
+	{
+		struct FState
+		{
+			TPromise<TArray<T>> Promise;
+			TArray<T> Results;
+			FThreadSafeCounter Remaining;
+		};
+
+		TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+		TFuture<TArray<T>> Result = State->Promise.GetFuture();
+		if (Futures.Num() == 0)
+		{
+			State->Promise.SetValue(TArray<T>());
+			return Result;
+		}
+
+		State->Results.SetNum(Futures.Num());
+		State->Remaining.Set(Futures.Num());
+		for (int32 Index = 0; Index < Futures.Num(); Index++)
+		{
+			Futures[Index].Then([State, Index](TFuture<T> Completed)
+				{
+					State->Results[Index] = Completed.Get();
+					if (State->Remaining.Decrement() == 0)
+					{
+						State->Promise.SetValue(MoveTemp(State->Results));
+					}
+				});
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief Race futures of the same type, fulfilled with the index and the value of the first one fulfilled.
+	 * Fulfilled with INDEX_NONE and a default value when there is no future.
+	 */
+	template<typename T>
+	static TFuture<TPair<int32, T>> WhenAny(TArray<TFuture<T>>&& Futures)
+	{
+		struct FState
+		{
+			TPromise<TPair<int32, T>> Promise;
+			FThreadSafeBool bIsSet {false};
+		};
+
+		TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+		TFuture<TPair<int32, T>> Result = State->Promise.GetFuture();
+		if (Futures.Num() == 0)
+		{
+			State->Promise.SetValue(TPair<int32, T>(INDEX_NONE, T()));
+			return Result;
+		}
+
+		for (int32 Index = 0; Index < Futures.Num(); Index++)
+		{
+			Futures[Index].Then([State, Index](TFuture<T> Completed)
+				{
+					if (!State->bIsSet.AtomicSet(true))
+					{
+						State->Promise.SetValue(TPair<int32, T>(Index, Completed.Get()));
+					}
+				});
+		}
+		return Result;
+	}
+
+	/**
+	 * @brief Run a function on the given thread, right away when already on it.
+	 */
+	static void RunOn(EAccelByteFutureThread Thread, TUniqueFunction<void()>&& Function)
+	{
+		switch (Thread)
+		{
+		case EAccelByteFutureThread::GameThread:
+			if (IsInGameThread())
+			{
+				Function();
+			}
+			else
+			{
+				AsyncTask(ENamedThreads::GameThread, MoveTemp(Function));
+			}
+			break;
+		case EAccelByteFutureThread::Background:
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, MoveTemp(Function));
+			break;
+		case EAccelByteFutureThread::Inline:
+		default:
+			Function();
+			break;
+		}
+	}
+
+private:
+	template<typename... Ts>
+	struct TWhenAllState
+	{
+		TPromise<TTuple<Ts...>> Promise;
+		TTuple<Ts...> Results;
+		FThreadSafeCounter Remaining {static_cast<int32>(sizeof...(Ts))};
+	};
+
+	template<typename TState, uint32... Indices, typename... Ts>
+	static void AttachAll(TSharedRef<TState, ESPMode::ThreadSafe> const& State, TIntegerSequence<uint32, Indices...>, TFuture<Ts>&&... Futures)
+	{
+		int32 Expand[] = { 0, (AttachOne<Indices>(State, MoveTemp(Futures)), 0)... };
+		(void)Expand;
+	}
+
+	template<uint32 Index, typename TState, typename T>
+	static void AttachOne(TSharedRef<TState, ESPMode::ThreadSafe> const& State, TFuture<T>&& Future)
+	{
+		Future.Then([State](TFuture<T> Completed)
+			{
+				State->Results.template Get<Index>() = Completed.Get();
+				if (State->Remaining.Decrement() == 0)
+				{
+					State->Promise.SetValue(MoveTemp(State->Results));
+				}
+			});
+	}
+};
+
+}
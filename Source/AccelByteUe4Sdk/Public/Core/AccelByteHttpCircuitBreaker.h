@@ -0,0 +1,142 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+
+namespace AccelByte
+{
+
+/** Set on the requests failed fast by an open circuit, they are never sent. */
+const constexpr TCHAR* GHeaderABCircuitOpen = TEXT("X-AB-CircuitOpen");
+
+enum class EAccelByteCircuitState : uint8
+{
+	/** Requests are sent. */
+	Closed,
+
+	/** The service failed too many times in a row, requests fail fast. */
+	Open,
+
+	/** The open delay elapsed, a single probe request is sent to find out whether the service recovered. */
+	HalfOpen
+};
+
+/**
+ * @brief Circuit and retry budget of a service.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteCircuitStatus
+{
+	FString Service;
+	EAccelByteCircuitState State {EAccelByteCircuitState::Closed};
+	int32 ConsecutiveFailures {0};
+
+	/** Retries left in the budget of the service. */
+	double RetryTokens {0.0};
+
+	/** Requests failed fast while the circuit was open. */
+	int64 RejectedCount {0};
+
+	/** Retries not done because the budget was exhausted or the circuit opened. */
+	int64 DeniedRetryCount {0};
+};
+
+/**
+ * @brief Circuit breakers and retry budgets of the HTTP requests, one per service.
+ * A service is the host and the first path segment of the URL, e.g. "demo.accelbyte.io/iam".
+ *
+ * Both are opt-in, the defaults keep the retry behavior of the scheduler unchanged.
+ *
+ * With [AccelByte.Http] bEnableCircuitBreaker, the circuit of a service opens after CircuitBreakerFailureThreshold
+ * (default 5) failed attempts in a row. Only responses of the service count as failures, a 5xx or a 429, a timeout or
+ * a connection error says more about the network of the player than about the service and is ignored. While open,
+ * requests to the service fail fast with ErrorCodes::ServiceCircuitOpen. After CircuitBreakerOpenSeconds (default 30)
+ * the circuit is half-open and lets one probe through, closing on success and opening again on failure.
+ *
+ * With bEnableRetryBudget, retries are paid with tokens of a bucket of RetryBudgetMaxTokens (default 10), every
+ * successful attempt earns RetryBudgetPercent (default 20) percent of a token, so retries are capped to a share of the
+ * recent successful traffic.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteHttpCircuitBreaker
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnCircuitStateChanged, FString const& /*Service*/, EAccelByteCircuitState /*State*/);
+
+	void LoadConfig();
+
+	bool IsEnabled() const { return bIsEnabled; }
+	bool IsRetryBudgetEnabled() const { return bIsRetryBudgetEnabled; }
+
+	static FString GetServiceKey(FString const& Url);
+
+	/**
+	 * @brief Whether the request was failed fast by an open circuit.
+	 */
+	static bool IsRejected(FHttpRequestPtr const& Request)
+	{
+		return Request.IsValid() && !Request->GetHeader(GHeaderABCircuitOpen).IsEmpty();
+	}
+
+	/**
+	 * @brief Whether a request to the service can be sent, false when its circuit is open.
+	 */
+	bool TryAcquire(FString const& Service, double Now);
+
+	/**
+	 * @brief Take a retry token of the service, false when the budget is exhausted or the circuit is not closed.
+	 * Always true when neither the circuit breaker nor the retry budget is enabled.
+	 */
+	bool TryConsumeRetry(FString const& Service);
+
+	void RecordSuccess(FString const& Service);
+	void RecordFailure(FString const& Service, double Now);
+
+	/**
+	 * @brief Whether an attempt that got this status code counts as a failure of the service, a 5xx or a 429.
+	 */
+	static bool IsServiceFailure(int32 StatusCode);
+
+	EAccelByteCircuitState GetState(FString const& Service) const;
+	TArray<FAccelByteCircuitStatus> GetStatus() const;
+
+	/**
+	 * @brief Close every circuit and refill every budget.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Called outside of the lock when a circuit changes state, from the thread recording the attempt.
+	 */
+	FOnCircuitStateChanged& OnCircuitStateChanged() { return CircuitStateChanged; }
+
+private:
+	struct FCircuit
+	{
+		FAccelByteCircuitStatus Status;
+		double OpenUntil {0.0};
+		double LastProbeTime {0.0};
+		bool bIsProbing {false};
+	};
+
+	FCircuit& FindOrAddCircuit(FString const& Service);
+	void SetState(FCircuit& Circuit, EAccelByteCircuitState State, double Now);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FCircuit> Circuits;
+	FOnCircuitStateChanged CircuitStateChanged;
+
+	bool bIsEnabled {false};
+	bool bIsRetryBudgetEnabled {false};
+	int32 FailureThreshold {5};
+	double OpenSeconds {30.0};
+	double RetryTokensPerSuccess {0.2};
+	double MaxRetryTokens {10.0};
+};
+
+}
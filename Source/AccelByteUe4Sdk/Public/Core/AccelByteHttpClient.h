@@ -10,6 +10,7 @@
 #include "Core/AccelByteUtilities.h"
 #include "Core/AccelByteBaseCredentials.h"
 #include "Core/AccelByteBaseSettings.h"
+#include "Core/AccelBytePageIterator.h"
 #include "Logging/AccelByteServiceLogger.h"
 
 namespace AccelByte
@@ -716,6 +717,93 @@ namespace AccelByte
 			return Request(Verb, ApiUrl, QueryParams, Json, Headers, OnSuccess, OnError);
 		}
 
+		/**
+		 * @brief API request bound to a cancellation token, takes the arguments of any other ApiRequest overload after
+		 * the token. Nothing is sent when the token is already cancelled. Cancelling the token aborts the request, removes
+		 * it from the retry scheduler and neither OnSuccess nor OnError is called.
+		 *
+		 * @param CancellationToken Token cancelling the request, can be shared by every request of an operation.
+		 *
+		 * @return FAccelByteTaskPtr, nullptr when the token is already cancelled.
+		 */
+		template<typename... TArgs>
+		FAccelByteTaskPtr ApiRequest(FAccelByteRequestCancellationTokenRef const& CancellationToken
+			, TArgs&&... Args)
+		{
+			if (CancellationToken->IsCancelled())
+			{
+				return nullptr;
+			}
+
+			FAccelByteTaskPtr Task = ApiRequest(Forward<TArgs>(Args)...);
+			CancellationToken->Register(Task);
+			return Task;
+		}
+
+		/**
+		 * @brief Iterate a paged GET API by offset and limit, prefetching the next pages while the current one is consumed.
+		 *
+		 * @param Url HTTP request URL.
+		 * @param QueryParams HTTP request query string key-value, offset and limit are set for each page.
+		 * @param PageSize Number of items per page, must not exceed the maximum limit of the endpoint.
+		 * @param StartOffset Offset of the first item.
+		 * @param Options Item cap and number of pages requested ahead.
+		 *
+		 * @return The iterator, see TAccelBytePageIterator.
+		 */
+		template<typename TPage>
+		TSharedRef<TAccelBytePageIterator<TPage>, ESPMode::ThreadSafe> CreatePageIterator(FString const& Url
+			, TMultiMap<FString, FString> const& QueryParams
+			, int32 PageSize
+			, int32 StartOffset = 0
+			, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions())
+		{
+			return TAccelBytePageIterator<TPage>::CreateFromOffsets(
+				[this, Url, QueryParams](int32 Offset, int32 Limit, THandler<TPage> const& OnSuccess, FErrorHandler const& OnError) -> FAccelByteTaskWPtr
+				{
+					TMultiMap<FString, FString> PageQueryParams = QueryParams;
+					PageQueryParams.Remove(TEXT("offset"));
+					PageQueryParams.Remove(TEXT("limit"));
+					PageQueryParams.Add(TEXT("offset"), FString::FromInt(Offset));
+					PageQueryParams.Add(TEXT("limit"), FString::FromInt(Limit));
+					return ApiRequest(TEXT("GET"), Url, PageQueryParams, OnSuccess, OnError);
+				}
+				, PageSize
+				, StartOffset
+				, Options);
+		}
+
+		/**
+		 * @brief Iterate a paged GET API by following its Paging.Next links, the next page is requested as soon as the
+		 * current one arrives.
+		 *
+		 * @param Url HTTP request URL of the first page.
+		 * @param QueryParams HTTP request query string key-value of the first page.
+		 * @param CountItems Optional, number of items of a page, needed for Options.MaxItems.
+		 * @param Options Item cap.
+		 *
+		 * @return The iterator, see TAccelBytePageIterator.
+		 */
+		template<typename TPage>
+		TSharedRef<TAccelBytePageIterator<TPage>, ESPMode::ThreadSafe> CreatePageLinkIterator(FString const& Url
+			, TMultiMap<FString, FString> const& QueryParams
+			, typename TAccelBytePageIterator<TPage>::FCountItems CountItems = nullptr
+			, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions())
+		{
+			return TAccelBytePageIterator<TPage>::CreateFromLinks(
+				[this, Url, QueryParams](FString const& Next, THandler<TPage> const& OnSuccess, FErrorHandler const& OnError) -> FAccelByteTaskWPtr
+				{
+					if (Next.IsEmpty())
+					{
+						return ApiRequest(TEXT("GET"), Url, QueryParams, OnSuccess, OnError);
+					}
+					// The next link already carries the query of the page
+					return ApiRequest(TEXT("GET"), FAccelBytePageIteratorBase::ResolvePageUrl(Url, Next), OnSuccess, OnError);
+				}
+				, MoveTemp(CountItems)
+				, Options);
+		}
+
 	private:
 		FHttpRetryScheduler& HttpRef;
 		BaseCredentials const& CredentialsRef;
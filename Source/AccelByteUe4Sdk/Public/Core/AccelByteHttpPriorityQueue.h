@@ -0,0 +1,168 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteTask.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Priority class of an HTTP request.
+ */
+enum class EAccelByteHttpPriority : uint8
+{
+	/** Latency critical calls a player waits on, e.g. login, session join or matchmaking tickets. */
+	Interactive,
+
+	Normal,
+
+	/** Bulk work nobody waits on, e.g. telemetry, cloud save sync or UGC listings. Can be suspended. */
+	Background,
+
+	Count
+};
+
+/**
+ * @brief Dispatch state of a priority class.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteHttpPriorityStats
+{
+	EAccelByteHttpPriority Priority {EAccelByteHttpPriority::Normal};
+	int32 Weight {0};
+	int32 MaxConcurrent {0};
+	bool bIsSuspended {false};
+
+	/** Requests waiting for a slot. */
+	int32 QueuedCount {0};
+
+	/** Requests started and not finished yet, retries included. */
+	int32 InFlightCount {0};
+
+	int64 DispatchedCount {0};
+
+	/** Requests that had to wait for a slot. */
+	int64 DelayedCount {0};
+	double MaxQueueSeconds {0.0};
+};
+
+/**
+ * @brief Admission of the HTTP requests into the platform HTTP module by priority class.
+ *
+ * Disabled by default, enabled with [AccelByte.Http] bEnablePriorityQueue, which caps the requests in flight of the
+ * SDK to MaxConcurrentRequests (default 16). Each class has its own cap, InteractiveMaxConcurrent (default 16),
+ * NormalMaxConcurrent (default 12) and BackgroundMaxConcurrent (default 4), so bulk work can never take every slot.
+ * The last InteractiveReservedSlots (default 4) slots of the global cap are only taken by Interactive requests, so
+ * Normal and Background saturating their caps never starve a login or a session join. When slots are contended the
+ * waiting requests are dequeued by smooth weighted round robin, InteractiveWeight (default 6), NormalWeight
+ * (default 3) and BackgroundWeight (default 1), so lower classes still make progress.
+ *
+ * The class of a request is looked up from the first segment of its URL path, the service name. Services are listed
+ * in InteractiveServices and BackgroundServices, comma separated, every other service is Normal.
+ *
+ * A slot is freed as soon as the response of its request is received, and the next queued request starts right away.
+ * Retries and requests resumed after a bearer refresh take a slot again, waiting in their class when none is free.
+ *
+ * A suspended class, e.g. Background during a loading screen or a match, keeps its requests queued until resumed.
+ * Its requests already in flight run to completion, aborting them could apply a write twice once sent again.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteHttpPriorityQueue
+{
+public:
+	/**
+	 * @brief A request allowed to start, with the time it waited for a slot.
+	 */
+	struct FDispatch
+	{
+		FAccelByteTaskPtr Task;
+		double QueuedSeconds {0.0};
+	};
+
+	FAccelByteHttpPriorityQueue();
+
+	void LoadConfig();
+
+	bool IsEnabled() const { return bIsEnabled; }
+
+	/**
+	 * @brief Priority class of a request, from the service of its URL.
+	 */
+	EAccelByteHttpPriority GetPriority(FString const& Url) const;
+
+	/**
+	 * @brief Override the priority class of every request to a service, e.g. "cloudsave".
+	 */
+	void SetServicePriority(FString const& ServiceName, EAccelByteHttpPriority Priority);
+
+	/**
+	 * @brief Add a task that is about to be sent, or sent again. A task still holding its slot keeps it.
+	 *
+	 * @return True when a slot was taken and the task can start now, false when the task is queued.
+	 */
+	bool Submit(FAccelByteTaskPtr const& Task, EAccelByteHttpPriority Priority, double Now);
+
+	/**
+	 * @brief Take the slots freed since the last call, the returned tasks must be started.
+	 * Queued tasks that left the pending state, cancelled or paused, are dropped.
+	 */
+	void Dispatch(double Now, TArray<FDispatch>& OutDispatched);
+
+	/**
+	 * @brief Free the slot of a finished task, or remove it from the queue when it never started.
+	 */
+	void Release(FAccelByteTaskPtr const& Task);
+
+	/**
+	 * @brief Stop dispatching the requests of a class until resumed.
+	 */
+	void Suspend(EAccelByteHttpPriority Priority);
+	void Resume(EAccelByteHttpPriority Priority);
+	bool IsSuspended(EAccelByteHttpPriority Priority) const;
+
+	TArray<FAccelByteHttpPriorityStats> GetStats() const;
+
+	/**
+	 * @brief Drop every queued task and forget the slots in use.
+	 */
+	void Empty();
+
+	static FString GetServiceName(FString const& Url);
+	static FString GetPriorityName(EAccelByteHttpPriority Priority);
+
+private:
+	struct FEntry
+	{
+		FAccelByteTaskPtr Task;
+		double EnqueueTime {0.0};
+	};
+
+	struct FPriorityClass
+	{
+		TArray<FEntry> Pending;
+		int32 CurrentWeight {0};
+		FAccelByteHttpPriorityStats Stats;
+	};
+
+	bool CanStart(FPriorityClass const& Class) const;
+	void Acquire(FAccelByteTaskPtr const& Task, EAccelByteHttpPriority Priority);
+	FPriorityClass* PickNextClass();
+
+	mutable FCriticalSection Lock;
+	FPriorityClass Classes[static_cast<int32>(EAccelByteHttpPriority::Count)];
+	TMap<FAccelByteTask*, EAccelByteHttpPriority> InFlight;
+	TMap<FString, EAccelByteHttpPriority> ServicePriorities;
+
+	bool bIsEnabled {false};
+	int32 MaxConcurrent {16};
+
+	/** Slots of MaxConcurrent the lower classes can't take. */
+	int32 InteractiveReservedSlots {4};
+};
+
+}
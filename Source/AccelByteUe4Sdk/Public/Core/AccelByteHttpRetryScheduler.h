@@ -10,6 +10,8 @@
 #include "HttpManager.h"
 #include "Core/AccelByteTask.h"
 #include "Core/AccelByteHttpCache.h"
+#include "Core/AccelByteHttpCircuitBreaker.h"
+#include "Core/AccelByteHttpPriorityQueue.h"
 #include "Core/AccelByteDefines.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRetry, Log, All);
@@ -48,6 +50,11 @@ public:
 
 	FAccelByteTaskPtr ProcessRequest(FHttpRequestPtr Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime);
 
+	/**
+	 * @brief Process a request with an explicit priority class instead of the one of its service.
+	 */
+	FAccelByteTaskPtr ProcessRequest(FHttpRequestPtr Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EAccelByteHttpPriority Priority);
+
 	void SetBearerAuthRejectedDelegate(FBearerAuthRejected BearerAuthRejected);
 	void BearerAuthRejected();
 	void PauseBearerAuthRequest();
@@ -67,6 +74,10 @@ public:
 
 	Core::FAccelByteHttpCache& GetHttpCache() { return HttpCache; }
 
+	FAccelByteHttpCircuitBreaker& GetCircuitBreaker() { return CircuitBreaker; }
+
+	FAccelByteHttpPriorityQueue& GetPriorityQueue() { return PriorityQueue; }
+
 protected:
 	static TMap<EHttpResponseCodes::Type, FHttpResponseCodeHandler> ResponseCodeDelegates;
 	TMap<FString /*Endpoint*/, FRequestBucket> RequestsBucket;
@@ -77,6 +88,10 @@ protected:
 
 	Core::FAccelByteHttpCache HttpCache{};
 
+	FAccelByteHttpCircuitBreaker CircuitBreaker{};
+
+	FAccelByteHttpPriorityQueue PriorityQueue{};
+
 	FBearerAuthRejected BearerAuthRejectedDelegate{};
 	FBearerAuthRejectedRefresh BearerAuthRejectedRefresh{};
 
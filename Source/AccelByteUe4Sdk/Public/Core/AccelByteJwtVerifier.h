@@ -0,0 +1,132 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteUtilities.h"
+#include "Models/AccelByteOauth2Models.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteJwtVerifier, Log, All);
+
+namespace AccelByte
+{
+
+DECLARE_DELEGATE_TwoParams(FOnJwtVerified, EJwtResult /* Result */, TSharedPtr<FJsonObject> const& /* Payload */);
+
+/**
+ * @brief Function used by the verifier to fetch the JWKS, e.g. bound to ServerOauth2::GetJwks.
+ */
+using FJwksFetcher = TFunction<void(THandler<FJwkSet> const& /* OnSuccess */, FErrorHandler const& /* OnError */)>;
+
+/**
+ * @brief Local RS256 JWT verifier backed by a JWKS cache.
+ * Public keys are parsed once and kept by "kid", tokens carrying an unknown "kid" trigger a (rate limited) JWKS
+ * refresh before being verified. Signature checks run on a background worker and successfully verified tokens are
+ * remembered for a short TTL, so the same token presented again is accepted without touching OpenSSL.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteJwtVerifier
+	: public TSharedFromThis<FAccelByteJwtVerifier, ESPMode::ThreadSafe>
+{
+public:
+	/**
+	 * @param InJwksFetcher Function used to fetch the JWKS when a key is missing.
+	 * @param InVerifiedCacheTtlSeconds How long a verified token is remembered, capped by the token expiration.
+	 * @param InMinRefreshIntervalSeconds Minimum interval between two JWKS fetches triggered by unknown "kid".
+	 */
+	FAccelByteJwtVerifier(FJwksFetcher InJwksFetcher
+		, double InVerifiedCacheTtlSeconds = 30.0
+		, double InMinRefreshIntervalSeconds = 30.0);
+	~FAccelByteJwtVerifier();
+
+	/**
+	 * @brief Verify a token asynchronously. Signature verification runs on a background thread, the delegate is
+	 * executed on the game thread, after Verify returns even when the token was verified recently. The JWKS is fetched
+	 * first if the token "kid" is not cached yet.
+	 *
+	 * @param Token JWT encoded as dot separated Base64Url string.
+	 * @param OnComplete Executed with EJwtResult::Ok and the token payload when the token is valid and not expired.
+	 */
+	void Verify(FString const& Token, FOnJwtVerified const& OnComplete);
+
+	/**
+	 * @brief Verify a token on the calling thread using the cached keys only, no JWKS is fetched.
+	 *
+	 * @param Token JWT encoded as dot separated Base64Url string.
+	 * @param OutPayload Token payload when the token is valid.
+	 * @return EJwtResult::UnknownKeyId if the "kid" is not cached, see Verify.
+	 */
+	EJwtResult VerifySync(FString const& Token, TSharedPtr<FJsonObject>& OutPayload);
+
+	/**
+	 * @brief Replace the cached keys with the RSA keys of a JWKS, e.g. fetched with ServerOauth2::GetJwks.
+	 */
+	void SetJwks(FJwkSet const& JwkSet);
+
+	/**
+	 * @brief Fetch the JWKS now, pending verifications waiting for a key are resumed once it is done.
+	 */
+	void RefreshJwks();
+
+	/**
+	 * @brief Forget the cached keys and verified tokens, and stop fetching JWKS.
+	 */
+	void Shutdown();
+
+	int32 GetCachedKeyCount() const;
+
+private:
+	struct FPublicKey;
+
+	struct FVerifiedToken
+	{
+		TSharedPtr<FJsonObject> Payload;
+		double ExpiresAt;
+	};
+
+	struct FPendingVerification
+	{
+		FString Token;
+		FOnJwtVerified OnComplete;
+	};
+
+	EJwtResult VerifyWithKey(FString const& Token, FString& OutKeyId, TSharedPtr<FJsonObject>& OutPayload);
+	TSharedPtr<FPublicKey, ESPMode::ThreadSafe> FindKey(FString const& KeyId) const;
+	bool FindVerified(FSHAHash const& TokenHash, TSharedPtr<FJsonObject>& OutPayload);
+	void AddVerified(FSHAHash const& TokenHash, TSharedPtr<FJsonObject> const& Payload);
+	void VerifyOnWorker(FString const& Token, FOnJwtVerified const& OnComplete, bool bAllowRefresh);
+	void OnJwksRefreshed(bool bSuccess);
+
+	static FSHAHash HashToken(FString const& Token);
+
+	FJwksFetcher JwksFetcher;
+	const double VerifiedCacheTtlSeconds;
+	const double MinRefreshIntervalSeconds;
+
+	mutable FCriticalSection KeysLock;
+	TMap<FString, TSharedPtr<FPublicKey, ESPMode::ThreadSafe>> Keys;
+
+	FCriticalSection VerifiedLock;
+	TMap<FSHAHash, FVerifiedToken> VerifiedTokens;
+
+	FCriticalSection PendingLock;
+	TArray<FPendingVerification> PendingVerifications;
+	bool bRefreshInProgress {false};
+	double LastRefreshTime {0.0};
+
+	FAccelByteJwtVerifier(FAccelByteJwtVerifier const&) = delete;
+	FAccelByteJwtVerifier(FAccelByteJwtVerifier&&) = delete;
+	FAccelByteJwtVerifier& operator=(FAccelByteJwtVerifier const&) = delete;
+	FAccelByteJwtVerifier& operator=(FAccelByteJwtVerifier&&) = delete;
+};
+
+typedef TSharedRef<FAccelByteJwtVerifier, ESPMode::ThreadSafe> FAccelByteJwtVerifierRef;
+typedef TSharedPtr<FAccelByteJwtVerifier, ESPMode::ThreadSafe> FAccelByteJwtVerifierPtr;
+
+}
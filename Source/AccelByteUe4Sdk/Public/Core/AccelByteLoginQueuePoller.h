@@ -0,0 +1,161 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+#include "Models/AccelByteOauth2Models.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Result of a login queue ticket refresh, with the hints of the response headers.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteLoginQueueRefreshResult
+{
+	bool bSucceeded {false};
+	FAccelByteModelsLoginQueueTicketInfo TicketInfo;
+
+	/** Retry-After of the response in seconds, zero when absent. */
+	float RetryAfterSeconds {0.0f};
+
+	int32 ErrorCode {0};
+	FString ErrorMessage;
+};
+
+/**
+ * @brief Spacing of the login queue ticket polls, loaded from [AccelByte.LoginQueue].
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteLoginQueuePollPolicy
+{
+	/** Used when the ticket has no PlayerPollingTimeInSeconds. */
+	float DefaultIntervalSeconds {5.0f};
+
+	float MaxIntervalSeconds {60.0f};
+
+	/** From this position on, the ticket is polled at the server interval. */
+	int32 NearFrontPosition {100};
+
+	/** A poll that moved the ticket by less than this percentage of its position counts as barely moving. */
+	int32 MinProgressPercent {5};
+
+	/** Random delay added to each poll, in percent of the poll interval. */
+	int32 JitterPercent {20};
+
+	/** Consecutive failed polls before giving up. */
+	int32 MaxConsecutiveErrors {5};
+
+	static FAccelByteLoginQueuePollPolicy LoadFromConfig();
+};
+
+/**
+ * @brief Spacing state of one polled ticket.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteLoginQueuePollState
+{
+	int32 LastPosition {-1};
+	float LastServerIntervalSeconds {0.0f};
+	int32 StallCount {0};
+	int32 ErrorCount {0};
+};
+
+class FAccelByteLoginQueuePoller;
+typedef TSharedPtr<FAccelByteLoginQueuePoller, ESPMode::ThreadSafe> FAccelByteLoginQueuePollerPtr;
+
+/**
+ * @brief Polls a login queue ticket until it reaches the front of the queue.
+ * Clients polling at the fixed interval of the ticket all hit the queue at the same pace during login storms. The
+ * poller spaces its polls out exponentially while the ticket barely moves, polls at the server interval once the ticket
+ * is near the front, never sooner than the server interval or Retry-After, never later than half of the estimated
+ * waiting time, and adds a random jitter to every poll.
+ *
+ * The poller must not outlive the LoginQueue API that created it.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteLoginQueuePoller
+	: public TSharedFromThis<FAccelByteLoginQueuePoller, ESPMode::ThreadSafe>
+{
+public:
+	typedef TFunction<FAccelByteTaskWPtr(FString const& /*Ticket*/
+		, THandler<FAccelByteLoginQueueRefreshResult> const& /*OnDone*/)> FRefreshTicket;
+
+	FAccelByteLoginQueuePoller(FRefreshTicket InRefreshTicket, FAccelByteLoginQueuePollPolicy const& InPolicy);
+	~FAccelByteLoginQueuePoller();
+
+	/**
+	 * @brief Start polling, from the ticket returned by the login.
+	 *
+	 * @param TicketInfo Ticket to poll.
+	 * @param OnTicketUpdated This will be called on every successful poll.
+	 * @param OnReady This will be called once the ticket position reached zero, the ticket can then be claimed.
+	 * @param OnError This will be called when the ticket was rejected or polling failed too many times in a row.
+	 */
+	void Start(FAccelByteModelsLoginQueueTicketInfo const& TicketInfo
+		, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnTicketUpdated
+		, THandler<FAccelByteModelsLoginQueueTicketInfo> const& OnReady
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Stop polling, the poll in progress is cancelled and no delegate is called afterwards.
+	 */
+	void Cancel();
+
+	bool IsPolling() const;
+
+	/** Number of refresh requests sent. */
+	int32 GetPollCount() const;
+
+	/**
+	 * @brief Delay before the next poll after a successful one, advances the state.
+	 *
+	 * @param JitterRandom Random number in [0, 1], passed in so the spacing can be simulated deterministically.
+	 */
+	static float ComputePollDelay(FAccelByteLoginQueuePollState& State
+		, FAccelByteModelsLoginQueueTicketInfo const& TicketInfo
+		, float RetryAfterSeconds
+		, FAccelByteLoginQueuePollPolicy const& Policy
+		, float JitterRandom);
+
+	/**
+	 * @brief Delay before the next poll after a failed one, advances the state.
+	 */
+	static float ComputeErrorDelay(FAccelByteLoginQueuePollState& State
+		, float RetryAfterSeconds
+		, FAccelByteLoginQueuePollPolicy const& Policy
+		, float JitterRandom);
+
+	/**
+	 * @brief Parse a Retry-After header, either delay seconds or an HTTP date, into seconds.
+	 */
+	static float ParseRetryAfter(FString const& HeaderValue);
+
+private:
+	void ScheduleNextPoll(float DelaySeconds);
+	bool Poll(float DeltaTime);
+	void OnRefreshed(FAccelByteLoginQueueRefreshResult const& Result);
+	static bool IsRetriable(int32 ErrorCode);
+
+	FRefreshTicket const RefreshTicket;
+	FAccelByteLoginQueuePollPolicy const Policy;
+
+	mutable FCriticalSection Lock;
+	FAccelByteModelsLoginQueueTicketInfo CurrentTicket;
+	FAccelByteLoginQueuePollState State;
+	THandler<FAccelByteModelsLoginQueueTicketInfo> OnTicketUpdatedDelegate;
+	THandler<FAccelByteModelsLoginQueueTicketInfo> OnReadyDelegate;
+	FErrorHandler OnErrorDelegate;
+
+	bool bIsPolling {false};
+	int32 PollCount {0};
+	FAccelByteTaskWPtr PollTask;
+	FDelegateHandleAlias TickerHandle;
+};
+
+}
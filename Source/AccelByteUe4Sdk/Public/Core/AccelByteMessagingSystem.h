@@ -9,6 +9,7 @@
 #include "Containers/Ticker.h"
 
 #include "AccelByteDefines.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
 #include "Models/AccelByteMessagingSystemModels.h"
 #include "JsonObjectConverter.h"
 
@@ -106,7 +107,7 @@ private:
 
 	const float PollingIntervalSecs = 0.5f;
 	FTickerDelegate TickerDelegate{};
-	FDelegateHandleAlias PollHandle{};
+	FAccelBytePeriodicTaskHandle PollHandle{};
 
 	FThreadSafeCounter TotalSubscribers{0};
 
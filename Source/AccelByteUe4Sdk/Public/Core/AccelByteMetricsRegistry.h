@@ -0,0 +1,181 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteMetrics, Log, All);
+
+namespace AccelByte
+{
+
+/**
+ * @brief Log-linear (HDR style) latency histogram with microsecond resolution.
+ * Every power of two range is split into SubBucketCount linear buckets, which keeps the relative error
+ * of any reported percentile below 1 / SubBucketCount regardless of the magnitude.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 MaxTrackableBits = 32; // ~71 minutes in microseconds
+	static constexpr int32 BucketCount = SubBucketCount + (MaxTrackableBits - SubBucketBits) * SubBucketCount;
+
+	FAccelByteLatencyHistogram();
+
+	void Record(double LatencyMs);
+	void Reset();
+
+	int64 GetCount() const { return TotalCount; }
+	double GetMinMs() const;
+	double GetMaxMs() const;
+	double GetMeanMs() const;
+
+	/**
+	 * @brief Get the latency value at a given percentile.
+	 *
+	 * @param Percentile Value between 0 and 100.
+	 * @return The upper bound of the bucket that contains the percentile, in milliseconds.
+	 */
+	double GetPercentileMs(double Percentile) const;
+
+	void Merge(FAccelByteLatencyHistogram const& Other);
+
+private:
+	static int32 GetBucketIndex(uint64 ValueUs);
+	static uint64 GetBucketUpperBoundUs(int32 Index);
+
+	TArray<uint32> Buckets;
+	int64 TotalCount{0};
+	uint64 MinUs{MAX_uint64};
+	uint64 MaxUs{0};
+	double SumUs{0.0};
+};
+
+struct ACCELBYTEUE4SDK_API FAccelByteLatencySummary
+{
+	FString Endpoint{};
+	int64 Count{0};
+	int64 ErrorCount{0};
+	double MinMs{0.0};
+	double MeanMs{0.0};
+	double P50Ms{0.0};
+	double P90Ms{0.0};
+	double P99Ms{0.0};
+	double MaxMs{0.0};
+};
+
+struct ACCELBYTEUE4SDK_API FAccelByteHealthSnapshot
+{
+	FDateTime CapturedAt{0};
+	double UptimeSeconds{0.0};
+
+	/** @brief HTTP latency per normalized endpoint template, e.g. "GET /iam/v3/public/namespaces/{namespace}/users/{id}". */
+	TArray<FAccelByteLatencySummary> Endpoints{};
+
+	/** @brief Named latency histograms that are not HTTP endpoints, e.g. websocket receive-to-dispatch latency. */
+	TArray<FAccelByteLatencySummary> Latencies{};
+
+	/** @brief Counters grouped by subsystem, e.g. Counters["Http"]["Retry"]. */
+	TMap<FString, TMap<FString, int64>> Counters{};
+
+	/** @brief Ratio of HTTP cache hits over HTTP cache lookups, 0 when the cache was never queried. */
+	double HttpCacheHitRatio{0.0};
+
+	int64 GetCounter(FString const& Subsystem, FString const& Name) const;
+};
+
+/**
+ * @brief In-process registry of SDK health metrics.
+ * Collects per endpoint HTTP latency histograms and plain counters per subsystem (HTTP retry, cache, rate limit,
+ * websocket reconnects). Recording is thread safe and cheap enough to stay enabled in shipping builds, it can be
+ * disabled with [AccelByte.Metrics] bEnableMetrics=false in DefaultEngine.ini.
+ *
+ * At most [AccelByte.Metrics] MaxEndpointSeries (default 200) endpoint histograms are kept, requests to endpoints
+ * seen after that are recorded under "<VERB> {other}" so the series exported, e.g. to StatsD, stay bounded.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteMetricsRegistry
+{
+public:
+	static const FString SubsystemHttp;
+	static const FString SubsystemHttpCache;
+	static const FString SubsystemWebSocket;
+	static const FString SubsystemDataStorage;
+
+	FAccelByteMetricsRegistry();
+	~FAccelByteMetricsRegistry();
+
+	void InitializeFromConfig();
+
+	bool IsEnabled() const { return bEnabled; }
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	/**
+	 * @brief Record the latency of a finished HTTP request.
+	 *
+	 * @param Verb HTTP verb of the request.
+	 * @param Url Full URL of the request, it will be normalized into an endpoint template.
+	 * @param LatencyMs Elapsed time from scheduling the request until it is finished, including retries.
+	 * @param StatusCode HTTP response code, 0 when there is no response.
+	 */
+	void RecordHttpLatency(FString const& Verb, FString const& Url, double LatencyMs, int32 StatusCode);
+
+	/**
+	 * @brief Record a latency sample on a named histogram that is not tied to an HTTP endpoint.
+	 */
+	void RecordLatency(FString const& Name, double LatencyMs);
+
+	void IncrementCounter(FString const& Subsystem, FString const& Name, int64 Delta = 1);
+	int64 GetCounter(FString const& Subsystem, FString const& Name) const;
+
+	/**
+	 * @brief Capture a copy of all the metrics recorded so far.
+	 */
+	FAccelByteHealthSnapshot GetHealthSnapshot() const;
+
+	/**
+	 * @brief Remove all recorded samples and counters.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Convert a request URL into a low cardinality endpoint template.
+	 * Scheme, host and query string are stripped, and path segments that look like identifiers
+	 * (numbers, UUIDs, hex hashes) are replaced with {id}. The segment following "namespaces" is
+	 * replaced with {namespace}, the one following a parameterized collection of the services routes,
+	 * e.g. "records", "skus" or "codes", is replaced with {key}.
+	 */
+	static FString NormalizeEndpoint(FString const& Verb, FString const& Url);
+
+private:
+	struct FEndpointMetrics
+	{
+		FAccelByteLatencyHistogram Histogram{};
+		int64 ErrorCount{0};
+	};
+
+	static bool IsIdentifierSegment(FString const& Segment);
+	static bool IsParameterizedCollection(FString const& Segment);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FEndpointMetrics> EndpointMetrics;
+	TMap<FString, FAccelByteLatencyHistogram> NamedHistograms;
+	TMap<FString, TMap<FString, int64>> Counters;
+	double StartTime{0.0};
+	int32 MaxEndpointSeries{200};
+
+	/** Read by the HTTP threads on every request. */
+	FThreadSafeBool bEnabled{true};
+
+	FAccelByteMetricsRegistry(FAccelByteMetricsRegistry const&) = delete;
+	FAccelByteMetricsRegistry(FAccelByteMetricsRegistry&&) = delete;
+	FAccelByteMetricsRegistry& operator=(FAccelByteMetricsRegistry const&) = delete;
+	FAccelByteMetricsRegistry& operator=(FAccelByteMetricsRegistry&&) = delete;
+};
+
+}
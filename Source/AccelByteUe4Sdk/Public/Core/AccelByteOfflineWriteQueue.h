@@ -0,0 +1,234 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
+
+namespace AccelByte
+{
+
+class BaseCredentials;
+class FHttpClient;
+
+/** Sent with every replay, so a service that deduplicates writes can drop one it already applied. */
+const constexpr TCHAR* GHeaderABIdempotencyKey = TEXT("Idempotency-Key");
+
+/**
+ * @brief Why replaying a write is harmless, a replay can reach the service after a lost response to an earlier attempt.
+ */
+enum class EAccelByteOfflineReplaySafety : uint8
+{
+	/** Applied twice if replayed, e.g. a stat increment. Never queued. */
+	Unsafe,
+
+	/** Applying the write twice has the effect of applying it once, e.g. a record save, an achievement unlock or a stat override. */
+	Idempotent,
+
+	/**
+	 * Applied again if replayed after a lost response, for writes whose duplicates are tolerated, e.g. telemetry
+	 * events. Enqueue it instead of sending it.
+	 */
+	AtLeastOnce
+};
+
+/**
+ * @brief Replay safe write kept by FAccelByteOfflineWriteQueue until the service accepts or rejects it.
+ * The API classes build the operations of their replay safe writes, e.g. CloudSave::MakeSaveUserRecordOperation.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteOfflineOperation
+{
+	/** Unique key of the write, sent as the Idempotency-Key header. An operation enqueued again with a key already queued is ignored. */
+	FString IdempotencyKey;
+
+	/**
+	 * Writes sharing a coalesce key replace the same state and only the latest one is kept, e.g. the verb and URL of a
+	 * cloud save record replace. Empty for writes that must all be sent, e.g. record merges or events.
+	 */
+	FString CoalesceKey;
+
+	EAccelByteOfflineReplaySafety ReplaySafety {EAccelByteOfflineReplaySafety::Unsafe};
+
+	FString Verb;
+
+	/** Full URL of the write, already formatted with the namespace and user id. */
+	FString Url;
+
+	FString Content;
+	FString ContentType {TEXT("application/json")};
+
+	/** User the write is sent as, the credentials user when left empty. Replayed only while that user is logged in. */
+	FString UserId;
+
+	FDateTime EnqueuedAt {0};
+	int32 AttemptCount {0};
+
+	/**
+	 * @brief Operation with a new idempotency key.
+	 *
+	 * @param UserId User the write is sent as, see UserId.
+	 */
+	static FAccelByteOfflineOperation Make(FString const& Verb
+		, FString const& Url
+		, FString const& Content
+		, FString const& UserId
+		, EAccelByteOfflineReplaySafety ReplaySafety);
+};
+
+/**
+ * @brief Counters of the offline write queue since startup.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteOfflineQueueStats
+{
+	int32 QueuedCount {0};
+	int64 EnqueuedCount {0};
+
+	/** Enqueued again with an idempotency key already queued. */
+	int64 DuplicateCount {0};
+
+	/** Replaced by a later write with the same coalesce key before being sent. */
+	int64 CoalescedCount {0};
+
+	/** Accepted by the service. */
+	int64 ReplayedCount {0};
+
+	/** Rejected by the service with a non retryable error, e.g. a validation error. */
+	int64 RejectedCount {0};
+
+	/** Dropped unsent because the queue was full. */
+	int64 EvictedCount {0};
+
+	/** Replays that failed with a retryable error and were put back. */
+	int64 RetryCount {0};
+
+	/** Longest time an operation waited between being enqueued and being accepted. */
+	double MaxQueueSeconds {0.0};
+};
+
+/**
+ * @brief Durable queue of the replay safe writes that couldn't reach the services, e.g. a cloud save record save or
+ * an achievement unlock sent while the network is down. Only writes that are idempotent, or whose duplicates are
+ * tolerated, are accepted, see EAccelByteOfflineReplaySafety. A replay after a lost response applies the write again.
+ *
+ * A write is queued either directly with Enqueue, or only when it fails with a retryable error by sending it with the
+ * handler of EnqueueOnError.
+ *
+ * Operations are stored in the general purpose cache of IAccelByteDataStorage on every change, so they survive a
+ * restart, and are replayed one at a time in the order they were enqueued. A replay failing with a retryable error,
+ * see IsRetryableError, stops the replay for an exponential backoff from [AccelByte.OfflineQueue] BackoffBaseSeconds
+ * (default 2) up to BackoffMaxSeconds (default 300), the first successful replay resets it. Any other error drops the
+ * operation. A replay with no response after ReplayTimeoutSeconds (default 120) is retried the same way. At most
+ * MaxOperations (default 256) are kept, the oldest is dropped when the queue is full.
+ *
+ * The queue never sends anything as another user, operations of a user are replayed only while that user is logged in.
+ * The queue is owned by FRegistry and replays with FRegistry::Credentials and FRegistry::HttpClient, so only the
+ * operations of the user logged in through the default client are replayed. Those of the other FApiClient instances
+ * stay queued.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteOfflineWriteQueue
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_FourParams(FOnOperationCompleted
+		, FAccelByteOfflineOperation const& /*Operation*/
+		, bool /*bIsSucceeded*/
+		, int32 /*ErrorCode*/
+		, FString const& /*ErrorMessage*/);
+
+	FAccelByteOfflineWriteQueue(BaseCredentials const& InCredentialsRef, FHttpClient& InHttpClientRef);
+
+	/**
+	 * @brief Load the config and the operations stored by a previous run, then start replaying.
+	 * Must be called once the local data storage is available.
+	 */
+	void Startup();
+
+	/**
+	 * @brief Stop replaying, the queued operations stay stored for the next run.
+	 */
+	void Shutdown();
+
+	/**
+	 * @brief Store a write and replay it as soon as the network and the session allow.
+	 *
+	 * @return False when the operation is invalid, not replay safe or its idempotency key is already queued.
+	 */
+	bool Enqueue(FAccelByteOfflineOperation const& Operation);
+
+	/**
+	 * @brief Error handler of a write sent right away, that enqueues the operation of the same write when it fails
+	 * with a retryable error instead of calling OnError. Its result is then reported by OnOperationCompleted.
+	 * Only idempotent writes are enqueued after a failure, the failed attempt may have been applied already.
+	 *
+	 * @param Operation The same write, built by the API class, e.g. Achievement::MakeUnlockAchievementOperation.
+	 * @param OnError Called when the write fails with another error or can't be enqueued.
+	 */
+	FErrorHandler EnqueueOnError(FAccelByteOfflineOperation const& Operation, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Whether a write that failed with this error code should be enqueued, the request never reached the
+	 * service or the service failed to handle it.
+	 */
+	static bool IsRetryableError(int32 ErrorCode);
+
+	/**
+	 * @brief Skip the current backoff and replay on the next tick, e.g. when the platform reports the network is back.
+	 */
+	void ReplayNow();
+
+	/**
+	 * @brief Drop every queued operation of a user, e.g. when the user deletes their local data.
+	 */
+	void Clear(FString const& UserId);
+
+	TArray<FAccelByteOfflineOperation> GetOperations() const;
+	FAccelByteOfflineQueueStats GetStats() const;
+
+	/**
+	 * @brief Called when an operation leaves the queue, accepted, rejected or evicted.
+	 * Replays complete on the game thread, evictions are reported from the thread that enqueued or loaded the writes.
+	 */
+	FOnOperationCompleted& OnOperationCompleted() { return OperationCompleted; }
+
+private:
+	void LoadConfig();
+	void Load();
+	void Persist();
+	bool Replay(float DeltaTime);
+	void OnReplayDone(int32 ReplayId, FString const& IdempotencyKey, bool bIsSucceeded, int32 ErrorCode, FString const& ErrorMessage);
+	void Add(FAccelByteOfflineOperation const& Operation, TArray<FAccelByteOfflineOperation>& OutEvicted);
+	void BroadcastEvicted(TArray<FAccelByteOfflineOperation> const& Evicted);
+
+	static FString OperationsToJsonString(TArray<FAccelByteOfflineOperation> const& Operations);
+	static bool OperationsFromJsonString(FString const& JsonString, TArray<FAccelByteOfflineOperation>& OutOperations);
+
+	BaseCredentials const& CredentialsRef;
+	FHttpClient& HttpClientRef;
+
+	mutable FCriticalSection Lock;
+	TArray<FAccelByteOfflineOperation> Operations;
+	FAccelByteOfflineQueueStats Stats;
+	bool bIsStarted {false};
+	bool bIsReplaying {false};
+
+	/** Id of the replay in flight, a response of an older replay given up on is ignored. */
+	int32 CurrentReplayId {0};
+	FString ReplayingKey;
+	double ReplayStartTime {0.0};
+	int32 ConsecutiveFailures {0};
+	double NextReplayTime {0.0};
+	FAccelBytePeriodicTaskHandle ReplayHandle;
+	FOnOperationCompleted OperationCompleted;
+
+	int32 MaxOperations {256};
+	double BackoffBaseSeconds {2.0};
+	double BackoffMaxSeconds {300.0};
+	double ReplayTimeoutSeconds {120.0};
+};
+
+}
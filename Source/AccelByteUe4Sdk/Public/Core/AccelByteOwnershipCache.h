@@ -0,0 +1,287 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+#include "Models/AccelByteEcommerceModels.h"
+#include "Models/AccelByteLobbyModels.h"
+
+namespace AccelByte
+{
+class BaseCredentials;
+
+namespace Api
+{
+	class Entitlement;
+	class Fulfillment;
+	class Lobby;
+}
+
+/**
+ * @brief Counters of the ownership cache since it was created.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteOwnershipCacheStats
+{
+	/** Checks served from a cached ownership result. */
+	int64 MemoryHitCount {0};
+
+	/** Checks served from a cached ownership token, verified or matched locally. */
+	int64 TokenHitCount {0};
+
+	/** Checks that had to request the entitlement service. */
+	int64 MissCount {0};
+
+	/** Times the cached entries were dropped because the entitlements of the user changed. */
+	int64 InvalidationCount {0};
+
+	/** Average time from a check call to its OnSuccess or OnError, hits and misses included. */
+	double AverageCheckMs {0.0};
+
+	double GetHitRate() const
+	{
+		const int64 CheckCount = MemoryHitCount + TokenHitCount + MissCount;
+		return CheckCount > 0 ? static_cast<double>(MemoryHitCount + TokenHitCount) / CheckCount : 0.0;
+	}
+};
+
+/**
+ * @brief Client side cache of the entitlement ownership checks of the user, owned by FApiClient, so gating checks that
+ * run on every menu or level load don't each send a request.
+ *
+ * A check is served from the first tier that can answer it:
+ * - the result of the same check, kept [AccelByte.OwnershipCache] OwnedTtlSeconds (default 300) when owned and
+ *   NotOwnedTtlSeconds (default 60) when not.
+ * - an ownership token fetched by GetOwnershipViaToken for the same namespace, while it's valid. GetOwnershipViaToken
+ *   verifies the signature and the expiration of the cached token again on every call, the other checks are answered
+ *   from its decoded entitlements when every id they ask for was part of the token request.
+ * - the entitlement service, concurrent misses of the same check share one request. Its task is returned to the first
+ *   caller, aborting it fails every check sharing it with ErrorCodes::RequestCancelled.
+ *
+ * Every entry is dropped when a call of Entitlement or Fulfillment changes the entitlements of the user, or when the
+ * lobby receives a notification whose topic contains one of [AccelByte.OwnershipCache] InvalidationTopics (comma
+ * separated, case insensitive, default "ENTITLEMENT,FULFILL"). Entries are kept per user id, so a logout or an account
+ * switch never serves the checks of another user.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteOwnershipCache
+{
+public:
+	FAccelByteOwnershipCache(BaseCredentials const& InCredentialsRef
+		, Api::Entitlement& InEntitlement
+		, Api::Fulfillment& InFulfillment
+		, Api::Lobby& InLobby);
+	~FAccelByteOwnershipCache();
+
+	/**
+	 * @brief Get the ownership of an app, see Entitlement::GetUserEntitlementOwnershipByAppId.
+	 *
+	 * @return AccelByteTask object of the request, invalid when the check is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetOwnershipByAppId(FString const& AppId
+		, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bUsePublisherNamespace = true
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the ownership of an item SKU, see Entitlement::GetUserEntitlementOwnershipBySku.
+	 *
+	 * @return AccelByteTask object of the request, invalid when the check is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetOwnershipBySku(FString const& Sku
+		, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bUsePublisherNamespace = true
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the ownership of an item, see Entitlement::GetUserEntitlementOwnershipByItemId.
+	 *
+	 * @return AccelByteTask object of the request, invalid when the check is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetOwnershipByItemId(FString const& ItemId
+		, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bUsePublisherNamespace = false
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get whether any of the items, apps or SKUs is owned, see Entitlement::GetUserEntitlementOwnershipAny.
+	 * The order of the ids doesn't matter. A check answered from a cached token has no EndDate.
+	 *
+	 * @return AccelByteTask object of the request, invalid when the check is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetOwnershipAny(TArray<FString> const& ItemIds
+		, TArray<FString> const& AppIds
+		, TArray<FString> const& Skus
+		, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bUsePublisherNamespace = true
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the ownership of each item, see Entitlement::GetUserEntitlementOwnershipByItemIds. Only the items
+	 * missing or stale are requested.
+	 *
+	 * @return AccelByteTask object of the request, invalid when every item is served from the cache.
+	 */
+	FAccelByteTaskWPtr GetOwnershipByItemIds(TArray<FString> const& ItemIds
+		, THandler<TArray<FAccelByteModelsEntitlementOwnershipItemIds>> const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Get the owned entitlements out of a signed ownership token, see
+	 * Entitlement::GetUserEntitlementOwnershipViaToken. The signature and the expiration are always verified, the
+	 * cached token is reused until it expires and a new one is requested otherwise.
+	 *
+	 * @return AccelByteTask object of the request, invalid when the cached token is reused.
+	 */
+	FAccelByteTaskWPtr GetOwnershipViaToken(FString const& PublicKey
+		, TArray<FString> const& ItemIds
+		, TArray<FString> const& AppIds
+		, TArray<FString> const& Skus
+		, THandler<FAccelByteModelsEntitlementOwnershipDetails> const& OnSuccess
+		, FErrorHandler const& OnError
+		, FString const& VerifySub = TEXT("")
+		, bool bUsePublisherNamespace = true
+		, bool bForceRefresh = false);
+
+	/**
+	 * @brief Remove every cached result and token, the requests in flight won't be cached either.
+	 */
+	void Clear();
+
+	FAccelByteOwnershipCacheStats GetStats() const;
+
+private:
+	struct FOwnershipEntry
+	{
+		FAccelByteModelsEntitlementOwnership Ownership;
+		double ExpiresAt {0.0};
+	};
+
+	struct FTokenEntry
+	{
+		FString OwnershipToken;
+		FString UserId;
+		FDateTime ExpiresAt {0};
+		bool bUsePublisherNamespace {true};
+		TSet<FString> ItemIds;
+		TSet<FString> AppIds;
+		TSet<FString> Skus;
+		FAccelByteModelsEntitlementOwnershipDetails Details;
+	};
+
+	struct FPendingCheck
+	{
+		THandler<FAccelByteModelsEntitlementOwnership> OnSuccess;
+		FErrorHandler OnError;
+		double StartTime {0.0};
+	};
+
+	/** Request shared by the pending checks of a key. */
+	struct FPendingRequest
+	{
+		FAccelByteTaskWPtr Task;
+
+		/** Consecutive watchdog checks that found the task done while its checks were still pending. */
+		int32 UnansweredCheckCount {0};
+	};
+
+	/** Shared with the request callbacks, which can outlive the cache. */
+	struct FState
+	{
+		mutable FCriticalSection Lock;
+		TMap<FString, FOwnershipEntry> Entries;
+		TMap<FString, FTokenEntry> Tokens;
+		TMap<FString, TArray<FPendingCheck>> PendingChecks;
+		TMap<FString, FPendingRequest> PendingRequests;
+		bool bIsWatchdogRunning {false};
+
+		/** Incremented by Clear, responses of requests sent before are not cached. */
+		int32 Generation {0};
+
+		double OwnedTtlSeconds {300.0};
+		double NotOwnedTtlSeconds {60.0};
+		FAccelByteOwnershipCacheStats Stats;
+		int64 CheckCount {0};
+		double TotalCheckMs {0.0};
+
+		void RecordCheck(double StartTime);
+		void StoreOwnership(FString const& Key, FAccelByteModelsEntitlementOwnership const& Ownership, double Now);
+	};
+
+	static constexpr float WatchdogPeriodSeconds = 1.0f;
+
+	/** A task done without calling its handlers, e.g. cancelled, is given this many checks to call them. */
+	static constexpr int32 MaxUnansweredCheckCount = 2;
+
+	using FOwnershipRequest = TFunction<FAccelByteTaskWPtr(THandler<FAccelByteModelsEntitlementOwnership> const&, FErrorHandler const&)>;
+
+	FAccelByteTaskWPtr GetOwnership(FString const& Key
+		, TArray<FString> const& ItemIds
+		, TArray<FString> const& AppIds
+		, TArray<FString> const& Skus
+		, bool bUsePublisherNamespace
+		, bool bForceRefresh
+		, FOwnershipRequest const& Request
+		, THandler<FAccelByteModelsEntitlementOwnership> const& OnSuccess
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Start the watchdog failing the checks whose shared request was aborted, its handlers are never called.
+	 * Called with the lock held, does nothing when the watchdog is already running.
+	 */
+	static void StartWatchdog(TSharedRef<FState, ESPMode::ThreadSafe> const& InState);
+
+	/**
+	 * @return False once no request is pending, the watchdog stops.
+	 */
+	static bool FailAbortedChecks(FState& InState);
+
+	static void FailPendingChecks(FState& InState, FString const& PendingKey, FString const& ErrorMessage);
+
+	void OnLobbyNotification(FAccelByteModelsNotificationMessage const& Message);
+	void OnEntitlementsChanged();
+
+	/** Key of a check of a user, the same whatever the order of the ids. */
+	static FString MakeKey(FString const& UserId
+		, TCHAR const* Kind
+		, TArray<FString> const& ItemIds
+		, TArray<FString> const& AppIds
+		, TArray<FString> const& Skus
+		, bool bUsePublisherNamespace);
+
+	static bool TryGetFromTokens(FState const& InState
+		, FString const& UserId
+		, TArray<FString> const& ItemIds
+		, TArray<FString> const& AppIds
+		, TArray<FString> const& Skus
+		, bool bUsePublisherNamespace
+		, FAccelByteModelsEntitlementOwnership& OutOwnership);
+
+	static bool TryDecodeToken(FString const& OwnershipToken
+		, FString const& PublicKey
+		, FString const& VerifySub
+		, FAccelByteModelsEntitlementOwnershipDetails& OutDetails
+		, int32& OutErrorCode
+		, FString& OutErrorMessage);
+
+	BaseCredentials const& CredentialsRef;
+	Api::Entitlement& Entitlement;
+	Api::Fulfillment& Fulfillment;
+	Api::Lobby& Lobby;
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+	TArray<FString> InvalidationTopics;
+
+	FDelegateHandle EntitlementsChangedDelegateHandle;
+	FDelegateHandle FulfillmentDelegateHandle;
+	FDelegateHandle LobbyNotificationDelegateHandle;
+};
+
+}
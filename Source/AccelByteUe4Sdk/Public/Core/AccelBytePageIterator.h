@@ -0,0 +1,449 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+
+namespace AccelByte
+{
+
+struct FAccelBytePageIteratorOptions
+{
+	/** Maximum number of items to fetch, 0 for no limit. */
+	int32 MaxItems {0};
+	/** Maximum number of pages requested ahead of the consumer, 0 to use the configured value. */
+	int32 MaxInFlight {0};
+};
+
+/**
+ * @brief Non template part of TAccelBytePageIterator.
+ */
+class ACCELBYTEUE4SDK_API FAccelBytePageIteratorBase
+{
+public:
+	/**
+	 * @brief Resolve a Paging.Next link against the URL of the page it was returned with.
+	 * The backend returns either an absolute URL, an absolute path or a bare query string.
+	 */
+	static FString ResolvePageUrl(FString const& PageUrl, FString const& Next);
+
+protected:
+	/** [AccelByte.Http] PageMaxInFlightRequests in DefaultEngine.ini, default 2. */
+	static int32 GetConfiguredMaxInFlight();
+};
+
+/**
+ * @brief Async iterator over a paged query, TPage being one of the ...PagingSlicedResult / ...PagingResponse models.
+ * Pages are delivered in order, one GetNextPage call at a time, while the following pages are already being requested so
+ * that consuming a page overlaps with fetching the next ones.
+ *
+ * Two modes are available:
+ * - offsets: pages are addressed by offset and limit, up to MaxInFlight pages are requested concurrently ahead of
+ *   the consumer. The iteration ends on the first page without Paging.Next.
+ * - links: the Paging.Next link of each page is followed, the next page is requested as soon as the current one
+ *   arrives, before the consumer asks for it.
+ *
+ * FHttpClient::CreatePageIterator and FHttpClient::CreatePageLinkIterator build iterators for a plain GET endpoint.
+ * Callbacks of the page requests keep the iterator alive, Cancel stops it and cancels the requests in flight.
+ */
+template<typename TPage>
+class TAccelBytePageIterator
+	: public FAccelBytePageIteratorBase
+	, public TSharedFromThis<TAccelBytePageIterator<TPage>, ESPMode::ThreadSafe>
+{
+public:
+	/** Request the page at the given offset. */
+	using FOffsetRequest = TFunction<FAccelByteTaskWPtr(int32 /*Offset*/, int32 /*Limit*/, THandler<TPage> const& /*OnSuccess*/, FErrorHandler const& /*OnError*/)>;
+	/** Request the page of the given Paging.Next link, empty for the first page. */
+	using FLinkRequest = TFunction<FAccelByteTaskWPtr(FString const& /*Next*/, THandler<TPage> const& /*OnSuccess*/, FErrorHandler const& /*OnError*/)>;
+	/** Number of items of a page, only used to enforce MaxItems when following links. */
+	using FCountItems = TFunction<int32(TPage const& /*Page*/)>;
+	using FIteratorRef = TSharedRef<TAccelBytePageIterator, ESPMode::ThreadSafe>;
+
+	/**
+	 * @brief Iterate a query addressed by offset and limit.
+	 *
+	 * @param OffsetRequest Request one page.
+	 * @param PageSize Number of items per page, must not exceed the maximum limit of the endpoint.
+	 * @param StartOffset Offset of the first item.
+	 * @param Options Item cap and number of pages requested ahead.
+	 */
+	static FIteratorRef CreateFromOffsets(FOffsetRequest OffsetRequest
+		, int32 PageSize
+		, int32 StartOffset = 0
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions())
+	{
+		FIteratorRef Iterator = MakeShared<TAccelBytePageIterator, ESPMode::ThreadSafe>(Options);
+		Iterator->OffsetRequest = MoveTemp(OffsetRequest);
+		Iterator->PageSize = FMath::Max(1, PageSize);
+		Iterator->StartOffset = FMath::Max(0, StartOffset);
+		return Iterator;
+	}
+
+	/**
+	 * @brief Iterate a query by following the Paging.Next links.
+	 *
+	 * @param LinkRequest Request one page.
+	 * @param CountItems Optional, needed for Options.MaxItems. The page reaching the cap is delivered whole.
+	 * @param Options Item cap.
+	 */
+	static FIteratorRef CreateFromLinks(FLinkRequest LinkRequest
+		, FCountItems CountItems = nullptr
+		, FAccelBytePageIteratorOptions const& Options = FAccelBytePageIteratorOptions())
+	{
+		FIteratorRef Iterator = MakeShared<TAccelBytePageIterator, ESPMode::ThreadSafe>(Options);
+		Iterator->LinkRequest = MoveTemp(LinkRequest);
+		Iterator->CountItems = MoveTemp(CountItems);
+		Iterator->bFollowLinks = true;
+		return Iterator;
+	}
+
+	explicit TAccelBytePageIterator(FAccelBytePageIteratorOptions const& Options)
+		: MaxItems(FMath::Max(0, Options.MaxItems))
+		, MaxInFlight(FMath::Max(1, Options.MaxInFlight > 0 ? Options.MaxInFlight : GetConfiguredMaxInFlight()))
+	{
+	}
+
+	/**
+	 * @brief Whether GetNextPage can deliver another page.
+	 * The end is only known once the last page arrives, so the last delivered page can be empty.
+	 */
+	bool HasMorePages() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return HasMorePagesLocked();
+	}
+
+	/**
+	 * @brief Get the next page, immediately if it was already fetched. Only one call can be pending at a time.
+	 *
+	 * @param OnPage Called with the page.
+	 * @param OnError Called when the page request failed, or when there's no more page. The iteration ends on error.
+	 */
+	void GetNextPage(THandler<TPage> const& OnPage, FErrorHandler const& OnError)
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (bHasWaiter)
+			{
+				ScopeLock.Unlock();
+				OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("A page is already being waited for"));
+				return;
+			}
+			if (!HasMorePagesLocked())
+			{
+				ScopeLock.Unlock();
+				OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("No more pages"));
+				return;
+			}
+			bHasWaiter = true;
+			WaiterOnPage = OnPage;
+			WaiterOnError = OnError;
+		}
+
+		SendRequests();
+		TryDeliver();
+	}
+
+	/**
+	 * @brief Consume every page in order.
+	 *
+	 * @param OnPage Called for each page, return false to stop the iteration.
+	 * @param OnComplete Called after the last page, or when OnPage stopped the iteration.
+	 * @param OnError Called when a page request failed.
+	 */
+	void ForEachPage(TFunction<bool(TPage const&)> OnPage, FVoidHandler const& OnComplete, FErrorHandler const& OnError)
+	{
+		if (!HasMorePages())
+		{
+			OnComplete.ExecuteIfBound();
+			return;
+		}
+
+		FIteratorRef Iterator = this->AsShared();
+		GetNextPage(THandler<TPage>::CreateLambda([Iterator, OnPage, OnComplete, OnError](TPage const& Page)
+				{
+					if (OnPage && !OnPage(Page))
+					{
+						Iterator->Cancel();
+						OnComplete.ExecuteIfBound();
+						return;
+					}
+					Iterator->ForEachPage(OnPage, OnComplete, OnError);
+				})
+			, OnError);
+	}
+
+	/**
+	 * @brief Cancel the iteration along with a cancellation token.
+	 */
+	void LinkCancellation(FAccelByteRequestCancellationTokenRef const& CancellationToken)
+	{
+		TWeakPtr<TAccelBytePageIterator, ESPMode::ThreadSafe> IteratorWPtr = this->AsShared();
+		CancellationToken->RegisterCallback([IteratorWPtr]()
+			{
+				TSharedPtr<TAccelBytePageIterator, ESPMode::ThreadSafe> Iterator = IteratorWPtr.Pin();
+				if (Iterator.IsValid())
+				{
+					Iterator->Cancel();
+				}
+			});
+	}
+
+	/**
+	 * @brief Stop the iteration and cancel the page requests in flight.
+	 */
+	void Cancel()
+	{
+		TArray<FAccelByteTaskWPtr> TasksToCancel;
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (bCancelled)
+			{
+				return;
+			}
+			bCancelled = true;
+			for (auto& Slot : Slots)
+			{
+				TasksToCancel.Add(Slot.Value.Task);
+			}
+			Slots.Empty();
+			bHasWaiter = false;
+			WaiterOnPage.Unbind();
+			WaiterOnError.Unbind();
+		}
+
+		CancelTasks(TasksToCancel);
+	}
+
+private:
+	struct FPageSlot
+	{
+		bool bReceived {false};
+		bool bFailed {false};
+		TPage Page {};
+		int32 ErrorCode {0};
+		FString ErrorMessage;
+		FAccelByteTaskWPtr Task;
+	};
+
+	bool HasMorePagesLocked() const
+	{
+		if (bCancelled)
+		{
+			return false;
+		}
+		return LastPageIndex == INDEX_NONE || DeliveredPages <= LastPageIndex;
+	}
+
+	void SendRequests()
+	{
+		FIteratorRef Iterator = this->AsShared();
+		while (true)
+		{
+			int32 PageIndex = INDEX_NONE;
+			int32 Offset = 0;
+			int32 Limit = 0;
+			FString Next;
+			{
+				FScopeLock ScopeLock(&Lock);
+				if (bCancelled || LastPageIndex != INDEX_NONE || RequestedPages - DeliveredPages >= MaxInFlight)
+				{
+					return;
+				}
+
+				if (bFollowLinks)
+				{
+					// The link of the next page is only known once the current page arrives
+					if (RequestedPages > 0 && NextLink.IsEmpty())
+					{
+						return;
+					}
+					Next = NextLink;
+					NextLink.Empty();
+				}
+				else
+				{
+					Offset = StartOffset + RequestedPages * PageSize;
+					Limit = PageSize;
+					if (MaxItems > 0)
+					{
+						const int32 EndOffset = StartOffset + MaxItems;
+						Limit = FMath::Min(Limit, EndOffset - Offset);
+						if (Offset + Limit >= EndOffset)
+						{
+							LastPageIndex = RequestedPages;
+						}
+					}
+				}
+
+				PageIndex = RequestedPages++;
+				Slots.Add(PageIndex);
+			}
+
+			const THandler<TPage> OnSuccess = THandler<TPage>::CreateLambda([Iterator, PageIndex](TPage const& Page)
+				{
+					Iterator->OnPageReceived(PageIndex, Page);
+				});
+			const FErrorHandler OnError = FErrorHandler::CreateLambda([Iterator, PageIndex](int32 ErrorCode, FString const& ErrorMessage)
+				{
+					Iterator->OnPageFailed(PageIndex, ErrorCode, ErrorMessage);
+				});
+			FAccelByteTaskWPtr Task = bFollowLinks ? LinkRequest(Next, OnSuccess, OnError) : OffsetRequest(Offset, Limit, OnSuccess, OnError);
+
+			FScopeLock ScopeLock(&Lock);
+			if (FPageSlot* Slot = Slots.Find(PageIndex))
+			{
+				Slot->Task = Task;
+			}
+		}
+	}
+
+	void OnPageReceived(int32 PageIndex, TPage const& Page)
+	{
+		TArray<FAccelByteTaskWPtr> TasksToCancel;
+		{
+			FScopeLock ScopeLock(&Lock);
+			FPageSlot* Slot = Slots.Find(PageIndex);
+			if (bCancelled || Slot == nullptr)
+			{
+				return;
+			}
+			Slot->bReceived = true;
+			Slot->Page = Page;
+
+			bool bIsLastPage = Page.Paging.Next.IsEmpty();
+			if (bFollowLinks)
+			{
+				NextLink = Page.Paging.Next;
+				if (MaxItems > 0 && CountItems)
+				{
+					ReceivedItems += CountItems(Page);
+					bIsLastPage |= ReceivedItems >= MaxItems;
+				}
+			}
+			if (bIsLastPage)
+			{
+				SetLastPageLocked(PageIndex, TasksToCancel);
+			}
+		}
+
+		CancelTasks(TasksToCancel);
+		TryDeliver();
+		SendRequests();
+	}
+
+	void OnPageFailed(int32 PageIndex, int32 ErrorCode, FString const& ErrorMessage)
+	{
+		TArray<FAccelByteTaskWPtr> TasksToCancel;
+		{
+			FScopeLock ScopeLock(&Lock);
+			FPageSlot* Slot = Slots.Find(PageIndex);
+			if (bCancelled || Slot == nullptr)
+			{
+				return;
+			}
+			Slot->bFailed = true;
+			Slot->ErrorCode = ErrorCode;
+			Slot->ErrorMessage = ErrorMessage;
+			SetLastPageLocked(PageIndex, TasksToCancel);
+		}
+
+		CancelTasks(TasksToCancel);
+		TryDeliver();
+	}
+
+	/** Pages requested past the last one are not needed anymore. */
+	void SetLastPageLocked(int32 PageIndex, TArray<FAccelByteTaskWPtr>& OutTasksToCancel)
+	{
+		if (LastPageIndex != INDEX_NONE && LastPageIndex <= PageIndex)
+		{
+			return;
+		}
+		LastPageIndex = PageIndex;
+
+		for (auto It = Slots.CreateIterator(); It; ++It)
+		{
+			if (It.Key() > PageIndex)
+			{
+				OutTasksToCancel.Add(It.Value().Task);
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	void TryDeliver()
+	{
+		FPageSlot Slot;
+		THandler<TPage> OnPage;
+		FErrorHandler OnError;
+		{
+			FScopeLock ScopeLock(&Lock);
+			FPageSlot* ReadySlot = Slots.Find(DeliveredPages);
+			if (!bHasWaiter || ReadySlot == nullptr || !(ReadySlot->bReceived || ReadySlot->bFailed))
+			{
+				return;
+			}
+
+			Slot = MoveTemp(*ReadySlot);
+			Slots.Remove(DeliveredPages);
+			DeliveredPages++;
+
+			bHasWaiter = false;
+			OnPage = MoveTemp(WaiterOnPage);
+			OnError = MoveTemp(WaiterOnError);
+		}
+
+		if (Slot.bFailed)
+		{
+			OnError.ExecuteIfBound(Slot.ErrorCode, Slot.ErrorMessage);
+			return;
+		}
+
+		// A slot was freed, the next page can be requested while the consumer handles this one
+		SendRequests();
+		OnPage.ExecuteIfBound(Slot.Page);
+	}
+
+	static void CancelTasks(TArray<FAccelByteTaskWPtr> const& Tasks)
+	{
+		for (FAccelByteTaskWPtr const& TaskWPtr : Tasks)
+		{
+			FAccelByteTaskPtr TaskPtr = TaskWPtr.Pin();
+			if (TaskPtr.IsValid())
+			{
+				// The pages are not wanted anymore, skip their deserialization
+				TaskPtr->Abort();
+			}
+		}
+	}
+
+	FOffsetRequest OffsetRequest;
+	FLinkRequest LinkRequest;
+	FCountItems CountItems;
+	bool bFollowLinks {false};
+	int32 PageSize {1};
+	int32 StartOffset {0};
+	const int32 MaxItems;
+	const int32 MaxInFlight;
+
+	mutable FCriticalSection Lock;
+	TMap<int32, FPageSlot> Slots;
+	int32 RequestedPages {0};
+	int32 DeliveredPages {0};
+	int32 LastPageIndex {INDEX_NONE};
+	int32 ReceivedItems {0};
+	FString NextLink;
+	bool bCancelled {false};
+
+	bool bHasWaiter {false};
+	THandler<TPage> WaiterOnPage;
+	FErrorHandler WaiterOnError;
+};
+
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Thread a periodic task runs on.
+ */
+enum class EAccelBytePeriodicTaskThread : uint8
+{
+	GameThread,
+
+	/** Any task graph background thread, for work that doesn't touch the game or call user delegates. */
+	Background
+};
+
+/**
+ * @brief Handle of a task added to FAccelBytePeriodicTaskScheduler.
+ */
+class ACCELBYTEUE4SDK_API FAccelBytePeriodicTaskHandle
+{
+public:
+	bool IsValid() const { return Id != 0; }
+	void Reset() { Id = 0; }
+
+private:
+	friend class FAccelBytePeriodicTaskScheduler;
+	uint64 Id {0};
+};
+
+/**
+ * @brief Run count and cost of a periodic task.
+ */
+struct ACCELBYTEUE4SDK_API FAccelBytePeriodicTaskStats
+{
+	FString Name;
+	float IntervalSeconds {0.0f};
+	EAccelBytePeriodicTaskThread Thread {EAccelBytePeriodicTaskThread::GameThread};
+
+	int64 RunCount {0};
+
+	/** Runs skipped because the previous background run was still in progress. */
+	int64 SkippedCount {0};
+
+	/** Time spent running the task, on the thread it runs on. */
+	double TotalSeconds {0.0};
+	double MaxSeconds {0.0};
+};
+
+/**
+ * @brief Shared scheduler of the periodic work of the SDK, heartbeats, telemetry flush, messaging poll and the like.
+ * A single core ticker wakes up when the earliest task is due instead of one ticker per task.
+ *
+ * Tasks are phase-locked on a grid of their own interval, so tasks whose intervals are multiples of each other are due
+ * at the same time, and due times are rounded up to [AccelByte.PeriodicTasks] AlignmentMilliseconds (default 100).
+ * Every task due in the same window runs in a single wake.
+ *
+ * A task works like a core ticker delegate: it receives the time since its previous run and is removed when it
+ * returns false.
+ */
+class ACCELBYTEUE4SDK_API FAccelBytePeriodicTaskScheduler
+{
+public:
+	FAccelBytePeriodicTaskScheduler();
+	~FAccelBytePeriodicTaskScheduler();
+
+	/**
+	 * @brief Add a task, first run within half an interval to one and a half interval from now.
+	 *
+	 * @param Name Name of the task in the stats.
+	 * @param Task Work to run, returns false to be removed.
+	 * @param IntervalSeconds Time between two runs.
+	 * @param Thread Thread the task runs on. A background run still in progress when the task is due again skips that run.
+	 *
+	 * @return Handle to remove the task.
+	 */
+	FAccelBytePeriodicTaskHandle AddTask(FString const& Name
+		, FTickerDelegate const& Task
+		, float IntervalSeconds
+		, EAccelBytePeriodicTaskThread Thread = EAccelBytePeriodicTaskThread::GameThread);
+
+	/**
+	 * @brief Remove a task and reset its handle, safe to call from the task itself.
+	 * Waits for a background run of the task in progress, the task doesn't run after this returns.
+	 */
+	void RemoveTask(FAccelBytePeriodicTaskHandle& Handle);
+
+	bool IsTaskScheduled(FAccelBytePeriodicTaskHandle const& Handle) const;
+
+	TArray<FAccelBytePeriodicTaskStats> GetTaskStats() const;
+
+	/** Number of times the scheduler woke up to run tasks. */
+	int64 GetWakeCount() const;
+
+private:
+	struct FTask
+	{
+		uint64 Id {0};
+		FTickerDelegate Delegate;
+		/** Next run on the task's interval grid, DueTime is this rounded up to the alignment window. */
+		double GridTime {0.0};
+		double DueTime {0.0};
+		double LastRunTime {0.0};
+		FThreadSafeBool bRemoved {false};
+		FThreadSafeBool bRunning {false};
+		uint32 RunningThreadId {0};
+		FAccelBytePeriodicTaskStats Stats;
+	};
+	typedef TSharedRef<FTask, ESPMode::ThreadSafe> FTaskRef;
+
+	bool Tick(float DeltaTime);
+	void RunTask(FTaskRef const& Task, double Now);
+	void RecordRun(FTaskRef const& Task, uint64 StartCycles, bool bKeep);
+	double AlignDueTime(double GridTime) const;
+	void LoadConfig();
+	void ArmTicker(double Now);
+	void StopTicker();
+
+	mutable FCriticalSection Lock;
+	TMap<uint64, FTaskRef> Tasks;
+	uint64 NextTaskId {1};
+	int64 WakeCount {0};
+
+	bool bIsConfigLoaded {false};
+	double AlignmentSeconds {0.1};
+
+	FDelegateHandleAlias TickerHandle;
+	double ArmedDueTime {0.0};
+
+	FAccelBytePeriodicTaskScheduler(FAccelBytePeriodicTaskScheduler const&) = delete;
+	FAccelBytePeriodicTaskScheduler(FAccelBytePeriodicTaskScheduler&&) = delete;
+	FAccelBytePeriodicTaskScheduler& operator=(FAccelBytePeriodicTaskScheduler const&) = delete;
+	FAccelBytePeriodicTaskScheduler& operator=(FAccelBytePeriodicTaskScheduler&&) = delete;
+};
+
+}
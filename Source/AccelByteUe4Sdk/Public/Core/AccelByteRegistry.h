@@ -11,6 +11,13 @@
 #include "Core/AccelByteMessagingSystem.h"
 #include "Core/AccelByteNetworkConditioner.h"
 #include "Core/AccelByteNotificationSender.h"
+#include "Core/AccelByteMetricsRegistry.h"
+#include "Core/AccelByteWebSocketLoop.h"
+#include "Core/AccelByteTokenRefreshScheduler.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
+#include "Core/AccelByteDeviceIdentity.h"
+#include "Core/AccelByteConnectionWarmup.h"
+#include "Core/AccelByteOfflineWriteQueue.h"
 
 namespace AccelByte
 {
@@ -96,6 +103,8 @@ class ACCELBYTEUE4SDK_API FRegistry
 public:
 #pragma region Core
 	static FHttpRetryScheduler HttpRetryScheduler;
+	static FAccelBytePeriodicTaskScheduler PeriodicTaskScheduler;
+	static FAccelByteTokenRefreshScheduler TokenRefreshScheduler;
 	static Settings Settings;
 	static FCredentialsRef CredentialsRef;
 	static Credentials& Credentials;
@@ -107,6 +116,11 @@ public:
 	static FAccelByteNetworkConditioner NetworkConditioner;
 	static FAccelByteNotificationSender NotificationSender;
 	static FHttpClient HttpClient;
+	static FAccelByteMetricsRegistry MetricsRegistry;
+	static FAccelByteWebSocketLoop WebSocketLoop;
+	static FAccelByteDeviceIdentity DeviceIdentity;
+	static FAccelByteConnectionWarmup ConnectionWarmup;
+	static FAccelByteOfflineWriteQueue OfflineWriteQueue;
 #pragma endregion
 
 #pragma region Game Client Access
@@ -45,6 +45,8 @@ class DBQueryTask : public FNonAbandonableTask
 
 namespace AccelByte
 {
+	class FAccelByteSQLite3BatchWorker;
+
 	class ACCELBYTEUE4SDK_API FAccelByteSQLite3 : public IAccelByteDataStorage
 	{
 	public:
@@ -172,10 +174,44 @@ namespace AccelByte
 		*/
 		virtual void ConvertExistingCache(const FString& OldCacheFilename, const FString& NewCacheFilenameForTelemetry, const FString& NewCacheFilenameForGeneralPurpose) override {};
 
+		/**
+		 * @brief Insert multiple Items to the Key Value Table in a single transaction, override them if already exist.
+		 * The batch runs on the dedicated database thread with cached prepared statements, either every Item is saved or none.
+		 *
+		 * @param Items Pairs of Key and Value, the Value is an array of uint8.
+		 * @param OnDone This will be called on the game thread when the operation done. The result is bool.
+		 * @param TableName optional. The name of the table. Default will insert the items to the default KeyValue table.
+		*/
+		void SaveItems(const TArray<TPair<FString, TArray<uint8>>>& Items, const THandler<bool>& OnDone, const FString& TableName = TEXT("DefaultKeyValueTable"));
+
+		/**
+		 * @brief Insert multiple Items to the Key Value Table in a single transaction, override them if already exist.
+		 * The batch runs on the dedicated database thread with cached prepared statements, either every Item is saved or none.
+		 *
+		 * @param Items Pairs of Key and Value, the Value is a FString.
+		 * @param OnDone This will be called on the game thread when the operation done. The result is bool.
+		 * @param TableName optional. The name of the table. Default will insert the items to the default KeyValue table.
+		*/
+		void SaveItems(const TArray<TPair<FString, FString>>& Items, const THandler<bool>& OnDone, const FString& TableName = TEXT("DefaultKeyValueTable"));
+
+		/**
+		 * @brief Delete multiple Items from the Key Value Table in a single transaction.
+		 *
+		 * @param Keys The Keys of the Items.
+		 * @param OnDone This will be called on the game thread when the operation done. The result is bool.
+		 * @param TableName optional. The name of the table. Default will delete the items from the default KeyValue table.
+		*/
+		void DeleteItems(const TArray<FString>& Keys, const THandler<bool>& OnDone, const FString& TableName = TEXT("DefaultKeyValueTable"));
+
 	private:
 		FString DatabaseName;
 		TArray<FString> RegisteredTable;
 
+		/**
+		 * @brief Connection used by the batch API, opened in WAL mode on its own thread.
+		 */
+		TSharedPtr<FAccelByteSQLite3BatchWorker, ESPMode::ThreadSafe> BatchWorker;
+
 		const FString ClassFieldToSQLiteDataStruct(const FName& FieldClass);
 
 		const FString JsonObjectToSQLiteValue(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, const FString& FieldType);
@@ -50,8 +50,6 @@ private:
 	FString UserId;
 	
 	static const FString DefaultSection;
-
-	void RemoveFromTicker(FDelegateHandleAlias& handle);
 };
 
 typedef TSharedRef<ServerCredentials, ESPMode::ThreadSafe> FServerCredentialsRef;
@@ -0,0 +1,109 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+#include "Models/AccelByteStatisticModels.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Merges stat item increments per (userId, statCode) in memory and sends them as bulk requests.
+ * Gameplay code can queue an increment on every kill or pickup, the accumulator sends a single bulk request:
+ * - every [AccelByte.Statistic] IncrementFlushIntervalSeconds (default 10),
+ * - as soon as IncrementFlushThreshold (default 50) distinct stat items are pending,
+ * - or when Flush is called, e.g. at match end.
+ *
+ * Pending increments are persisted in the local data storage [AccelByte.Statistic] IncrementPersistDelaySeconds
+ * (default 1) after a change, so a burst of increments is written once, and reloaded on Startup to survive a crash.
+ * Increments of a failed request are merged back and sent again on the next flush, unless the backend rejected the
+ * request itself.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteStatIncrementAccumulator
+	: public TSharedFromThis<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe>
+{
+public:
+	/** Send the merged increments, the same shape as ServerStatistic::IncrementManyUsersStatItems. */
+	using FFlushRequest = TFunction<FAccelByteTaskWPtr(TArray<FAccelByteModelsBulkUserStatItemInc> const& /*Increments*/
+		, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> const& /*OnSuccess*/
+		, FErrorHandler const& /*OnError*/)>;
+
+	/**
+	 * @param InStorageKey Key of the pending increments in the local data storage.
+	 * @param InFlushRequest Send the merged increments.
+	 */
+	FAccelByteStatIncrementAccumulator(FString const& InStorageKey, FFlushRequest InFlushRequest);
+	~FAccelByteStatIncrementAccumulator();
+
+	/**
+	 * @brief Reload the increments persisted by a previous run, send them and start the periodic flush. The local
+	 * data storage may answer asynchronously, nothing is persisted until the previous increments are merged.
+	 */
+	void Startup();
+
+	/**
+	 * @brief Stop the periodic flush and write the pending increments, they stay persisted for the next run.
+	 */
+	void Shutdown();
+
+	/**
+	 * @brief Queue an increment, merged with the pending increment of the same user and stat code.
+	 */
+	void Add(FString const& UserId, FString const& StatCode, float Inc);
+
+	/**
+	 * @brief Send the pending increments now.
+	 *
+	 * @param OnDone Called once the increments queued so far are sent, with false if the request failed.
+	 */
+	void Flush(THandler<bool> const& OnDone = THandler<bool>());
+
+	/**
+	 * @brief Number of distinct stat items waiting to be sent.
+	 */
+	int32 GetPendingCount() const;
+
+private:
+	static FString MakeEntryKey(FString const& UserId, FString const& StatCode);
+	static bool IsRetriable(int32 ErrorCode);
+
+	void AddLocked(FAccelByteModelsBulkUserStatItemInc const& Increment);
+	void SendPending();
+	void OnSent(TArray<FAccelByteModelsBulkStatItemOperationResult> const& Results);
+	void OnSendFailed(int32 ErrorCode, FString const& ErrorMessage);
+	void CompleteFlush(bool bSucceeded);
+	void OnPersistedLoaded(FString const& PersistedJson);
+	void SchedulePersist();
+	void Persist();
+	bool Tick(float DeltaTime);
+
+	FString const StorageKey;
+	FFlushRequest FlushRequest;
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FAccelByteModelsBulkUserStatItemInc> PendingIncrements;
+	TArray<FAccelByteModelsBulkUserStatItemInc> InFlightIncrements;
+	bool bIsSending {false};
+	bool bSendAgain {false};
+	TArray<THandler<bool>> FlushWaiters;
+
+	/** False until the increments of the previous run are merged, persisting before would overwrite them. */
+	bool bIsLoaded {false};
+	bool bIsPersistScheduled {false};
+
+	float FlushIntervalSeconds {10.0f};
+	int32 FlushThreshold {50};
+	float PersistDelaySeconds {1.0f};
+	FDelegateHandleAlias TickerHandle;
+	FDelegateHandleAlias PersistTickerHandle;
+};
+
+typedef TSharedPtr<FAccelByteStatIncrementAccumulator, ESPMode::ThreadSafe> FAccelByteStatIncrementAccumulatorPtr;
+
+}
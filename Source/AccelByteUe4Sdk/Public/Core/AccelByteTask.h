@@ -5,6 +5,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
 
 namespace AccelByte 
 {
@@ -196,6 +197,25 @@ public:
 		return true; 
 	}
 
+	/**
+	 * @brief Request cancellation and cancel right away, the result of the Task is discarded.
+	 * Does nothing when the Task is already done.
+	 */
+	bool Abort()
+	{
+		Token->Cancel();
+		if (!Token->IsCancelRequested())
+		{
+			return false;
+		}
+		return Cancel();
+	}
+
+	/**
+	 * @brief Return true if the Task was cancelled through its cancellation token or Abort.
+	 */
+	bool IsCancelledByToken() const { return Token->IsCancelled() || Token->IsCancelRequested(); }
+
 	/**
 	 * @brief Task Execution ticks.
 	 *
@@ -244,6 +264,130 @@ protected:
 	FAccelByteCancellationTokenRef Token = MakeShared<FAccelByteCancellationTokenSource, ESPMode::ThreadSafe>();
 };
 
+class FAccelByteRequestCancellationToken;
+
+typedef TSharedPtr<FAccelByteRequestCancellationToken, ESPMode::ThreadSafe> FAccelByteRequestCancellationTokenPtr;
+typedef TSharedRef<FAccelByteRequestCancellationToken, ESPMode::ThreadSafe> FAccelByteRequestCancellationTokenRef;
+typedef TWeakPtr<FAccelByteRequestCancellationToken, ESPMode::ThreadSafe> FAccelByteRequestCancellationTokenWeakPtr;
+
+/**
+ * @brief Caller owned token that cancels every Task and operation linked to it, e.g. all the requests of a screen,
+ * including the chained ones, the retries and the page requests of an iterator.
+ * Cancelling aborts the HTTP requests in flight and removes them from the scheduler, their responses are neither
+ * deserialized nor delivered: no handler of a cancelled request is called.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteRequestCancellationToken
+	: public TSharedFromThis<FAccelByteRequestCancellationToken, ESPMode::ThreadSafe>
+{
+public:
+	static FAccelByteRequestCancellationTokenRef Create()
+	{
+		return MakeShared<FAccelByteRequestCancellationToken, ESPMode::ThreadSafe>();
+	}
+
+	/**
+	 * @brief Cancel every linked Task and call every registered callback, only the first call has an effect.
+	 */
+	void Cancel()
+	{
+		TArray<FAccelByteTaskWPtr> TasksToAbort;
+		TArray<TFunction<void()>> CallbacksToCall;
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (bIsCancelled)
+			{
+				return;
+			}
+			bIsCancelled = true;
+			TasksToAbort = MoveTemp(Tasks);
+			CallbacksToCall = MoveTemp(Callbacks);
+		}
+
+		for (FAccelByteTaskWPtr const& TaskWPtr : TasksToAbort)
+		{
+			FAccelByteTaskPtr TaskPtr = TaskWPtr.Pin();
+			if (TaskPtr.IsValid())
+			{
+				TaskPtr->Abort();
+			}
+		}
+		for (TFunction<void()> const& Callback : CallbacksToCall)
+		{
+			Callback();
+		}
+	}
+
+	bool IsCancelled() const
+	{
+		FScopeLock ScopeLock(&Lock);
+		return bIsCancelled;
+	}
+
+	/**
+	 * @brief Link a Task to the token, it is aborted right away when the token is already cancelled.
+	 */
+	void Register(FAccelByteTaskWPtr const& Task)
+	{
+		FAccelByteTaskPtr TaskPtr = Task.Pin();
+		if (!TaskPtr.IsValid())
+		{
+			return;
+		}
+
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (!bIsCancelled)
+			{
+				// Long lived tokens keep linking requests, forget the finished ones
+				Tasks.RemoveAll([](FAccelByteTaskWPtr const& Item) { return !Item.IsValid(); });
+				Tasks.Add(Task);
+				return;
+			}
+		}
+		TaskPtr->Abort();
+	}
+
+	/**
+	 * @brief Call a function on cancellation, right away when the token is already cancelled.
+	 */
+	void RegisterCallback(TFunction<void()> Callback)
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (!bIsCancelled)
+			{
+				Callbacks.Add(MoveTemp(Callback));
+				return;
+			}
+		}
+		Callback();
+	}
+
+	/**
+	 * @brief Create a token cancelled along with this one, that can also be cancelled on its own, for a sub operation.
+	 */
+	FAccelByteRequestCancellationTokenRef CreateLinkedToken()
+	{
+		FAccelByteRequestCancellationTokenRef LinkedToken = Create();
+		FAccelByteRequestCancellationTokenWeakPtr LinkedTokenWPtr = LinkedToken;
+		RegisterCallback([LinkedTokenWPtr]()
+			{
+				FAccelByteRequestCancellationTokenPtr LinkedTokenPtr = LinkedTokenWPtr.Pin();
+				if (LinkedTokenPtr.IsValid())
+				{
+					LinkedTokenPtr->Cancel();
+				}
+			});
+		return LinkedToken;
+	}
+
+private:
+	mutable FCriticalSection Lock;
+	bool bIsCancelled {false};
+	TArray<FAccelByteTaskWPtr> Tasks;
+	TArray<TFunction<void()>> Callbacks;
+};
+
 FORCEINLINE FAccelByteTask::FAccelByteTask()
 {
 
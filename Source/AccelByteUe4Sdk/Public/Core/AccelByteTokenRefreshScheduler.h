@@ -0,0 +1,92 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+#include "Core/AccelByteBaseCredentials.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Shared scheduler of the token refresh of every credentials in the process.
+ * Credentials schedule their refresh deadline instead of polling it from their own ticker. Deadlines are kept in a
+ * min-heap, so scheduling is O(log n) and a single core ticker only looks at the deadlines that are due.
+ *
+ * Deadlines further than a few seconds away are delayed by a random jitter of up to 10% of the remaining time, capped
+ * by [AccelByte.Credentials] TokenRefreshMaxJitterSeconds (default 30), so credentials logged in together don't refresh
+ * on the same frame. At most MaxConcurrentTokenRefreshes (default 16) refresh requests are in flight, the other due
+ * refreshes wait for the next tick.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteTokenRefreshScheduler
+{
+public:
+	FAccelByteTokenRefreshScheduler();
+	~FAccelByteTokenRefreshScheduler();
+
+	/**
+	 * @brief Schedule the next refresh of a credentials, replacing the one scheduled before.
+	 * The scheduler only keeps a weak reference, expired credentials are dropped when their deadline is due.
+	 *
+	 * @param Credentials Credentials to refresh.
+	 * @param RefreshTime Deadline in FPlatformTime::Seconds(), PollRefreshToken is called once it's reached.
+	 */
+	void Schedule(FBaseCredentialsRef const& Credentials, double RefreshTime);
+
+	/**
+	 * @brief Cancel the scheduled refresh of a credentials.
+	 */
+	void Unschedule(BaseCredentials const* Credentials);
+
+	/**
+	 * @brief Release the concurrency budget taken by a refresh request, called when the request is done.
+	 */
+	void NotifyRefreshFinished(BaseCredentials const* Credentials);
+
+	int32 GetScheduledCount() const;
+
+private:
+	struct FEntry
+	{
+		double DueTime;
+		uint64 Generation;
+		FBaseCredentialsWPtr Credentials;
+		BaseCredentials const* Key;
+
+		bool operator<(FEntry const& Other) const
+		{
+			return DueTime < Other.DueTime;
+		}
+	};
+
+	bool Tick(float DeltaTime);
+	void LoadConfig();
+	void StartTicker();
+	void StopTicker();
+
+	mutable FCriticalSection Lock;
+
+	/** Min-heap on DueTime, entries whose generation is not the latest of their credentials are skipped. */
+	TArray<FEntry> Heap;
+	TMap<BaseCredentials const*, uint64> Generations;
+	TSet<BaseCredentials const*> InFlight;
+	uint64 NextGeneration {1};
+
+	bool bIsConfigLoaded {false};
+	double MaxJitterSeconds {30.0};
+	int32 MaxConcurrentRefreshes {16};
+	FDelegateHandleAlias TickerHandle;
+
+	FAccelByteTokenRefreshScheduler(FAccelByteTokenRefreshScheduler const&) = delete;
+	FAccelByteTokenRefreshScheduler(FAccelByteTokenRefreshScheduler&&) = delete;
+	FAccelByteTokenRefreshScheduler& operator=(FAccelByteTokenRefreshScheduler const&) = delete;
+	FAccelByteTokenRefreshScheduler& operator=(FAccelByteTokenRefreshScheduler&&) = delete;
+};
+
+}
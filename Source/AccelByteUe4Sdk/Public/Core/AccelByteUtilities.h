@@ -23,6 +23,11 @@ static constexpr int32 UserIdsURLLimit = 40;
 
 static constexpr int32 MaximumQueryLimit = 100;
 
+namespace AccelByte
+{
+class FAccelByteDeviceIdentity;
+}
+
 enum class EAccelBytePlatformType : uint8;
 enum class EAccelByteDevModeDeviceIdMethod : uint8;
 enum class EJwtResult
@@ -31,7 +36,9 @@ enum class EJwtResult
 	MalformedJwt,
 	SignatureMismatch,
 	AlgorithmMismatch,
-	MalformedPublicKey
+	MalformedPublicKey,
+	UnknownKeyId,
+	Expired
 };
 
 UENUM(BlueprintType)
@@ -322,6 +329,7 @@ public:
 	 * NOTE:
 	 * DeviceID for shipping build and Dedicated Server are always encoded, and other thant those it can use development
 	 * mode DeviceID that is configurable from the .ini file.
+	 * The DeviceID is computed once and kept by FRegistry::DeviceIdentity, call InvalidateDeviceId there to compute it again.
 	 *
 	 * @param bIsDeviceIdRequireEncode Flag to encode DeviceID. (default: true)
 	 * 
@@ -329,6 +337,12 @@ public:
 	 */
 	static FString GetDeviceId(bool bIsDeviceIdRequireEncode = true);
 
+	/**
+	 * @brief Delete the DeviceID cached in the local data storage and forget the one kept by FRegistry::DeviceIdentity,
+	 * the next GetDeviceId computes it again. A platform specific DeviceID stays the same.
+	 */
+	static void ResetDeviceId();
+
 	/**
 	 * @brief Encode HMAC the message using built in function from UnrealEngine and then Base64 the result.
 	 * 
@@ -480,6 +494,13 @@ protected:
 	 */
 	static FString GetOrSetIfDeviceIdNotFound(FString const& Default = "");
 
+	/**
+	 * @brief Compute the DeviceID without the HMAC encoding, development mode overrides are already applied.
+	 * Only used by FAccelByteDeviceIdentity, see GetDeviceId.
+	 */
+	static FString ComputeDeviceId();
+	friend class AccelByte::FAccelByteDeviceIdentity;
+
 	/**
 	 * @brief Get the development mode DeviceID override method from "DefaultEngine.ini"
 	 *  	Section:	[AccelByte.Dev]
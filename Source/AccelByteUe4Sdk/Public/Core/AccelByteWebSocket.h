@@ -8,6 +8,7 @@
 #include "Core/IWebSocketFactory.h"
 #include "Core/AccelByteDefines.h"
 #include "IWebSocket.h"
+#include "HAL/ThreadSafeBool.h"
 
 namespace AccelByte
 {
@@ -42,9 +43,39 @@ struct FConnectionClosedParams
 	bool WasClean;	
 };
 
+/**
+ * @brief Priority class of an outbound websocket message, lower value is flushed first.
+ */
+enum class EWebSocketMessagePriority : uint8
+{
+	/** Request/response traffic the user is waiting on, sent right away when the socket is connected. */
+	Critical = 0,
+	/** Regular traffic, flushed on the next tick. */
+	Normal = 1,
+	/** Low value traffic (e.g. presence), flushed on the next tick after the other classes and dropped first. */
+	Background = 2,
+
+	Count
+};
+
+struct FAccelByteWebSocketOutboundStats
+{
+	/** @brief Number of messages currently waiting in the outbound queue. */
+	int32 QueueDepth{0};
+	/** @brief Number of messages written to the socket. */
+	int64 SentCount{0};
+	/** @brief Number of messages that were replaced by a newer message with the same coalesce key. */
+	int64 CoalescedCount{0};
+	/** @brief Number of messages dropped because the outbound queue was full or the socket was closed. */
+	int64 DroppedCount{0};
+	/** @brief Number of messages that were queued while the socket was not connected and sent after (re)connecting. */
+	int64 ReplayedCount{0};
+};
+
 ENUM_CLASS_FLAGS(EWebSocketEvent);
 
 class ACCELBYTEUE4SDK_API AccelByteWebSocket
+	: public TSharedFromThis<AccelByteWebSocket, ESPMode::ThreadSafe>
 {
 public:
 	DECLARE_MULTICAST_DELEGATE(FConnectDelegate)
@@ -77,9 +108,6 @@ public:
 
 	void Reconnect();
 
-	FTickerDelegate TickerDelegate;
-	FDelegateHandleAlias TickerDelegateHandle;
-
 	static TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe> Create(
 		const FString& Url,
 		const FString& Protocol,
@@ -113,11 +141,89 @@ public:
 	void Disconnect(bool ForceCleanup = false);
 	bool IsConnected() const;
 	void SendPing() const;
+
+	/**
+	 * @brief Send a message through the websocket.
+	 * The message is written right away when the socket is connected and nothing is waiting in the outbound queue,
+	 * queued and replayed once the socket is connected when it is connecting or reconnecting, and dropped otherwise.
+	 *
+	 * @param Message The message to send.
+	 */
 	void Send(const FString& Message) const;
-	
+
+	/**
+	 * @brief Queue a message to be sent through the websocket on the next tick.
+	 * Messages are kept in a buffer bounded by MaxOutboundQueueSize while the socket is connecting or reconnecting
+	 * and are flushed in priority order once it is connected. Messages sent while the socket is closed are dropped.
+	 *
+	 * @param Message The message to send.
+	 * @param Priority Priority class of the message.
+	 * @param CoalesceKey Optional key, a queued message with the same key and priority is replaced by this message
+	 * instead of sending both. Use it for messages that supersede the previous one, e.g. presence status.
+	 * @param OutSupersededMessage Optional, set to the queued message replaced by this one, empty if none was.
+	 * @return false if the message was dropped.
+	 */
+	bool Send(const FString& Message
+		, EWebSocketMessagePriority Priority
+		, const FString& CoalesceKey = TEXT("")
+		, FString* OutSupersededMessage = nullptr) const;
+
+	/**
+	 * @brief Whether the socket is currently connected or trying to get connected again,
+	 * i.e. a queued message will eventually be sent.
+	 */
+	bool IsConnectedOrReconnecting() const;
+
+	/**
+	 * @brief Get the outbound queue depth and drop counters.
+	 */
+	FAccelByteWebSocketOutboundStats GetOutboundStats() const;
+
+	/**
+	 * @brief Set the maximum number of messages kept in the outbound queue, e.g. while the socket is reconnecting.
+	 */
+	void SetMaxOutboundQueueSize(int32 InMaxOutboundQueueSize);
+
+	/**
+	 * @brief Set whether incoming messages and connection events are dispatched on the next game thread frame
+	 * (event driven) or only on the periodic housekeeping tick.
+	 */
+	void SetEventDrivenDispatch(bool bInEventDrivenDispatch);
+
+	/**
+	 * @brief Name of the metrics registry histogram that records the time between a message being received from the
+	 * socket and being broadcast to OnMessageReceived handlers.
+	 */
+	static const FString ReceiveToDispatchLatencyName;
+
 private:
+	struct FReceivedMessage
+	{
+		FString Payload;
+		double ReceivedAt;
+	};
+
+	struct FOutboundMessage
+	{
+		FString Payload;
+		FString CoalesceKey;
+		bool bQueuedWhileDisconnected;
+	};
+
+	/** Sending doesn't change the state of the connection, the outbound buffer is mutable so Send stays const. */
+	mutable FCriticalSection OutboundLock;
+	mutable TArray<FOutboundMessage> OutboundQueues[static_cast<uint8>(EWebSocketMessagePriority::Count)];
+	mutable FAccelByteWebSocketOutboundStats OutboundStats;
+	int32 MaxOutboundQueueSize {256};
+
+	int32 GetOutboundQueueDepth() const;
+	bool DropLowestPriorityMessage(EWebSocketMessagePriority IncomingPriority) const;
+	void FlushOutboundQueue() const;
+	void ClearOutboundQueue();
+	void WriteMessage(const FString& Message) const;
+
 	bool bConnectTriggered {false};
-	TQueue<FString> OnMessageQueue;
+	TQueue<FReceivedMessage> OnMessageQueue;
 	TQueue<FConnectionClosedParams> OnConnectionClosedQueue;
 	TQueue<FString> OnConnectionErrorQueue;
 	bool bConnectedBroadcasted {false};
@@ -127,7 +233,11 @@ private:
 	FConnectionErrorDelegate ConnectionErrorDelegate;
 	FConnectionCloseDelegate ConnectionCloseDelegate;
 
-	const float TickPeriod {0.5f};
+	bool bEventDrivenDispatch {true};
+	FThreadSafeBool bDispatchScheduled {false};
+
+	/** Set by Create, copied by the socket thread instead of calling AsShared while the last reference may be released. */
+	TWeakPtr<AccelByteWebSocket, ESPMode::ThreadSafe> SelfWPtr;
 	double TimeSinceLastPing {0.0f};
 	float TimeSinceLastReconnect {0.0f};
 	float TimeSinceConnectionLost {0.0f};
@@ -163,6 +273,7 @@ private:
 	EWebSocketEvent WsEvents;
 
 	void SetupWebSocket();
+	void LoadConfig();
 	bool Tick(float DeltaTime);
 	void OnConnectionConnected();
 	void OnConnectionError(const FString& Error);
@@ -174,9 +285,18 @@ private:
 	bool StateTick(float DeltaTime);
 	bool MessageTick(float DeltaTime);
 
+	/**
+	 * Wake up the game thread to dispatch the queued messages and events on its next frame, instead of waiting for
+	 * the housekeeping tick. Safe to call from any thread, multiple calls before the dispatch are collapsed.
+	 */
+	void ScheduleDispatch();
+	void DispatchPendingMessages();
+
 	void TeardownTicker();
 	void TeardownWebsocket();
 
+	friend class FAccelByteWebSocketLoop;
+
 	AccelByteWebSocket(AccelByteWebSocket const&) = delete; // Copy constructor
 	AccelByteWebSocket(AccelByteWebSocket&&) = delete; // Move constructor
 	AccelByteWebSocket& operator=(AccelByteWebSocket const&) = delete; // Copy assignment operator
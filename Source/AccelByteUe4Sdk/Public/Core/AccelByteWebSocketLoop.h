@@ -0,0 +1,77 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+
+#include "Core/AccelByteDefines.h"
+
+namespace AccelByte
+{
+class AccelByteWebSocket;
+
+/**
+ * @brief Shared event loop for every AccelByteWebSocket in the process.
+ * A single core ticker drives the housekeeping (state machine, ping, reconnect backoff, outbound flush) of all
+ * registered sockets instead of one ticker per socket. Sockets are spread over the slots of a timer wheel, each loop
+ * tick services one slot, so a large number of sockets doesn't do all its housekeeping on the same frame.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteWebSocketLoop
+{
+public:
+	/**
+	 * @param InTickPeriod Housekeeping period of every registered socket, in seconds.
+	 * @param InSlotCount Number of slots of the timer wheel, the loop ticks every TickPeriod / SlotCount seconds.
+	 */
+	FAccelByteWebSocketLoop(float InTickPeriod = 0.5f, int32 InSlotCount = 5);
+	~FAccelByteWebSocketLoop();
+
+	/**
+	 * @brief Add a socket to the loop, does nothing if it is already registered.
+	 * The loop only keeps a weak reference, an expired socket is removed on its next slot.
+	 */
+	void Register(TSharedRef<AccelByteWebSocket, ESPMode::ThreadSafe> const& WebSocket);
+
+	/**
+	 * @brief Remove a socket from the loop, safe to call while the loop is servicing the socket.
+	 */
+	void Unregister(AccelByteWebSocket const* WebSocket);
+
+	bool IsRegistered(AccelByteWebSocket const* WebSocket) const;
+
+	int32 GetRegisteredCount() const;
+
+	float GetTickPeriod() const { return TickPeriod; }
+
+private:
+	struct FEntry
+	{
+		TWeakPtr<AccelByteWebSocket, ESPMode::ThreadSafe> WebSocket;
+		AccelByteWebSocket const* Key;
+	};
+
+	bool Tick(float DeltaTime);
+	void StartTicker();
+	void StopTicker();
+
+	const float TickPeriod;
+	mutable FCriticalSection Lock;
+	TArray<TArray<FEntry>> Slots;
+
+	/** Slot index of every registered socket, keeps the registration lookups constant time. */
+	TMap<AccelByteWebSocket const*, int32> SlotIndexByKey;
+	int32 CurrentSlot {0};
+	int32 NextRegisterSlot {0};
+	FDelegateHandleAlias TickerHandle;
+
+	FAccelByteWebSocketLoop(FAccelByteWebSocketLoop const&) = delete;
+	FAccelByteWebSocketLoop(FAccelByteWebSocketLoop&&) = delete;
+	FAccelByteWebSocketLoop& operator=(FAccelByteWebSocketLoop const&) = delete;
+	FAccelByteWebSocketLoop& operator=(FAccelByteWebSocketLoop&&) = delete;
+};
+
+}
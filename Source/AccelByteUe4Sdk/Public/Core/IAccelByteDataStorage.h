@@ -109,5 +109,12 @@ namespace AccelByte
 		* @param NewCacheFilenameForGeneralPurpose
 		*/
 		virtual void ConvertExistingCache(const FString& OldCacheFilename, const FString& NewCacheFilenameForTelemetry, const FString& NewCacheFilenameForGeneralPurpose) = 0;
+
+		/**
+		 * @brief Write every pending change to the storage, only needed by storages that defer their writes.
+		 *
+		 * @return false if one of the pending changes failed to be written.
+		*/
+		virtual bool Flush() { return true; }
 	};
 }
@@ -8,6 +8,7 @@
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteUtilities.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelBytePeriodicTaskScheduler.h"
 #include "Core/AccelByteDefines.h"
 #include "Core/AccelByteServerApiBase.h"
 #include "Models/AccelByteDSMModels.h"
@@ -295,8 +296,8 @@ private:
 	FErrorHandler OnHeartbeatError;
 	FTickerDelegate AutoShutdownDelegate;
 	FTickerDelegate HeartbeatDelegate;
-	FDelegateHandleAlias AutoShutdownDelegateHandle;
-	FDelegateHandleAlias HeartbeatDelegateHandle;
+	FAccelBytePeriodicTaskHandle AutoShutdownDelegateHandle;
+	FAccelBytePeriodicTaskHandle HeartbeatDelegateHandle;
 	THandler<FAccelByteModelsPubIp> GetPubIpDelegate;
 	FAccelByteModelsServerInfo RegisteredServerInfo;
 };
@@ -120,6 +120,19 @@ namespace GameServerApi
 		 */
 		void CollectMetrics();
 
+		/**
+		 * @brief Set whether the SDK health metrics (HTTP latency per endpoint, retry, cache, rate limit and
+		 * websocket counters from FRegistry::MetricsRegistry) are exported along with the other metrics.
+		 * Disabled by default.
+		 * @param Enable
+		 */
+		void SetSdkHealthMetricsEnabled(bool Enable);
+
+		/**
+		 * @brief Collect the SDK health snapshot and enqueue it as metrics.
+		 */
+		void CollectSdkHealthMetrics();
+
 	protected:
 		virtual bool ExportMetrics(float DeltaTime);
 		TQueue<TSharedPtr<FString>> MetricQueue;
@@ -147,6 +160,7 @@ namespace GameServerApi
 		const FString SocketDescription = "Metric Exporter";
 		int32 SendBufferSize = 1 << 16;
 		bool bOptionalMetricsEnabled = true;
+		bool bSdkHealthMetricsEnabled = false;
 	};
 }
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteServerApiBase.h"
+#include "Core/AccelByteJwtVerifier.h"
 
 using AccelByte::THandler;
 using AccelByte::FVoidHandler;
@@ -48,6 +49,14 @@ public:
 	FAccelByteTaskWPtr GetJwks(THandler<FJwkSet> const& OnSuccess
 		, FErrorHandler const& OnError);
 
+	/**
+	 * @brief Get the local JWT verifier of this server, e.g. to validate the access token of joining players.
+	 * Keys are fetched with GetJwks on first use and whenever a token is signed with an unknown key.
+	 *
+	 * @return Verifier shared by every call on this ServerOauth2.
+	 */
+	FAccelByteJwtVerifierRef GetJwtVerifier();
+
 	/**
 	 * @brief Remove access tokens, user ID, and other credentials from memory.
 	 */
@@ -74,6 +83,7 @@ private:
 		, FErrorHandler const& OnError);
 
 	TSharedRef<ServerCredentials, ESPMode::ThreadSafe> ServerCredentialsRef;
+	FAccelByteJwtVerifierPtr JwtVerifier;
 	ServerOauth2() = delete; // static class can't have instance
 	ServerOauth2(ServerOauth2 const&) = delete;
 	ServerOauth2(ServerOauth2&&) = delete;
@@ -9,6 +9,7 @@
 #include "Models/AccelByteStatisticModels.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteServerApiBase.h"
+#include "Core/AccelByteStatIncrementAccumulator.h"
 
 // Forward declarations
 class IWebSocket;
@@ -100,6 +101,27 @@ public:
 		, THandler<TArray<FAccelByteModelsBulkStatItemOperationResult>> const& OnSuccess
 		, FErrorHandler const& OnError);
 
+	/**
+	 * @brief Queue increments of users stat items instead of sending them right away.
+	 * Increments of the same user and stat code are merged and sent in bulk on an interval, see FAccelByteStatIncrementAccumulator.
+	 *
+	 * @param Data array consist of increased value, user id, and stat code.
+	 */
+	void QueueIncrementManyUsersStatItems(TArray<FAccelByteModelsBulkUserStatItemInc> const& Data);
+
+	/**
+	 * @brief Send the queued increments now, e.g. at match end.
+	 *
+	 * @param OnDone This will be called once the queued increments are sent, with false if the request failed.
+	 */
+	void FlushQueuedStatItemIncrements(THandler<bool> const& OnDone = THandler<bool>());
+
+	/**
+	 * @brief Reload the queued increments a previous run couldn't send and send them, without waiting for a new
+	 * increment. Called at module startup for the registry instance of a dedicated server.
+	 */
+	void StartupQueuedStatItemIncrements();
+
 	/**
 	 * @brief Increment stat items of a user (could be negative)
 	 *
@@ -266,6 +288,11 @@ private:
 	ServerStatistic(ServerStatistic&&) = delete;
 
 	static FString ConvertUserStatisticSortByToString(const EAccelByteStatisticSortBy& SortBy);
+
+	FAccelByteStatIncrementAccumulatorPtr GetIncrementAccumulator();
+
+	/** Created by StartupQueuedStatItemIncrements or on the first queued increment. */
+	FAccelByteStatIncrementAccumulatorPtr IncrementAccumulator;
 };
 
 } // Namespace GameServerApi
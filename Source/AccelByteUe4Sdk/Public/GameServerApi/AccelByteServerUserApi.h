@@ -10,6 +10,7 @@
 #include "Models/AccelByteUserModels.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteServerApiBase.h"
+#include "Core/AccelByteBulkFanOut.h"
 
 namespace AccelByte
 {
@@ -122,16 +123,19 @@ public:
 
 	/**
 	 * @brief This function will get multiple user(s) information. 
+	 * UserIds are split into requests of 100 sent concurrently, see TAccelByteBulkFanOut.
 	 *
-	 * @param UserIds List UserId(s) to get. SHOULD NOT EXCEED 100
+	 * @param UserIds List UserId(s) to get.
 	 * @param OnSuccess This will be called when the operation succeeded. The result is FListBulkUserInfo.
-	 * @param OnError This will be called when the operation failed.
+	 * @param OnError This will be called when every request failed.
+	 * @param OnPartialFailure optional. This will be called before OnSuccess with the UserIds of the requests that failed.
 	 * 
 	 * @return AccelByteTask object to track and cancel the ongoing API operation.
 	 */
 	FAccelByteTaskWPtr BulkGetUserInfo(TArray<FString> const& UserIds
 		, THandler<FListBulkUserInfo> const& OnSuccess
-		, FErrorHandler const& OnError);
+		, FErrorHandler const& OnError
+		, FAccelByteBulkFailuresHandler const& OnPartialFailure = FAccelByteBulkFailuresHandler());
 	
 private:
 	ServerUser() = delete;
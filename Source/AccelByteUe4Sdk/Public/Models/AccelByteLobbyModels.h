@@ -1132,7 +1132,7 @@ struct ACCELBYTEUE4SDK_API FAccelByteModelsBulkUserStatusNotif
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Lobby | Models | Lobby | BulkUserStatusNotif")
 	int32 Away{};
 
-	/** @brief UserIds that not processed because of the url limit */
+	/** @brief UserIds that not processed because their request failed */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Lobby | Models | Lobby | BulkUserStatusNotif")
 	TArray<FString> NotProcessed{};
 };
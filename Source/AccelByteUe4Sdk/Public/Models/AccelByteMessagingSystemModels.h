@@ -13,6 +13,8 @@ enum class EAccelByteMessagingTopic : uint8
 	QosRegionLatenciesUpdated,
 	AuthTokenSet,
 	NotificationSenderLobby,
+	UserPresenceUpdated,
+	FriendRemoved,
 };
 
 struct FAccelByteModelsMessagingSystemMessage